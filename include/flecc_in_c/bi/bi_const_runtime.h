@@ -65,6 +65,17 @@ void bigint_cr_switch( uint_t *var1, uint_t *var2, const int condition, const in
  */
 void bigint_cr_select_2( uint_t *result, const uint_t *var0, const uint_t *var1, const int condition, const int length );
 
+/**
+ * Copies a big integer to the destination if the condition is set, in constant time.
+ * Uses SSE2 or AVX2 if available, which makes scans of whole tables cheaper.
+ *
+ * @param result the destination, keeps its value if condition is 0
+ * @param var the big integer to copy
+ * @param condition if 1, var is copied; if 0, result is not changed (0 || 1)
+ * @param length the number of uint_t elements in the big integers (>= 1)
+ */
+void bigint_cr_conditional_copy( uint_t *result, const uint_t *var, const int condition, const int length );
+
 /**
  * Compares two big integers for equality with configurable length in constant time.
  *
@@ -216,6 +216,18 @@ int bigint_is_one_var( const uint_t *a, const int length );
  */
 void bigint_multiply_var( uint_t *res, const uint_t *a, const uint_t *b, const int lengthA, const int lengthB );
 
+/**
+ * Square a big integer with configurable length. The products a[i]*a[j] with
+ * i != j are computed only once and doubled afterwards.
+ *
+ * Semantic: res = a * a
+ *
+ * @param res destination big integer (has to have length = 2 * length)
+ * @param a the big integer to square
+ * @param length the number of uint_t elements in the big integer a
+ */
+void bigint_square_var( uint_t *res, const uint_t *a, const int length );
+
 /**
  * Copy a big integer with configurable length.
  *
@@ -41,7 +41,9 @@
 #include "eccp_affine.h"
 #include "eccp_generic.h"
 #include "eccp_jacobian.h"
+#include "eccp_multi.h"
 #include "eccp_protected.h"
 #include "eccp_std_projective.h"
+#include "eccp_table.h"
 
 #endif /* ECCP_H_ */
@@ -40,14 +40,28 @@
 
 #include "../types.h"
 
+/** the maximum number of additions of eccp_affine_point_add_batch (sharing one inversion) */
+#define ECCP_AFFINE_BATCH_SIZE 16
+
 int eccp_affine_point_is_valid( const eccp_point_affine_t *A, const eccp_parameters_t *param );
 int eccp_affine_point_compare( const eccp_point_affine_t *A, const eccp_point_affine_t *B, const eccp_parameters_t *param );
 void eccp_affine_point_copy( eccp_point_affine_t *dest, const eccp_point_affine_t *src, const eccp_parameters_t *param );
+void eccp_affine_table_select_ct( eccp_point_affine_t *res,
+                                  const eccp_point_affine_t *table,
+                                  const int count,
+                                  const uint_t index,
+                                  const eccp_parameters_t *param );
+int eccp_affine_point_decompress( eccp_point_affine_t *res, const gfp_t x, const eccp_parameters_t *param );
 
 void eccp_affine_point_add( eccp_point_affine_t *res,
                             const eccp_point_affine_t *A,
                             const eccp_point_affine_t *B,
                             const eccp_parameters_t *param );
+void eccp_affine_point_add_batch( eccp_point_affine_t *res[],
+                                  const eccp_point_affine_t *A[],
+                                  const eccp_point_affine_t *B[],
+                                  const int count,
+                                  const eccp_parameters_t *param );
 void eccp_affine_point_double( eccp_point_affine_t *res, const eccp_point_affine_t *A, const eccp_parameters_t *param );
 void eccp_affine_point_negate( eccp_point_affine_t *res, const eccp_point_affine_t *P, const eccp_parameters_t *param );
 void eccp_affine_point_subtract( eccp_point_affine_t *res,
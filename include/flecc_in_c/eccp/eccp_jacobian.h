@@ -49,9 +49,17 @@ void eccp_jacobian_point_copy( eccp_point_projective_t *dest,
                                const eccp_parameters_t *param );
 
 void eccp_jacobian_to_affine( eccp_point_affine_t *res, const eccp_point_projective_t *a, const eccp_parameters_t *param );
+void eccp_jacobian_to_affine_batch( eccp_point_affine_t *res,
+                                    const eccp_point_projective_t *a,
+                                    const int count,
+                                    const eccp_parameters_t *param );
 void eccp_affine_to_jacobian( eccp_point_projective_t *res, const eccp_point_affine_t *a, const eccp_parameters_t *param );
 
 void eccp_jacobian_point_double( eccp_point_projective_t *res, const eccp_point_projective_t *a, const eccp_parameters_t *param );
+void eccp_jacobian_point_double_repeated( eccp_point_projective_t *res,
+                                          const eccp_point_projective_t *a,
+                                          const int k,
+                                          const eccp_parameters_t *param );
 void eccp_jacobian_point_add( eccp_point_projective_t *res,
                               const eccp_point_projective_t *a,
                               const eccp_point_projective_t *b,
@@ -75,16 +83,64 @@ void eccp_jacobian_point_multiply_L2R_NAF( eccp_point_affine_t *result,
                                            const gfp_t scalar,
                                            const eccp_parameters_t *param );
 
+/** the maximum window width of eccp_jacobian_point_multiply_WNAF_width */
+#define JCB_WNAF_MAX_WIDTH 7
+
+/** convert a wNAF window width to the number of precomputed odd multiples */
+#define JCB_WNAF_TBL_SIZE( width ) ( 1 << ( width - 2 ) )
+
+void eccp_jacobian_point_multiply_WNAF_width( eccp_point_affine_t *result,
+                                              const eccp_point_affine_t *P,
+                                              const gfp_t scalar,
+                                              const int width,
+                                              const eccp_parameters_t *param );
+void eccp_jacobian_point_multiply_WNAF( eccp_point_affine_t *result,
+                                        const eccp_point_affine_t *P,
+                                        const gfp_t scalar,
+                                        const eccp_parameters_t *param );
+
+/** the maximum number of points of eccp_jacobian_point_multiply_interleaved */
+#define JCB_INTERLEAVED_MAX_POINTS 8
+
+/** the maximum wNAF window width of eccp_jacobian_point_multiply_interleaved (bounds its tables) */
+#define JCB_INTERLEAVED_MAX_WIDTH 6
+
+void eccp_jacobian_point_multiply_interleaved( eccp_point_projective_t *res,
+                                               const gfp_t scalars[],
+                                               const eccp_point_affine_t points[],
+                                               const int count,
+                                               const eccp_parameters_t *param );
+void eccp_jacobian_double_scalar_multiply( eccp_point_affine_t *res,
+                                           const gfp_t u1,
+                                           const eccp_point_affine_t *P1,
+                                           const gfp_t u2,
+                                           const eccp_point_affine_t *P2,
+                                           const eccp_parameters_t *param );
+
+/** the maximum number of doubled base points the comb pre-computations normalize at once */
+#define JCB_COMB_BATCH_SIZE 8
+
 /** convert a table width size in bits to the actual table size */
 #define JCB_COMB_TBL_SIZE( width ) ( ( 1 << width ) - 1 )
 
+void eccp_jacobian_comb_table_precompute( eccp_point_affine_t *table,
+                                          const eccp_point_affine_t *P,
+                                          const int width,
+                                          const eccp_parameters_t *param );
 void eccp_jacobian_point_multiply_COMB( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param );
-void eccp_jacobian_point_multiply_COMB_precompute( eccp_parameters_t *param );
+void eccp_jacobian_point_multiply_COMB_precompute( eccp_point_affine_t *table, eccp_parameters_t *param );
+void eccp_jacobian_double_scalar_multiply_COMB( eccp_point_affine_t *res,
+                                                const gfp_t u1,
+                                                const eccp_point_affine_t *table1,
+                                                const gfp_t u2,
+                                                const eccp_point_affine_t *table2,
+                                                const int width,
+                                                const eccp_parameters_t *param );
 
 /** convert a table width size in bits to the actual table size */
 #define JCB_COMB_WOZ_TBL_SIZE( width ) ( 1 << ( width - 1 ) )
 
 void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param );
-void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_parameters_t *param );
+void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_point_affine_t *table, eccp_parameters_t *param );
 
 #endif /* ECCP_JACOBIAN_H_ */
@@ -48,6 +48,14 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
                                     const eccp_point_affine_t *P,
                                     const gfp_t scalar,
                                     const eccp_parameters_t *param );
+int eccp_protected_point_multiply_x( gfp_t result_x,
+                                     const eccp_point_affine_t *P,
+                                     const gfp_t scalar,
+                                     const eccp_parameters_t *param );
+void eccp_protected_point_multiply_coz( eccp_point_affine_t *result,
+                                        const eccp_point_affine_t *P,
+                                        const gfp_t scalar,
+                                        const eccp_parameters_t *param );
 
 #ifdef __cplusplus
 }
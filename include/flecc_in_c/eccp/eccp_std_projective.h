@@ -54,4 +54,45 @@ void eccp_std_projective_point_negate( eccp_point_projective_t *res,
                                        const eccp_point_projective_t *P,
                                        const eccp_parameters_t *param );
 
+void eccp_std_projective_table_select_ct( eccp_point_projective_t *res,
+                                          const eccp_point_projective_t *table,
+                                          const int count,
+                                          const uint_t index,
+                                          const eccp_parameters_t *param );
+
+void eccp_std_projective_point_add_complete( eccp_point_projective_t *res,
+                                             const eccp_point_projective_t *a,
+                                             const eccp_point_projective_t *b,
+                                             const eccp_parameters_t *param );
+void eccp_std_projective_point_double_complete( eccp_point_projective_t *res,
+                                                const eccp_point_projective_t *a,
+                                                const eccp_parameters_t *param );
+
+/** the window size in bits of eccp_std_projective_point_multiply_window (2^size precomputed points) */
+#define ECCP_STD_PROJECTIVE_WINDOW 4
+
+void eccp_std_projective_point_multiply_window( eccp_point_affine_t *result,
+                                                const eccp_point_affine_t *P,
+                                                const gfp_t scalar,
+                                                const eccp_parameters_t *param );
+
+/** the window size in bits of eccp_std_projective_point_multiply_signed_window
+ * (table of 2^(size-1)+1 points, the multiples 0*P to 2^(size-1)*P) */
+#define ECCP_STD_PROJECTIVE_SIGNED_WINDOW 5
+
+void eccp_std_projective_point_multiply_signed_window( eccp_point_affine_t *result,
+                                                       const eccp_point_affine_t *P,
+                                                       const gfp_t scalar,
+                                                       const eccp_parameters_t *param );
+
+/** the number of tables of the Lim-Lee comb eccp_std_projective_point_multiply_COMB_LL
+ * (the number of doublings is divided by it) */
+#define ECCP_STD_PROJECTIVE_COMB_TABLES 4
+
+/** convert a comb width to the table size of eccp_std_projective_point_multiply_COMB_LL */
+#define ECCP_STD_PROJECTIVE_COMB_TBL_SIZE( width ) ( ECCP_STD_PROJECTIVE_COMB_TABLES << ( width ) )
+
+void eccp_std_projective_point_multiply_COMB_LL( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param );
+void eccp_std_projective_point_multiply_COMB_LL_precompute( eccp_point_affine_t *table, eccp_parameters_t *param );
+
 #endif /* ECCP_STD_PROJECTIVE_H_ */
@@ -0,0 +1,110 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#ifndef ECCP_TABLE_H
+#define ECCP_TABLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../types.h"
+#include <stddef.h>
+
+/** the version of the table file format written by eccp_table_save */
+#define ECCP_TABLE_VERSION 1
+
+/** the size of the file header, the point data starts at this (cache line aligned) offset */
+#define ECCP_TABLE_HEADER_SIZE 128
+
+/** the pre-computation method a table file belongs to */
+typedef enum { ECCP_TABLE_COMB = 1, ECCP_TABLE_COMB_WOZ = 2, ECCP_TABLE_COMB_LL = 3 } eccp_table_algorithm_t;
+
+/** Header of a table file, all fields are stored in the byte order of the host
+ * (a file of a host with a different byte order fails the version check). The
+ * header is padded with zeros to ECCP_TABLE_HEADER_SIZE bytes and followed by
+ * entries eccp_point_affine_t structures. */
+typedef struct {
+    /** "FLECCTBL" */
+    uint8_t magic[8];
+    /** ECCP_TABLE_VERSION */
+    uint32_t version;
+    /** ECCP_TABLE_HEADER_SIZE */
+    uint32_t header_size;
+    /** the curve_type_t of the curve */
+    uint32_t curve_type;
+    /** the eccp_table_algorithm_t of the table */
+    uint32_t algorithm;
+    /** the comb width (base_point_precomputed_table_width) */
+    uint32_t width;
+    /** the limb size BYTES_PER_WORD */
+    uint32_t bytes_per_word;
+    /** the number of words of the prime */
+    uint32_t words;
+    /** 1 if the coordinates are in Montgomery domain */
+    uint32_t montgomery_domain;
+    /** sizeof(eccp_point_affine_t) */
+    uint32_t entry_size;
+    /** the number of table entries */
+    uint32_t entries;
+    /** Fletcher-64 checksum of the header (with zero checksum), the prime, the base point and the entries */
+    uint64_t checksum;
+} eccp_table_header_t;
+
+/** A table file mapped by eccp_table_map, has to be zero-initialized before its first use
+ * (e.g. with ECCP_TABLE_MAPPING_INIT). */
+typedef struct {
+    /** the start of the mapping (the header) or NULL if nothing is mapped */
+    void *base;
+    /** the length of the mapping in bytes */
+    size_t length;
+} eccp_table_mapping_t;
+
+/** initializer of an eccp_table_mapping_t without mapping */
+#define ECCP_TABLE_MAPPING_INIT \
+    { NULL, 0 }
+
+int eccp_table_save( const char *path, const eccp_parameters_t *param );
+int eccp_table_map( eccp_table_mapping_t *mapping, const char *path, eccp_parameters_t *param );
+void eccp_table_unmap( eccp_table_mapping_t *mapping, eccp_parameters_t *param );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECCP_TABLE_H */
@@ -47,9 +47,13 @@
 #define GFP_H_
 
 #include "../bi/bi.h"
+#include "gfp_chain.h"
 #include "gfp_const_runtime.h"
 #include "gfp_gen.h"
 #include "gfp_mont.h"
+#include "gfp_nist.h"
+#include "gfp_p521.h"
+#include "gfp_safegcd.h"
 
 /* performance optimized vs. constant runtime implementations */
 #if 0
@@ -58,11 +62,12 @@
 #define gfp_subtract( res, a, b ) gfp_gen_subtract( res, a, b, &param->prime_data )
 #define gfp_halving( res, a ) gfp_gen_halving( res, a, &param->prime_data )
 #define gfp_negate( res, a ) gfp_gen_negate( res, a, &param->prime_data )
-#define gfp_multiply( res, a, b ) gfp_mont_multiply( res, a, b, &param->prime_data )
-#define gfp_square( res, a ) gfp_mont_multiply( res, a, a, &param->prime_data )
-#define gfp_inverse( res, a ) gfp_mont_inverse( res, a, &param->prime_data )
+#define gfp_multiply( res, a, b ) gfp_gen_multiply( res, a, b, &param->prime_data )
+#define gfp_square( res, a ) gfp_gen_square( res, a, &param->prime_data )
+#define gfp_inverse( res, a ) gfp_gen_inverse( res, a, &param->prime_data )
 #define gfp_exponent( res, a, exponent, exponent_length )                                                                        \
-    gfp_mont_exponent( res, a, exponent, exponent_length, &param->prime_data )
+    gfp_gen_exponent( res, a, exponent, exponent_length, &param->prime_data )
+#define gfp_sqrt( res, a ) gfp_gen_sqrt( res, a, &param->prime_data )
 
 #define gfp_clear( dest ) bigint_clear_var( dest, param->prime_data.words )
 #define gfp_copy( dest, src ) bigint_copy_var( dest, src, param->prime_data.words )
@@ -75,11 +80,12 @@
 #define gfp_subtract( res, a, b ) gfp_cr_subtract( res, a, b, &param->prime_data )
 #define gfp_halving( res, a ) gfp_cr_halving( res, a, &param->prime_data )
 #define gfp_negate( res, a ) gfp_cr_negate( res, a, &param->prime_data )
-#define gfp_multiply( res, a, b ) gfp_mont_multiply( res, a, b, &param->prime_data )
-#define gfp_square( res, a ) gfp_mont_multiply( res, a, a, &param->prime_data )
-#define gfp_inverse( res, a ) gfp_mont_inverse_fermat( res, a, &param->prime_data )
+#define gfp_multiply( res, a, b ) gfp_gen_multiply( res, a, b, &param->prime_data )
+#define gfp_square( res, a ) gfp_gen_square( res, a, &param->prime_data )
+#define gfp_inverse( res, a ) gfp_gen_inverse( res, a, &param->prime_data )
 #define gfp_exponent( res, a, exponent, exponent_length )                                                                        \
-    gfp_mont_exponent( res, a, exponent, exponent_length, &param->prime_data )
+    gfp_gen_exponent( res, a, exponent, exponent_length, &param->prime_data )
+#define gfp_sqrt( res, a ) gfp_gen_sqrt( res, a, &param->prime_data )
 
 #define gfp_clear( dest ) bigint_clear_var( dest, param->prime_data.words )
 #define gfp_copy( dest, src ) bigint_copy_var( dest, src, param->prime_data.words )
@@ -0,0 +1,63 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#ifndef GFP_CHAIN_H_
+#define GFP_CHAIN_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../types.h"
+
+/** marks a gfp_chain_step_t without multiplication */
+#define GFP_CHAIN_NONE 0xFF
+
+/** the maximum number of temporaries of a gfp_chain_t */
+#define GFP_CHAIN_MAX_TEMPS 16
+
+void gfp_chain_exponent( gfp_t res, const gfp_t a, const gfp_chain_t *chain, const gfp_prime_data_t *prime_data );
+const gfp_chain_t *gfp_chain_get_inverse( const curve_type_t type );
+const gfp_chain_t *gfp_chain_get_order_inverse( const curve_type_t type );
+const gfp_chain_t *gfp_chain_get_sqrt( const curve_type_t type );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFP_CHAIN_H_ */
@@ -47,8 +47,23 @@ extern "C" {
 void gfp_cr_add( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
 void gfp_cr_subtract( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
 void gfp_cr_mont_multiply_sos( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_cr_mont_multiply_cios( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_cr_mont_multiply_comba( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_cr_mont_square_sos( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 void gfp_cr_halving( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 void gfp_cr_negate( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
+void gfp_cr_exponent_fixed_window( gfp_t res,
+                                   const gfp_t a,
+                                   const uint_t *exponent,
+                                   const int exponent_length,
+                                   gfp_operation_t multiply,
+                                   gfp_square_operation_t square,
+                                   const gfp_prime_data_t *prime_data );
+void gfp_cr_exponent(
+    gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data );
+void gfp_cr_mont_exponent(
+    gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data );
+void gfp_cr_batch_inverse( gfp_t *res, const gfp_t *to_invert, const int count, const gfp_prime_data_t *prime_data );
 
 #ifdef __cplusplus
 }
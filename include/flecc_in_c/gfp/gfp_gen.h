@@ -46,6 +46,22 @@ void gfp_gen_subtract( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_
 void gfp_gen_halving( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 void gfp_gen_negate( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 void gfp_gen_multiply_div( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_gen_multiply( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_gen_square( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
+void gfp_gen_square_repeated( gfp_t res, const gfp_t a, const int count, const gfp_prime_data_t *prime_data );
+void gfp_exponent_sliding_window( gfp_t res,
+                                  const gfp_t a,
+                                  const uint_t *exponent,
+                                  const int exponent_length,
+                                  gfp_operation_t multiply,
+                                  gfp_square_operation_t square,
+                                  const gfp_prime_data_t *prime_data );
+void gfp_gen_exponent(
+    gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data );
+void gfp_gen_inverse( gfp_t res, const gfp_t to_invert, const gfp_prime_data_t *prime_data );
+void gfp_batch_inverse( gfp_t *res, const gfp_t *to_invert, const int count, const gfp_prime_data_t *prime_data );
+void gfp_gen_inverse_fermat( gfp_t res, const gfp_t to_invert, const gfp_prime_data_t *prime_data );
+int gfp_gen_sqrt( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 void gfp_reduce( gfp_t a, const gfp_prime_data_t *prime_data );
 void gfp_binary_euclidean_inverse( gfp_t result, const gfp_t to_invert, const gfp_prime_data_t *prime_data );
 
@@ -40,6 +40,7 @@
 
 #include "../types.h"
 #include "gfp_const_runtime.h"
+#include "gfp_safegcd.h"
 
 void gfp_normal_to_montgomery( gfp_t res, const gfp_t src, const gfp_prime_data_t *prime_data );
 void gfp_montgomery_to_normal( gfp_t res, const gfp_t src, const gfp_prime_data_t *prime_data );
@@ -48,6 +49,7 @@ void gfp_mont_compute_R( gfp_t res, gfp_prime_data_t *prime_data );
 void gfp_mont_compute_R_squared( gfp_t res, gfp_prime_data_t *prime_data );
 uint_t gfp_mont_compute_n0( gfp_prime_data_t *prime_data );
 void gfp_mont_multiply_sos( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_mont_square_sos( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 void gfp_mont_inverse_binary( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 void gfp_mont_exponent(
     gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data );
@@ -55,7 +57,15 @@ void gfp_mont_inverse_fermat( gfp_t res, const gfp_t to_invert, const gfp_prime_
 
 void gfp_mult_two_mont( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
 
-#define gfp_mont_inverse( res, a, prime_data ) gfp_mont_inverse_binary( res, a, prime_data )
+#define gfp_mont_inverse( res, a, prime_data ) gfp_cr_mont_inverse_safegcd( res, a, prime_data )
+/* Montgomery multiplication variant, selected via the cmake option GFP_MONT_MULTIPLY (see config.h) */
+#if defined( GFP_MONT_MULTIPLY_CIOS )
+#define gfp_mont_multiply( res, a, b, prime_data ) gfp_cr_mont_multiply_cios( res, a, b, prime_data )
+#elif defined( GFP_MONT_MULTIPLY_COMBA )
+#define gfp_mont_multiply( res, a, b, prime_data ) gfp_cr_mont_multiply_comba( res, a, b, prime_data )
+#else
 #define gfp_mont_multiply( res, a, b, prime_data ) gfp_cr_mont_multiply_sos( res, a, b, prime_data )
+#endif
+#define gfp_mont_square( res, a, prime_data ) gfp_cr_mont_square_sos( res, a, prime_data )
 
 #endif /* GFP_MONT_H_ */
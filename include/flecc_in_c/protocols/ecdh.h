@@ -45,5 +45,9 @@ void ecdh_phase_two( eccp_point_affine_t *res,
                      const gfp_t scalar,
                      const eccp_point_affine_t *other_party_point,
                      const eccp_parameters_t *param );
+int ecdh_compute_shared_x( uint8_t *shared_x,
+                           const gfp_t scalar,
+                           const eccp_point_affine_t *other_party_point,
+                           const eccp_parameters_t *param );
 
 #endif /* ECDH_H_ */
@@ -49,6 +49,23 @@ int ecdsa_is_valid( const ecdsa_signature_t *signature,
                     const eccp_point_affine_t *public_key,
                     const eccp_parameters_t *param );
 
+/** the maximum number of signatures ecdsa_batch_is_valid checks with a single equation,
+ * the search for the unknown signs of the R points takes 2^(ECDSA_BATCH_SIZE-1) additions
+ * (ECDSA_BATCH_SIZE + 1 must not exceed JCB_INTERLEAVED_MAX_POINTS) */
+#define ECDSA_BATCH_SIZE 7
+
+/** the length of the weights of ecdsa_batch_is_valid in bits (a multiple of 8, at most 256),
+ * the weights are derived from the batch, so forging two invalid signatures that cancel out
+ * takes about 2^(ECDSA_BATCH_WEIGHT_BITS-1) hash evaluations (at least 128 for the security level of the curves) */
+#define ECDSA_BATCH_WEIGHT_BITS 128
+
+int ecdsa_batch_is_valid( uint8_t *valid,
+                          const ecdsa_signature_t signatures[],
+                          const gfp_t hashes[],
+                          const eccp_point_affine_t public_keys[],
+                          const int count,
+                          const eccp_parameters_t *param );
+
 void ecdsa_hash_to_gfp( gfp_t element, const uint8_t *hash, const int hash_length, const gfp_prime_data_t *prime );
 
 #endif /* ECDSA_H_ */
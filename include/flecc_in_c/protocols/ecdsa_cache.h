@@ -0,0 +1,100 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#ifndef ECDSA_CACHE_H
+#define ECDSA_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../eccp/eccp_jacobian.h"
+#include "../types.h"
+#include "flecc_in_c/config.h" // generated by the build system, sets ECDSA_CACHE_SIZE and ECDSA_CACHE_COMB_WIDTH
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#define ECDSA_CACHE_PTHREAD
+#include <pthread.h>
+#endif
+
+/** A validated public key with the comb table of its point (in the representation of the curve parameters). */
+typedef struct {
+    /** the public key as passed to ecdsa_is_valid_cached (not in Montgomery domain) */
+    eccp_point_affine_t public_key;
+    /** the comb table of the public key */
+    eccp_point_affine_t table[JCB_COMB_TBL_SIZE( ECDSA_CACHE_COMB_WIDTH )];
+    /** the value of ecdsa_cache_t.clock at the last use */
+    unsigned long last_use;
+    /** the number of verifications that currently use the table */
+    unsigned users;
+    /** 1 if the table is complete */
+    uint8_t valid;
+} ecdsa_prepared_key_t;
+
+/** Bounded cache of prepared public keys for ecdsa_is_valid_cached, the least recently used key is replaced. */
+typedef struct {
+    /** the comb table of the base point */
+    eccp_point_affine_t base_point_table[JCB_COMB_TBL_SIZE( ECDSA_CACHE_COMB_WIDTH )];
+    /** the prepared public keys */
+    ecdsa_prepared_key_t keys[ECDSA_CACHE_SIZE];
+    /** counts the lookups, used for the LRU replacement */
+    unsigned long clock;
+    /** the number of verifications with a cached public key */
+    unsigned long hits;
+    /** the number of verifications without a cached public key */
+    unsigned long misses;
+#ifdef ECDSA_CACHE_PTHREAD
+    /** protects all fields except the tables of keys in use */
+    pthread_mutex_t lock;
+#endif
+} ecdsa_cache_t;
+
+void ecdsa_cache_init( ecdsa_cache_t *cache, const eccp_parameters_t *param );
+void ecdsa_cache_destroy( ecdsa_cache_t *cache );
+void ecdsa_cache_get_statistics( ecdsa_cache_t *cache, unsigned long *hits, unsigned long *misses );
+int ecdsa_is_valid_cached( ecdsa_cache_t *cache,
+                           const ecdsa_signature_t *signature,
+                           const gfp_t hash_of_message,
+                           const eccp_point_affine_t *public_key,
+                           const eccp_parameters_t *param );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECDSA_CACHE_H */
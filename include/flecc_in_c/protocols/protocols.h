@@ -40,6 +40,7 @@
 
 #include "ecdh.h"
 #include "ecdsa.h"
+#include "ecdsa_cache.h"
 #include "eckeygen.h"
 
 #endif /* PROTOCOLS_H_ */
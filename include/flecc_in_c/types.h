@@ -38,25 +38,48 @@
 #ifndef TYPES_H_
 #define TYPES_H_
 
+#include "flecc_in_c/config.h" // generated by the build system, sets BYTES_PER_WORD
 #include <stdint.h>
 
+#if BYTES_PER_WORD == 4
+
 typedef uint32_t uint_t;
 typedef uint64_t ulong_t;
 typedef int64_t slong_t;
 #define UINT_T_MAX 0xFFFFFFFF
 
-/** The number of bytes represented by a word. */
-#define BYTES_PER_WORD 4
-
-/** The number of bits represented by a word. */
-#define BITS_PER_WORD ( BYTES_PER_WORD << 3 )
-
 /** binary logarithm of BITS_PER_WORD*/
 #define LD_BITS_PER_WORD 5
 
 /** binary logarithm of BYTES_PER_WORD*/
 #define LD_BYTES_PER_WORD 2
 
+/** builds the array initializer of a big integer from two 32-bit halves (least significant first) */
+#define UINT_T_FROM_U32( lo, hi ) lo, hi
+
+#elif BYTES_PER_WORD == 8
+
+typedef uint64_t uint_t;
+__extension__ typedef unsigned __int128 ulong_t;
+__extension__ typedef __int128 slong_t;
+#define UINT_T_MAX 0xFFFFFFFFFFFFFFFF
+
+/** binary logarithm of BITS_PER_WORD*/
+#define LD_BITS_PER_WORD 6
+
+/** binary logarithm of BYTES_PER_WORD*/
+#define LD_BYTES_PER_WORD 3
+
+/** builds the array initializer of a big integer from two 32-bit halves (least significant first) */
+#define UINT_T_FROM_U32( lo, hi ) ( ( (uint_t)( hi ) << 32 ) | (uint_t)( lo ) )
+
+#else
+#error "BYTES_PER_WORD has to be either 4 or 8"
+#endif
+
+/** The number of bits represented by a word. */
+#define BITS_PER_WORD ( BYTES_PER_WORD << 3 )
+
 /** returns the number of words needed to store the defined number of bits */
 #define WORDS_PER_BITS( bits ) ( ( ( bits - 1 ) >> LD_BITS_PER_WORD ) + 1 )
 
@@ -78,11 +101,40 @@ typedef int64_t slong_t;
 /** Represent a number in GF(p) - same as bigint_t */
 typedef uint_t gfp_t[WORDS_PER_GFP];
 
+/** Set of parameters needed for general GF(p) operations. */
+struct _gfp_prime_data_t_;
+
+/** typedef of function pointer to a fast reduction of a double sized product (used in gfp_prime_data_t) */
+typedef void ( *gfp_reduction_t )( uint_t *, const uint_t *, const struct _gfp_prime_data_t_ * );
+
+/** one step of an addition chain: temp[dst] = temp[src]^(2^squarings) * temp[multiplier] */
+typedef struct {
+    /** index of the temporary that receives the result */
+    uint8_t dst;
+    /** index of the temporary that gets squared */
+    uint8_t src;
+    /** index of the temporary to multiply with (GFP_CHAIN_NONE for none) */
+    uint8_t multiplier;
+    /** the number of squarings of temp[src] */
+    uint16_t squarings;
+} gfp_chain_step_t;
+
+/** Addition chain for a fixed exponent, temp[0] holds the base at the start
+ * and the destination of the last step holds the result. */
+typedef struct {
+    /** the steps of the chain */
+    const gfp_chain_step_t *steps;
+    /** the number of steps */
+    uint16_t length;
+    /** the number of temporaries needed */
+    uint8_t temps;
+} gfp_chain_t;
+
 /** Set of parameters needed for general GF(p) operations.
  *  Includes a set of parameters needed for Montgomery GF(p) multiplications.
  *  R is assumed to be (1 << (words * BITS_PER_WORD)).
  */
-typedef struct {
+typedef struct _gfp_prime_data_t_ {
     /** the prime number used for reduction */
     gfp_t prime;
     /** the number of bits needed to represent the prime */
@@ -96,8 +148,16 @@ typedef struct {
     uint_t n0;
     /** R^2 to be used for Montgomery conversion */
     gfp_t r_squared;
-    /** 1*R equals one */
+    /** 1*R equals one (or 1 if a fast reduction is used) */
     gfp_t gfp_one;
+    /** reduction of a double sized product for special primes, the elements are
+     * not in Montgomery domain if set (NULL if Montgomery multiplication is used) */
+    gfp_reduction_t reduction;
+    /** addition chain computing a^(prime-2) (NULL if not available) */
+    const gfp_chain_t *inverse_chain;
+    /** addition chain of the square root exponent (prime+1)/4, or (q-1)/2 with
+     * prime-1 = 2^s*q for Tonelli-Shanks if prime = 1 mod 4 (NULL if not available) */
+    const gfp_chain_t *sqrt_chain;
 } gfp_prime_data_t;
 
 /** Elliptic curve point in affine coordinates. */
@@ -121,6 +181,9 @@ typedef enum { UNKNOWN = 0, SECP192R1, SECP224R1, SECP256R1, SECP384R1, SECP521R
 /** function point to a gfp operation (TODO: integrate into eccp_parameters_t) */
 typedef void ( *gfp_operation_t )( gfp_t, const gfp_t, const gfp_t, const gfp_prime_data_t * );
 
+/** function point to a gfp squaring */
+typedef void ( *gfp_square_operation_t )( gfp_t, const gfp_t, const gfp_prime_data_t * );
+
 /** Parameters needed to do elliptic curve computations. */
 struct _eccp_parameters_t_;
 
@@ -146,14 +209,17 @@ typedef struct _eccp_parameters_t_ {
     gfp_t param_a;
     /** parameter b of the used elliptic curve y^2=x^3+ax+b */
     gfp_t param_b;
+    /** 1 if param_a equals -3 (mod prime), enables the cheaper doubling formulas */
+    uint8_t param_a_is_minus_three;
     /** the standardized base point */
     eccp_point_affine_t base_point;
     /** specifies the used elliptic curve */
     curve_type_t curve_type;
     /** generic scalar multiplication to be used for protocols */
     eccp_mul_t eccp_mul;
-    /** pointer to a table with precomputed multiples of the base_point to be used by eccp_mul_base_point */
-    eccp_point_affine_t *base_point_precomputed_table;
+    /** pointer to a table with precomputed multiples of the base_point to be used by eccp_mul_base_point
+     * (set by the pre-computation functions, which fill the writable table they are given) */
+    const eccp_point_affine_t *base_point_precomputed_table;
     /** the comb parameter that influences the size of the comb table */
     uint_t base_point_precomputed_table_width;
     /** optimized scalar multiplication of the base point (uses base_point_tbl) */
@@ -45,7 +45,13 @@ extern "C" {
 #include "../types.h"
 
 void performance_test_eccp_mul( eccp_parameters_t *param );
+void performance_test_eccp_mul_base_point( eccp_parameters_t *param );
+void performance_test_eccp_table_select( eccp_parameters_t *param, const int size, const int constant_time );
+void performance_test_ecdh( eccp_parameters_t *param, const int x_only );
+void performance_test_ecdsa_verify( eccp_parameters_t *param );
+void performance_test_ecdsa_verify_cached( eccp_parameters_t *param );
 void performance_test_gfp_mul( eccp_parameters_t *param );
+void performance_test_gfp_operation( eccp_parameters_t *param, gfp_operation_t operation );
 
 #ifdef __cplusplus
 }
@@ -40,6 +40,10 @@
 
 #include <assert.h>
 
+#if defined( __AVX2__ ) || defined( __SSE2__ )
+#include <immintrin.h>
+#endif
+
 void bigint_cr_switch( uint_t *var1, uint_t *var2, const int condition, const int length ) {
     assert( length > 0 );
     assert( condition == 0 || condition == 1 );
@@ -68,6 +72,35 @@ void bigint_cr_select_2( uint_t *result, const uint_t *var0, const uint_t *var1,
     }
 }
 
+void bigint_cr_conditional_copy( uint_t *result, const uint_t *var, const int condition, const int length ) {
+    assert( length > 0 );
+    assert( condition == 0 || condition == 1 );
+
+    uint_t M1 = -condition;
+    uint_t M0 = ~M1;
+    int i = 0;
+
+#if defined( __AVX2__ )
+    const __m256i mask256 = _mm256_set1_epi32( -condition );
+    for( ; i + (int)( sizeof( __m256i ) / sizeof( uint_t ) ) <= length; i += sizeof( __m256i ) / sizeof( uint_t ) ) {
+        __m256i R = _mm256_loadu_si256( (const __m256i *)&result[i] );
+        __m256i V = _mm256_loadu_si256( (const __m256i *)&var[i] );
+        _mm256_storeu_si256( (__m256i *)&result[i], _mm256_or_si256( _mm256_andnot_si256( mask256, R ), _mm256_and_si256( mask256, V ) ) );
+    }
+#endif
+#if defined( __SSE2__ )
+    const __m128i mask128 = _mm_set1_epi32( -condition );
+    for( ; i + (int)( sizeof( __m128i ) / sizeof( uint_t ) ) <= length; i += sizeof( __m128i ) / sizeof( uint_t ) ) {
+        __m128i R = _mm_loadu_si128( (const __m128i *)&result[i] );
+        __m128i V = _mm_loadu_si128( (const __m128i *)&var[i] );
+        _mm_storeu_si128( (__m128i *)&result[i], _mm_or_si128( _mm_andnot_si128( mask128, R ), _mm_and_si128( mask128, V ) ) );
+    }
+#endif
+    for( ; i < length; i++ ) {
+        result[i] = ( result[i] & M0 ) | ( var[i] & M1 );
+    }
+}
+
 int bigint_cr_is_equal_var( const uint_t *a, const uint_t *b, const int length ) {
     assert( length > 0 );
 
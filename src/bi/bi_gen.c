@@ -249,6 +249,47 @@ void bigint_multiply_var( uint_t *res, const uint_t *a, const uint_t *b, const i
     }
 }
 
+void bigint_square_var( uint_t *res, const uint_t *a, const int length ) {
+    assert( length > 0 );
+
+    uint_t carry, temp;
+    ulong_t product;
+
+    // off-diagonal products a[i]*a[j] with i < j
+    bigint_clear_var( res, length );
+    for( int i = 0; i < length; i++ ) {
+        carry = 0;
+        for( int j = i + 1; j < length; j++ ) {
+            product = res[i + j];
+            product += (ulong_t)a[i] * (ulong_t)a[j];
+            product += carry;
+            res[i + j] = ( product & UINT_T_MAX );
+            carry = product >> BITS_PER_WORD;
+        }
+        res[i + length] = carry;
+    }
+
+    // double the off-diagonal products
+    carry = 0;
+    for( int i = 0; i < 2 * length; i++ ) {
+        temp = res[i];
+        res[i] = ( temp << 1 ) | carry;
+        carry = temp >> ( BITS_PER_WORD - 1 );
+    }
+
+    // add the diagonal products a[i]*a[i]
+    carry = 0;
+    for( int i = 0; i < length; i++ ) {
+        product = (ulong_t)a[i] * (ulong_t)a[i];
+        product += res[2 * i];
+        product += carry;
+        res[2 * i] = ( product & UINT_T_MAX );
+        product = ( product >> BITS_PER_WORD ) + res[2 * i + 1];
+        res[2 * i + 1] = ( product & UINT_T_MAX );
+        carry = product >> BITS_PER_WORD;
+    }
+}
+
 void bigint_copy_var( uint_t *res, const uint_t *a, const int length ) {
     assert( length > 0 );
 
@@ -329,8 +370,8 @@ void bigint_set_bit_var( uint_t *a, const int bit, const int value, const int le
     int iBit = bit & ( BITS_PER_WORD - 1 );
 
     uint_t word = a[iWord];
-    word &= ~( 1 << iBit );
-    word |= value << iBit;
+    word &= ~( ( (uint_t)1 ) << iBit );
+    word |= ( (uint_t)value ) << iBit;
     a[iWord] = word;
 }
 
@@ -384,8 +425,8 @@ void bigint_set_byte_var( uint_t *a, const int length, const int index, const ui
     int byteIndex = index & ( BYTES_PER_WORD - 1 );
 
     uint_t word = a[wordIndex];
-    word &= ~( 0xFF << ( byteIndex * 8 ) );
-    word |= value << ( byteIndex * 8 );
+    word &= ~( ( (uint_t)0xFF ) << ( byteIndex * 8 ) );
+    word |= ( (uint_t)value ) << ( byteIndex * 8 );
     a[wordIndex] = word;
 }
 
@@ -438,7 +479,7 @@ int bigint_hamming_weight_var( const uint_t *var, const int length ) {
     for( int word = 0; word < length; word++ ) {
         uint_t temp = var[word];
         for( int bit = 0; bit < BITS_PER_WORD; bit++ ) {
-            if( ( temp & ( 1 << bit ) ) > 0 ) {
+            if( ( temp & ( ( (uint_t)1 ) << bit ) ) > 0 ) {
                 counter++;
             }
         }
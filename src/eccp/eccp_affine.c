@@ -38,6 +38,8 @@
 #include "flecc_in_c/eccp/eccp_affine.h"
 #include "flecc_in_c/gfp/gfp.h"
 
+#include <assert.h>
+
 /**
  * Tests if the given affine point fulfills the elliptic curve equation.
  * (Does not perform a cofactor multiplication to check the order of the given
@@ -73,6 +75,64 @@ int eccp_affine_point_is_valid( const eccp_point_affine_t *A, const eccp_paramet
     return gfp_is_equal( left, right );
 }
 
+/**
+ * Selects table[index] IN CONSTANT TIME by copying every entry of the table
+ * with a mask (see bigint_cr_conditional_copy), so neither the control flow nor
+ * the memory access pattern depends on the index.
+ * @param res the selected point (must not be part of the table)
+ * @param table the table to select from
+ * @param count the number of entries of the table
+ * @param index the index of the entry to select (secret, smaller than count)
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_table_select_ct( eccp_point_affine_t *res,
+                                  const eccp_point_affine_t *table,
+                                  const int count,
+                                  const uint_t index,
+                                  const eccp_parameters_t *param ) {
+    uint_t difference;
+    uint8_t identity = 0;
+    int i;
+
+    gfp_clear( res->x );
+    gfp_clear( res->y );
+    for( i = 0; i < count; i++ ) {
+        // 1 if i equals index, 0 otherwise
+        difference = (uint_t)i ^ index;
+        difference = 1 ^ ( ( difference | ( 0 - difference ) ) >> ( BITS_PER_WORD - 1 ) );
+        bigint_cr_conditional_copy( res->x, table[i].x, (int)difference, param->prime_data.words );
+        bigint_cr_conditional_copy( res->y, table[i].y, (int)difference, param->prime_data.words );
+        identity |= table[i].identity & (uint8_t)( 0 - difference );
+    }
+    res->identity = identity;
+}
+
+/**
+ * Computes one of the two affine points with the given x coordinate by
+ * computing a square root of x^3 + a*x + b (the other point is its negation).
+ * @param res the resulting point
+ * @param x the x coordinate (smaller than the prime)
+ * @param param elliptic curve parameters
+ * @return 1 if such a point exists, otherwise 0
+ */
+int eccp_affine_point_decompress( eccp_point_affine_t *res, const gfp_t x, const eccp_parameters_t *param ) {
+    gfp_t temp, right;
+
+    gfp_square( temp, x );
+    gfp_multiply( right, x, temp );          /* x^3 */
+    gfp_multiply( temp, x, param->param_a ); /* a*x */
+    gfp_add( right, right, temp );           /* x^3 + a*x */
+    gfp_add( right, right, param->param_b ); /* x^3 + a*x + b */
+
+    if( gfp_sqrt( res->y, right ) == 0 ) {
+        res->identity = 1;
+        return 0;
+    }
+    gfp_copy( res->x, x );
+    res->identity = 0;
+    return 1;
+}
+
 /**
  *  Compares the two given points for equality. (identity is smaller, then compare x and y coordinates)
  *  @param A
@@ -157,6 +217,56 @@ void eccp_affine_point_add( eccp_point_affine_t *res,
     res->identity = 0;
 }
 
+/**
+ * Adds count pairs of affine points res[i] = A[i] + B[i] sharing a single
+ * inversion (see gfp_batch_inverse). Handles the case of res[i]=A[i] and
+ * res[i]=B[i], the special cases of eccp_affine_point_add are handled separately.
+ * @param res pointers to the resulting points
+ * @param A pointers to the first summands
+ * @param B pointers to the second summands
+ * @param count the number of additions (at most ECCP_AFFINE_BATCH_SIZE)
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_point_add_batch( eccp_point_affine_t *res[],
+                                  const eccp_point_affine_t *A[],
+                                  const eccp_point_affine_t *B[],
+                                  const int count,
+                                  const eccp_parameters_t *param ) {
+    gfp_t denominator[ECCP_AFFINE_BATCH_SIZE];
+    gfp_t inverse[ECCP_AFFINE_BATCH_SIZE];
+    gfp_t lambda, temp1, temp2;
+    int i;
+
+    assert( count <= ECCP_AFFINE_BATCH_SIZE );
+
+    // zero denominators mark the special cases
+    for( i = 0; i < count; i++ ) {
+        if( A[i]->identity == 1 || B[i]->identity == 1 ) {
+            gfp_clear( denominator[i] );
+        } else {
+            gfp_subtract( denominator[i], B[i]->x, A[i]->x );
+        }
+    }
+    gfp_batch_inverse( inverse, (const gfp_t *)denominator, count, &param->prime_data );
+
+    for( i = 0; i < count; i++ ) {
+        if( gfp_is_zero( denominator[i] ) ) {
+            eccp_affine_point_add( res[i], A[i], B[i], param );
+            continue;
+        }
+        gfp_subtract( temp2, B[i]->y, A[i]->y );
+        gfp_multiply( lambda, inverse[i], temp2 ); // (y2-y1) / (x2-x1)
+        gfp_square( temp1, lambda );
+        gfp_subtract( temp1, temp1, A[i]->x );
+        gfp_subtract( temp1, temp1, B[i]->x ); // L^2 - x1 - x2
+        gfp_subtract( temp2, A[i]->x, temp1 ); // (x1 - x3)
+        gfp_multiply( lambda, temp2, lambda );
+        gfp_subtract( res[i]->y, lambda, A[i]->y ); // L*(x1-x3)-y1
+        gfp_copy( res[i]->x, temp1 );
+        res[i]->identity = 0;
+    }
+}
+
 /**
  * Subtracts two affine points. Handles the case of R=A and R=B.
  * @param res res = minuend - subtrahend
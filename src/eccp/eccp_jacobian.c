@@ -41,6 +41,8 @@
 #include "flecc_in_c/gfp/gfp.h"
 #include "flecc_in_c/utils/rand.h"
 
+#include <assert.h>
+
 /**
  * Tests if the given affine point fulfills the elliptic curve equation.
  * (Does not perform a cofactor multiplication to check the order of the given
@@ -165,6 +167,59 @@ void eccp_jacobian_to_affine( eccp_point_affine_t *res, const eccp_point_project
     gfp_multiply( res->y, res->y, T1 );
 }
 
+/**
+ * Transforms count Jacobian projective points to affine points using a single
+ * inversion (see gfp_batch_inverse). Identity points (and points with z = 0)
+ * result in the identity.
+ * @param res the resulting affine points
+ * @param a   the Jacobian projective points
+ * @param count the number of points
+ * @param param elliptic curve parameters
+ */
+void eccp_jacobian_to_affine_batch( eccp_point_affine_t *res,
+                                    const eccp_point_projective_t *a,
+                                    const int count,
+                                    const eccp_parameters_t *param ) {
+    gfp_t inverse, T1, T2;
+    int i, j, last = -1;
+
+    // res[i].x = product of all z coordinates of the non-identity points a[0..i]
+    for( i = 0; i < count; i++ ) {
+        res[i].identity = ( a[i].identity == 1 ) || gfp_is_zero( a[i].z );
+        if( res[i].identity == 1 ) {
+            continue;
+        }
+        if( last < 0 ) {
+            gfp_copy( res[i].x, a[i].z );
+        } else {
+            gfp_multiply( res[i].x, res[last].x, a[i].z );
+        }
+        last = i;
+    }
+    if( last < 0 ) {
+        return;
+    }
+
+    gfp_inverse( inverse, res[last].x );
+    for( i = last; i >= 0; i = j ) {
+        // find the previous non-identity point
+        j = i - 1;
+        while( j >= 0 && res[j].identity == 1 ) {
+            j--;
+        }
+        if( j >= 0 ) {
+            gfp_multiply( T1, inverse, res[j].x );
+            gfp_multiply( inverse, inverse, a[i].z );
+        } else {
+            gfp_copy( T1, inverse );
+        }
+        gfp_square( T2, T1 );
+        gfp_multiply( res[i].x, a[i].x, T2 );
+        gfp_multiply( res[i].y, a[i].y, T2 );
+        gfp_multiply( res[i].y, res[i].y, T1 );
+    }
+}
+
 /**
  * Converts an affine point to a Jacobian projective point.
  * @param res the resulting Jacobian projective point
@@ -217,23 +272,24 @@ void eccp_jacobian_point_double( eccp_point_projective_t *res,
         return;
     }
 
-#ifdef ECC_PARAM_A_IS_MINUS_THREE
-    gfp_square( T1, a->z );
-    gfp_subtract( T2, a->x, T1 );
-    gfp_add( T1, a->x, T1 );
-    gfp_multiply( T3, T1, T2 );
-    gfp_add( T2, T3, T3 );
-    gfp_add( T2, T2, T3 );
-#else
-    gfp_square( T1, a->x );
-    gfp_square( T2, a->z );
-    gfp_square( T2, T2 );
-    gfp_multiply( T2, T2, param->param_a );
-
-    gfp_add( T2, T2, T1 );
-    gfp_add( T2, T2, T1 );
-    gfp_add( T2, T2, T1 );
-#endif
+    if( param->param_a_is_minus_three ) {
+        // 3*X^2 - 3*Z^4 = 3*(X - Z^2)*(X + Z^2)
+        gfp_square( T1, a->z );
+        gfp_subtract( T2, a->x, T1 );
+        gfp_add( T1, a->x, T1 );
+        gfp_multiply( T3, T1, T2 );
+        gfp_add( T2, T3, T3 );
+        gfp_add( T2, T2, T3 );
+    } else {
+        gfp_square( T1, a->x );
+        gfp_square( T2, a->z );
+        gfp_square( T2, T2 );
+        gfp_multiply( T2, T2, param->param_a );
+
+        gfp_add( T2, T2, T1 );
+        gfp_add( T2, T2, T1 );
+        gfp_add( T2, T2, T1 );
+    }
     gfp_add( res->y, a->y, a->y );
     gfp_multiply( T1, res->y, a->z );
     gfp_copy( res->z, T1 );
@@ -250,6 +306,71 @@ void eccp_jacobian_point_double( eccp_point_projective_t *res,
     res->identity = 0;
 }
 
+/**
+ * Doubles the given point k times in Jacobian coordinates. Keeps W = a*Z^4 and
+ * 2*Y between consecutive doublings, which saves the recomputation of a*Z^4
+ * (4M + 4S per doubling for any a) and the special case checks of
+ * eccp_jacobian_point_double (Hankerson, Menezes, Vanstone - "Guide to Elliptic
+ * Curve Cryptography", Algorithm 3.23, generalized to arbitrary a).
+ * @param res the resulting point 2^k * a (may be equal to a)
+ * @param a the point to double
+ * @param k the number of doublings
+ * @param param elliptic curve parameters
+ */
+void eccp_jacobian_point_double_repeated( eccp_point_projective_t *res,
+                                          const eccp_point_projective_t *a,
+                                          const int k,
+                                          const eccp_parameters_t *param ) {
+    gfp_t A, B, W, T;
+    int i;
+
+    if( a->identity == 1 ) {
+        res->identity = 1;
+        return;
+    }
+    eccp_jacobian_point_copy( res, a, param );
+    if( k <= 0 ) {
+        return;
+    }
+
+    // W = a*Z^4, Y = 2*Y
+    gfp_square( W, res->z );
+    gfp_square( W, W );
+    if( param->param_a_is_minus_three ) {
+        gfp_add( T, W, W );
+        gfp_add( W, T, W );
+        gfp_negate( W, W );
+    } else {
+        gfp_multiply( W, W, param->param_a );
+    }
+    gfp_add( res->y, res->y, res->y );
+
+    for( i = 0; i < k; i++ ) {
+        gfp_square( T, res->x );
+        gfp_add( A, T, T );
+        gfp_add( A, A, T );
+        gfp_add( A, A, W );               /* A = 3*X^2 + W */
+        gfp_square( T, res->y );          /* Y^2 */
+        gfp_multiply( B, res->x, T );     /* B = X*Y^2 */
+        gfp_square( res->x, A );
+        gfp_subtract( res->x, res->x, B );
+        gfp_subtract( res->x, res->x, B ); /* X = A^2 - 2*B */
+        gfp_multiply( res->z, res->z, res->y );
+        gfp_square( T, T );               /* Y^4 */
+        if( i < k - 1 ) {
+            gfp_multiply( W, W, T );
+        }
+        gfp_subtract( B, B, res->x );
+        gfp_multiply( B, A, B );
+        gfp_add( B, B, B );
+        gfp_subtract( res->y, B, T );     /* Y = 2*A*(B - X) - Y^4 */
+    }
+    gfp_halving( res->y, res->y );
+
+    // a point of order two results in Z = 0
+    res->identity = gfp_is_zero( res->z );
+}
+
 /**
  * Add two points in projective jacobian form.
  * @param res
@@ -535,6 +656,288 @@ void eccp_jacobian_point_multiply_L2R_NAF( eccp_point_affine_t *result,
     eccp_jacobian_to_affine( result, &result_projective, param );
 }
 
+/**
+ * Computes the width-w non-adjacent form of the scalar, every non-zero digit is
+ * odd and smaller than 2^(width-1) in absolute value.
+ * @param naf the resulting digits (least significant first)
+ * @param scalar the scalar to recode
+ * @param width the window width
+ * @param words the number of words of the scalar
+ * @return the number of digits
+ */
+static int eccp_jacobian_wnaf_recode( int8_t *naf, const gfp_t scalar, const int width, const int words ) {
+    uint_t k[WORDS_PER_GFP + 1], digit_word[WORDS_PER_GFP + 1];
+    int digit, length = 0;
+
+    bigint_copy_var( k, scalar, words );
+    k[words] = 0;
+    bigint_clear_var( digit_word, words + 1 );
+
+    while( !bigint_is_zero_var( k, words + 1 ) ) {
+        digit = 0;
+        if( ( k[0] & 1 ) == 1 ) {
+            // k mods 2^width
+            digit = (int)( k[0] & ( ( 1 << width ) - 1 ) );
+            if( digit >= ( 1 << ( width - 1 ) ) ) {
+                digit -= 1 << width;
+                digit_word[0] = (uint_t)( -digit );
+                bigint_add_var( k, k, digit_word, words + 1 );
+            } else {
+                digit_word[0] = (uint_t)digit;
+                bigint_subtract_var( k, k, digit_word, words + 1 );
+            }
+        }
+        naf[length++] = (int8_t)digit;
+        bigint_shift_right_one_var( k, k, words + 1 );
+    }
+    return length;
+}
+
+/**
+ * Chooses the wNAF window width that minimizes the number of additions
+ * (precomputed points + bits / (width + 1)) for the length of the group order.
+ * @param param elliptic curve parameters
+ * @return the window width
+ */
+static int eccp_jacobian_wnaf_width( const eccp_parameters_t *param ) {
+    int width = 3;
+
+    while( width < JCB_WNAF_MAX_WIDTH
+           && JCB_WNAF_TBL_SIZE( width + 1 ) + param->order_n_data.bits / ( width + 2 )
+                  < JCB_WNAF_TBL_SIZE( width ) + param->order_n_data.bits / ( width + 1 ) ) {
+        width++;
+    }
+    return width;
+}
+
+/**
+ * Performs a point scalar multiplication using the width-w NAF of the scalar.
+ * The odd multiples P, 3P, ..., (2^(width-1)-1)P are converted to affine
+ * coordinates with a single inversion and added with mixed additions.
+ * Is NOT performed in constant time, only use it for public scalars.
+ * @param result the resulting point
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param width the window width (2 to JCB_WNAF_MAX_WIDTH)
+ * @param param elliptic curve parameters
+ *
+ * Hankerson Page 100 Algorithm 3.36
+ */
+void eccp_jacobian_point_multiply_WNAF_width( eccp_point_affine_t *result,
+                                              const eccp_point_affine_t *P,
+                                              const gfp_t scalar,
+                                              const int width,
+                                              const eccp_parameters_t *param ) {
+    int8_t naf[BITS_PER_GFP + 1];
+    eccp_point_projective_t table_projective[JCB_WNAF_TBL_SIZE( JCB_WNAF_MAX_WIDTH )];
+    eccp_point_affine_t table[JCB_WNAF_TBL_SIZE( JCB_WNAF_MAX_WIDTH )];
+    eccp_point_affine_t P_double, temp;
+    eccp_point_projective_t result_projective;
+    int i, length, doublings;
+    int tbl_size = JCB_WNAF_TBL_SIZE( width );
+
+    assert( width >= 2 && width <= JCB_WNAF_MAX_WIDTH );
+
+    if( P->identity == 1 ) {
+        result->identity = 1;
+        return;
+    }
+
+    // odd multiples table[i] = (2i+1)P
+    eccp_affine_to_jacobian( &table_projective[0], P, param );
+    eccp_affine_point_double( &P_double, P, param );
+    for( i = 1; i < tbl_size; i++ ) {
+        eccp_jacobian_point_add_affine( &table_projective[i], &table_projective[i - 1], &P_double, param );
+    }
+    eccp_jacobian_to_affine_batch( table, table_projective, tbl_size, param );
+
+    length = eccp_jacobian_wnaf_recode( naf, scalar, width, param->order_n_data.words );
+    result_projective.identity = 1;
+    doublings = 0;
+    for( i = length - 1; i >= 0; i-- ) {
+        if( naf[i] == 0 ) {
+            doublings++;
+            continue;
+        }
+        eccp_jacobian_point_double_repeated( &result_projective, &result_projective, doublings, param );
+        doublings = 1;
+        if( naf[i] > 0 ) {
+            eccp_jacobian_point_add_affine( &result_projective, &result_projective, &table[naf[i] >> 1], param );
+        } else {
+            eccp_affine_point_negate( &temp, &table[( -naf[i] ) >> 1], param );
+            eccp_jacobian_point_add_affine( &result_projective, &result_projective, &temp, param );
+        }
+    }
+    eccp_jacobian_point_double_repeated( &result_projective, &result_projective, doublings - 1, param );
+
+    eccp_jacobian_to_affine( result, &result_projective, param );
+}
+
+/**
+ * Performs a point scalar multiplication using eccp_jacobian_point_multiply_WNAF_width
+ * with a window width chosen from the length of the group order.
+ * Is NOT performed in constant time, only use it for public scalars.
+ * @param result the resulting point
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ */
+void eccp_jacobian_point_multiply_WNAF( eccp_point_affine_t *result,
+                                        const eccp_point_affine_t *P,
+                                        const gfp_t scalar,
+                                        const eccp_parameters_t *param ) {
+    eccp_jacobian_point_multiply_WNAF_width( result, P, scalar, eccp_jacobian_wnaf_width( param ), param );
+}
+
+/**
+ * Computes the sum of scalars[i]*points[i] by interleaving the width-w NAFs of
+ * all scalars, so the multiplications share a single chain of doublings. The
+ * odd multiples of all points are converted to affine coordinates with a single
+ * inversion.
+ * Is NOT performed in constant time, only use it for public scalars.
+ * @param res the resulting point (not converted to affine coordinates)
+ * @param scalars the multiplicants (smaller than the group order)
+ * @param points the points to multiply
+ * @param count the number of points (at most JCB_INTERLEAVED_MAX_POINTS)
+ * @param param elliptic curve parameters
+ *
+ * Hankerson Page 111 Algorithm 3.51
+ */
+void eccp_jacobian_point_multiply_interleaved( eccp_point_projective_t *res,
+                                               const gfp_t scalars[],
+                                               const eccp_point_affine_t points[],
+                                               const int count,
+                                               const eccp_parameters_t *param ) {
+    int8_t naf[JCB_INTERLEAVED_MAX_POINTS][BITS_PER_GFP + 1];
+    eccp_point_projective_t table_projective[JCB_INTERLEAVED_MAX_POINTS * JCB_WNAF_TBL_SIZE( JCB_INTERLEAVED_MAX_WIDTH )];
+    eccp_point_affine_t table[JCB_INTERLEAVED_MAX_POINTS * JCB_WNAF_TBL_SIZE( JCB_INTERLEAVED_MAX_WIDTH )];
+    eccp_point_projective_t doubles_projective[JCB_INTERLEAVED_MAX_POINTS];
+    eccp_point_affine_t doubles[JCB_INTERLEAVED_MAX_POINTS], temp;
+    int i, j, length[JCB_INTERLEAVED_MAX_POINTS], max_length, doublings, digit;
+    int width = eccp_jacobian_wnaf_width( param );
+    int tbl_size;
+
+    assert( count <= JCB_INTERLEAVED_MAX_POINTS );
+
+    if( width > JCB_INTERLEAVED_MAX_WIDTH ) {
+        width = JCB_INTERLEAVED_MAX_WIDTH;
+    }
+    tbl_size = JCB_WNAF_TBL_SIZE( width );
+
+    res->identity = 1;
+    if( count <= 0 ) {
+        return;
+    }
+
+    // odd multiples table[j*tbl_size + i] = (2i+1)*points[j], normalized with a single inversion
+    for( j = 0; j < count; j++ ) {
+        eccp_affine_to_jacobian( &doubles_projective[j], &points[j], param );
+        eccp_jacobian_point_double( &doubles_projective[j], &doubles_projective[j], param );
+    }
+    eccp_jacobian_to_affine_batch( doubles, doubles_projective, count, param );
+    for( j = 0; j < count; j++ ) {
+        eccp_affine_to_jacobian( &table_projective[j * tbl_size], &points[j], param );
+        for( i = 1; i < tbl_size; i++ ) {
+            eccp_jacobian_point_add_affine(
+                &table_projective[j * tbl_size + i], &table_projective[j * tbl_size + i - 1], &doubles[j], param );
+        }
+    }
+    eccp_jacobian_to_affine_batch( table, table_projective, count * tbl_size, param );
+
+    max_length = 0;
+    for( j = 0; j < count; j++ ) {
+        length[j] = 0;
+        if( points[j].identity == 0 ) {
+            length[j] = eccp_jacobian_wnaf_recode( naf[j], scalars[j], width, param->order_n_data.words );
+        }
+        if( length[j] > max_length ) {
+            max_length = length[j];
+        }
+    }
+    for( j = 0; j < count; j++ ) {
+        for( i = length[j]; i < max_length; i++ ) {
+            naf[j][i] = 0;
+        }
+    }
+
+    doublings = 0;
+    for( i = max_length - 1; i >= 0; i-- ) {
+        for( j = 0; j < count; j++ ) {
+            digit = naf[j][i];
+            if( digit == 0 ) {
+                continue;
+            }
+            eccp_jacobian_point_double_repeated( res, res, doublings, param );
+            doublings = 0;
+            if( digit > 0 ) {
+                eccp_jacobian_point_add_affine( res, res, &table[j * tbl_size + ( digit >> 1 )], param );
+            } else {
+                eccp_affine_point_negate( &temp, &table[j * tbl_size + ( ( -digit ) >> 1 )], param );
+                eccp_jacobian_point_add_affine( res, res, &temp, param );
+            }
+        }
+        doublings++;
+    }
+    eccp_jacobian_point_double_repeated( res, res, doublings - 1, param );
+}
+
+/**
+ * Computes u1*P1 + u2*P2 using eccp_jacobian_point_multiply_interleaved, which
+ * needs a single final inversion instead of two separate multiplications.
+ * Is NOT performed in constant time, only use it for public scalars.
+ * @param res the resulting point
+ * @param u1 the multiplicant of P1
+ * @param P1 the first point
+ * @param u2 the multiplicant of P2
+ * @param P2 the second point
+ * @param param elliptic curve parameters
+ */
+void eccp_jacobian_double_scalar_multiply( eccp_point_affine_t *res,
+                                           const gfp_t u1,
+                                           const eccp_point_affine_t *P1,
+                                           const gfp_t u2,
+                                           const eccp_point_affine_t *P2,
+                                           const eccp_parameters_t *param ) {
+    gfp_t scalars[2];
+    eccp_point_affine_t points[2];
+    eccp_point_projective_t result_projective;
+
+    bigint_copy_var( scalars[0], u1, param->order_n_data.words );
+    bigint_copy_var( scalars[1], u2, param->order_n_data.words );
+    eccp_affine_point_copy( &points[0], P1, param );
+    eccp_affine_point_copy( &points[1], P2, param );
+
+    eccp_jacobian_point_multiply_interleaved( &result_projective, (const gfp_t *)scalars, points, 2, param );
+    eccp_jacobian_to_affine( res, &result_projective, param );
+}
+
+/**
+ * Returns the comb column of the scalar, bit j of the result is bit j*d + digit of the scalar.
+ * @param scalar the scalar
+ * @param digit the index of the column
+ * @param width the comb width
+ * @param comb_param_d the number of columns (ceil(bits / width))
+ * @param param elliptic curve parameters
+ * @return the column
+ */
+static int eccp_jacobian_comb_column( const gfp_t scalar,
+                                      const int digit,
+                                      const int width,
+                                      const int comb_param_d,
+                                      const eccp_parameters_t *param ) {
+    int j = 0, j_cnt, bit;
+
+    for( j_cnt = 0; j_cnt < width; j_cnt++ ) {
+        bit = comb_param_d * j_cnt + digit;
+        // bit can, depending on the window width, be greater than the
+        // number of bits in an big integer. We check for this case instead
+        // of requiring a special zero padding.
+        if( bit >= 0 && bit < (int)param->order_n_data.bits )
+            j |= bigint_test_bit_var( scalar, bit, param->order_n_data.words ) << j_cnt;
+    }
+    return j;
+}
+
 /**
  * Performs a point scalar multiplication with a fixed base point.
  * @param result the resulting point
@@ -545,25 +948,16 @@ void eccp_jacobian_point_multiply_L2R_NAF( eccp_point_affine_t *result,
  */
 void eccp_jacobian_point_multiply_COMB( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
     int width = param->base_point_precomputed_table_width;
-    eccp_point_affine_t *table = param->base_point_precomputed_table;
+    const eccp_point_affine_t *table = param->base_point_precomputed_table;
     eccp_point_projective_t result_projective;
-    int digit, j, j_cnt;
+    int digit, j;
     int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1; // same as ceil (bits / width)
     result_projective.identity = 1;
 
     digit = comb_param_d - 1;
     while( digit >= 0 ) {
         eccp_jacobian_point_double( &result_projective, &result_projective, param );
-        j = 0;
-        for( j_cnt = 0; j_cnt < width; j_cnt++ ) {
-            int bit = comb_param_d * j_cnt + digit;
-            // bit can, depending on the window width, be greater than the
-            // number of bits in an big integer. We check for this case instead
-            // of requiring a special zero padding.
-            if( bit >= 0 && bit < (int)param->order_n_data.bits )
-                j |= bigint_test_bit_var( scalar, bit, param->order_n_data.words ) << j_cnt;
-        }
-
+        j = eccp_jacobian_comb_column( scalar, digit, width, comb_param_d, param );
         if( j > 0 ) {
             eccp_jacobian_point_add_affine( &result_projective, &result_projective, &table[j - 1], param );
         }
@@ -574,37 +968,118 @@ void eccp_jacobian_point_multiply_COMB( eccp_point_affine_t *result, const gfp_t
 }
 
 /**
- * Initializes the pre-computation table for eccp_jacobian_point_multiply_COMB
+ * Computes u1*P1 + u2*P2 with the comb method from the comb tables of both
+ * points (see eccp_jacobian_comb_table_precompute), the multiplications share
+ * a single chain of ceil(bits / width) doublings.
+ * Is NOT performed in constant time, only use it for public scalars.
+ * @param res the resulting point
+ * @param u1 the multiplicant of P1
+ * @param table1 the comb table of P1
+ * @param u2 the multiplicant of P2
+ * @param table2 the comb table of P2
+ * @param width the comb width of both tables
+ * @param param elliptic curve parameters
+ */
+void eccp_jacobian_double_scalar_multiply_COMB( eccp_point_affine_t *res,
+                                                const gfp_t u1,
+                                                const eccp_point_affine_t *table1,
+                                                const gfp_t u2,
+                                                const eccp_point_affine_t *table2,
+                                                const int width,
+                                                const eccp_parameters_t *param ) {
+    eccp_point_projective_t result_projective;
+    int digit, j;
+    int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1; // same as ceil (bits / width)
+    result_projective.identity = 1;
+
+    for( digit = comb_param_d - 1; digit >= 0; digit-- ) {
+        eccp_jacobian_point_double( &result_projective, &result_projective, param );
+        j = eccp_jacobian_comb_column( u1, digit, width, comb_param_d, param );
+        if( j > 0 ) {
+            eccp_jacobian_point_add_affine( &result_projective, &result_projective, &table1[j - 1], param );
+        }
+        j = eccp_jacobian_comb_column( u2, digit, width, comb_param_d, param );
+        if( j > 0 ) {
+            eccp_jacobian_point_add_affine( &result_projective, &result_projective, &table2[j - 1], param );
+        }
+    }
+
+    eccp_jacobian_to_affine( res, &result_projective, param );
+}
+
+/**
+ * Computes the comb table of an arbitrary point: entry j - 1 is the sum over
+ * the bits i of j of 2^(i*d) * P.
+ * @param table the resulting table (JCB_COMB_TBL_SIZE(width) entries)
+ * @param P the point (must not be the identity)
+ * @param width the comb width
  * @param param elliptic curve parameters
  *
  * Hankerson Page 106 Algorithm 3.44
  */
-void eccp_jacobian_point_multiply_COMB_precompute( eccp_parameters_t *param ) {
-    int width = param->base_point_precomputed_table_width;
-    eccp_point_affine_t *table = param->base_point_precomputed_table;
+void eccp_jacobian_comb_table_precompute( eccp_point_affine_t *table,
+                                          const eccp_point_affine_t *P,
+                                          const int width,
+                                          const eccp_parameters_t *param ) {
     int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1; // same as ceil (bits / width)
     eccp_point_projective_t temp;
-    int i, j;
-
-    eccp_affine_to_jacobian( &temp, &param->base_point, param );
-    eccp_affine_point_copy( &table[0], &param->base_point, param );
+    eccp_point_projective_t doubles_p[JCB_COMB_BATCH_SIZE];
+    eccp_point_affine_t doubles[JCB_COMB_BATCH_SIZE];
+    eccp_point_affine_t *res[ECCP_AFFINE_BATCH_SIZE];
+    const eccp_point_affine_t *summand_a[ECCP_AFFINE_BATCH_SIZE];
+    const eccp_point_affine_t *summand_b[ECCP_AFFINE_BATCH_SIZE];
+    int i, j, k, rows, count;
+
+    eccp_affine_to_jacobian( &temp, P, param );
+    eccp_affine_point_copy( &table[0], P, param );
+
+    // compute necessary doubles, a batch of rows shares a single inversion
+    for( i = 1; i < width; i += rows ) {
+        rows = width - i < JCB_COMB_BATCH_SIZE ? width - i : JCB_COMB_BATCH_SIZE;
+        for( k = 0; k < rows; k++ ) {
+            eccp_jacobian_point_double_repeated( &temp, &temp, comb_param_d, param );
+            eccp_jacobian_point_copy( &doubles_p[k], &temp, param );
+        }
+        eccp_jacobian_to_affine_batch( doubles, doubles_p, rows, param );
+        for( k = 0; k < rows; k++ ) {
+            eccp_affine_point_copy( &table[( 1 << ( i + k ) ) - 1], &doubles[k], param );
+        }
+    }
 
-    // compute necessary doubles
+    // the additions of a row are independent and share their inversions
     for( i = 1; i < width; i++ ) {
-        for( j = 0; j < comb_param_d; j++ ) {
-            eccp_jacobian_point_double( &temp, &temp, param );
-        }
-        eccp_jacobian_to_affine( &table[( 1 << i ) - 1], &temp, param );
-        for( j = 1 << i; j < ( 1 << ( i + 1 ) ) - 1; j++ ) {
-            eccp_affine_point_add( &table[j], &table[( 1 << i ) - 1], &table[j - ( 1 << i )], param );
+        for( j = 1 << i; j < ( 1 << ( i + 1 ) ) - 1; j += count ) {
+            count = ( 1 << ( i + 1 ) ) - 1 - j;
+            count = count < ECCP_AFFINE_BATCH_SIZE ? count : ECCP_AFFINE_BATCH_SIZE;
+            for( k = 0; k < count; k++ ) {
+                res[k] = &table[j + k];
+                summand_a[k] = &table[( 1 << i ) - 1];
+                summand_b[k] = &table[j + k - ( 1 << i )];
+            }
+            eccp_affine_point_add_batch( res, summand_a, summand_b, count, param );
         }
     }
+}
+
+/**
+ * Initializes the pre-computation table for eccp_jacobian_point_multiply_COMB
+ * @param table the table to fill (JCB_COMB_TBL_SIZE(base_point_precomputed_table_width) entries),
+ * is set as param->base_point_precomputed_table
+ * @param param elliptic curve parameters
+ *
+ * Hankerson Page 106 Algorithm 3.44
+ */
+void eccp_jacobian_point_multiply_COMB_precompute( eccp_point_affine_t *table, eccp_parameters_t *param ) {
+    eccp_jacobian_comb_table_precompute( table, &param->base_point, param->base_point_precomputed_table_width, param );
+    param->base_point_precomputed_table = table;
     param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB;
 }
 
 /**
  * Performs a point scalar multiplication with a fixed base point.
  * Should be constant time. Should perform point additions width identity (except initialization).
+ * The table entries are selected with eccp_affine_table_select_ct and negated
+ * with a masked selection, so the memory access pattern does not depend on the scalar.
  * @param result the resulting point
  * @param scalar the multiplicant
  * @param param elliptic curve parameters (includes pre-computation table)
@@ -617,10 +1092,11 @@ void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const g
     int width = param->base_point_precomputed_table_width;
     int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1; // same as ceil (bits / width)
     int tbl_size = JCB_COMB_WOZ_TBL_SIZE( width );
-    eccp_point_affine_t *table = param->base_point_precomputed_table;
-    eccp_point_projective_t result_projective;
+    const eccp_point_affine_t *table = param->base_point_precomputed_table;
+    eccp_point_projective_t result_projective, corrected;
     eccp_point_affine_t temp;
-    int digit, index, j;
+    gfp_t negated_y;
+    int digit, index, j, even;
     result_projective.identity = 1;
 
     digit = comb_param_d;
@@ -628,7 +1104,8 @@ void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const g
     for( j = 0; j < width - 1; j++ ) {
         index |= bigint_test_bit_var( scalar, comb_param_d * j + digit, param->order_n_data.words ) << j;
     }
-    eccp_affine_to_jacobian( &result_projective, &table[index], param );
+    eccp_affine_table_select_ct( &temp, table, tbl_size, (uint_t)index, param );
+    eccp_affine_to_jacobian( &result_projective, &temp, param );
 
     digit--;
     while( digit > 0 ) {
@@ -644,28 +1121,34 @@ void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const g
         if( bit >= 0 && bit < (int)param->order_n_data.bits )
             to_invert = bigint_test_bit_var( scalar, bit, param->order_n_data.words );
 
-        if( !to_invert ) {
-            index = tbl_size - index - 1;
-            eccp_affine_point_negate( &temp, &table[index], param );
-        } else {
-            eccp_affine_point_copy( &temp, &table[index], param );
-        }
+        // without branches: if !to_invert, use -table[tbl_size - index - 1]
+        index ^= ( tbl_size - 1 ) & ( to_invert - 1 );
+        eccp_affine_table_select_ct( &temp, table, tbl_size, (uint_t)index, param );
+        gfp_negate( negated_y, temp.y );
+        bigint_cr_select_2( temp.y, negated_y, temp.y, to_invert, param->prime_data.words );
 
         eccp_jacobian_point_double( &result_projective, &result_projective, param );
         eccp_jacobian_point_add_affine( &result_projective, &result_projective, &temp, param );
         digit--;
     }
 
-    if( bigint_test_bit_var( scalar, 0, param->order_n_data.words ) == 0 ) {
-        eccp_affine_point_negate( &temp, &param->base_point, param );
-        eccp_jacobian_point_add_affine( &result_projective, &result_projective, &temp, param );
-    }
+    // subtract P if the scalar is even, the subtraction is always performed
+    eccp_affine_point_negate( &temp, &param->base_point, param );
+    eccp_jacobian_point_add_affine( &corrected, &result_projective, &temp, param );
+    even = 1 - bigint_test_bit_var( scalar, 0, param->order_n_data.words );
+    bigint_cr_select_2( result_projective.x, result_projective.x, corrected.x, even, param->prime_data.words );
+    bigint_cr_select_2( result_projective.y, result_projective.y, corrected.y, even, param->prime_data.words );
+    bigint_cr_select_2( result_projective.z, result_projective.z, corrected.z, even, param->prime_data.words );
+    result_projective.identity
+        = (uint8_t)( ( result_projective.identity & ( even - 1 ) ) | ( corrected.identity & ( 0 - even ) ) );
 
     eccp_jacobian_to_affine( result, &result_projective, param );
 }
 
 /**
  * Initializes the pre-computation table for eccp_jacobian_point_multiply_COMB_WOZ
+ * @param table the table to fill (JCB_COMB_WOZ_TBL_SIZE(base_point_precomputed_table_width) entries),
+ * is set as param->base_point_precomputed_table
  * @param param elliptic curve parameters
  *
  * Based on Algorithm 2 in
@@ -675,39 +1158,53 @@ void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const g
  *
  * computes (2^(d*(w-1)) +/- 2^(d*(w-2)) +/- ... +/- 2^(d) +/- 2^) * P
  */
-void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_parameters_t *param ) {
+void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_point_affine_t *table, eccp_parameters_t *param ) {
     int width = param->base_point_precomputed_table_width;
-    eccp_point_affine_t *table = param->base_point_precomputed_table;
     int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1; // same as ceil (bits / width)
     int tbl_size = JCB_COMB_WOZ_TBL_SIZE( width );
-    eccp_point_affine_t temp_a;
+    eccp_point_affine_t temp_negated;
     eccp_point_projective_t temp_p;
-    int i, j, k;
+    eccp_point_projective_t doubles_p[JCB_COMB_BATCH_SIZE];
+    eccp_point_affine_t doubles[JCB_COMB_BATCH_SIZE];
+    eccp_point_affine_t *res[ECCP_AFFINE_BATCH_SIZE];
+    const eccp_point_affine_t *summand_a[ECCP_AFFINE_BATCH_SIZE];
+    const eccp_point_affine_t *summand_b[ECCP_AFFINE_BATCH_SIZE];
+    int i, j, k, l, rows, count, add;
 
     for( j = 0; j < tbl_size; j++ ) {
         table[j].identity = 1;
     }
 
     eccp_affine_to_jacobian( &temp_p, &param->base_point, param );
-    eccp_affine_point_copy( &temp_a, &param->base_point, param );
 
-    for( i = 0; i < width - 1; i++ ) {
-        for( j = 0; j < tbl_size; j++ ) {
-            if( ( j & ( 1 << i ) ) > 0 ) {
-                eccp_affine_point_add( &table[j], &table[j], &temp_a, param );
-            } else {
-                eccp_affine_point_subtract( &table[j], &table[j], &temp_a, param );
+    for( i = 0; i < width; i += rows ) {
+        // compute a batch of doubles 2^(d*(i+l)) * P that share a single inversion
+        rows = width - i < JCB_COMB_BATCH_SIZE ? width - i : JCB_COMB_BATCH_SIZE;
+        for( l = 0; l < rows; l++ ) {
+            if( i + l > 0 ) {
+                eccp_jacobian_point_double_repeated( &temp_p, &temp_p, comb_param_d, param );
             }
+            eccp_jacobian_point_copy( &doubles_p[l], &temp_p, param );
         }
-        for( k = 0; k < comb_param_d; k++ ) {
-            eccp_jacobian_point_double( &temp_p, &temp_p, param );
+        eccp_jacobian_to_affine_batch( doubles, doubles_p, rows, param );
+
+        // the additions (subtractions) of a double to all entries are independent and share their inversions
+        for( l = 0; l < rows; l++ ) {
+            eccp_affine_point_negate( &temp_negated, &doubles[l], param );
+            for( j = 0; j < tbl_size; j += count ) {
+                count = tbl_size - j < ECCP_AFFINE_BATCH_SIZE ? tbl_size - j : ECCP_AFFINE_BATCH_SIZE;
+                for( k = 0; k < count; k++ ) {
+                    res[k] = &table[j + k];
+                    summand_a[k] = &table[j + k];
+                    // the last row is always added
+                    add = ( i + l == width - 1 ) || ( ( j + k ) & ( 1 << ( i + l ) ) ) > 0;
+                    summand_b[k] = add ? &doubles[l] : &temp_negated;
+                }
+                eccp_affine_point_add_batch( res, summand_a, summand_b, count, param );
+            }
         }
-        eccp_jacobian_to_affine( &temp_a, &temp_p, param );
-    }
-
-    for( j = 0; j < tbl_size; j++ ) {
-        eccp_affine_point_add( &table[j], &table[j], &temp_a, param );
     }
 
+    param->base_point_precomputed_table = table;
     param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB_WOZ;
 }
@@ -0,0 +1,185 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#include "flecc_in_c/eccp/eccp_multi.h"
+#include "flecc_in_c/bi/bi.h"
+#include "flecc_in_c/eccp/eccp_jacobian.h"
+
+/**
+ * Estimates the number of point additions and doublings of the Pippenger
+ * bucket method: for every window, one addition per point and two additions
+ * per bucket to sum up the buckets, plus the doublings between the windows.
+ * @param count the number of points
+ * @param bits the length of the scalars
+ * @param width the bucket window width
+ * @return the estimated number of point operations
+ */
+static long eccp_multi_pippenger_cost( const int count, const int bits, const int width ) {
+    long windows = ( bits + width - 1 ) / width;
+    return windows * ( (long)count + ( 2L << width ) + width );
+}
+
+/**
+ * Estimates the number of point additions and doublings of interleaved wNAF
+ * multiplications in groups of JCB_INTERLEAVED_MAX_POINTS points, every group
+ * needs its own chain of doublings.
+ * @param count the number of points
+ * @param bits the length of the scalars
+ * @return the estimated number of point operations
+ */
+static long eccp_multi_interleaved_cost( const int count, const int bits ) {
+    long groups = ( count + JCB_INTERLEAVED_MAX_POINTS - 1 ) / JCB_INTERLEAVED_MAX_POINTS;
+    // window width 5 (8 precomputed points) is typical for the supported curves
+    return groups * bits + (long)count * ( 8 + bits / 6 );
+}
+
+/**
+ * Extracts width bits of the scalar starting at bit offset.
+ * @param scalar the scalar
+ * @param offset the position of the least significant bit
+ * @param width the number of bits
+ * @param words the number of words of the scalar
+ * @return the extracted bits
+ */
+static int eccp_multi_get_window( const gfp_t scalar, const int offset, const int width, const int words ) {
+    int i, window = 0;
+
+    for( i = width - 1; i >= 0; i-- ) {
+        window <<= 1;
+        if( offset + i < words * BITS_PER_WORD ) {
+            window |= bigint_test_bit_var( scalar, offset + i, words );
+        }
+    }
+    return window;
+}
+
+/**
+ * Computes the sum of scalars[i]*points[i] with the bucket method of Pippenger.
+ * For every window, the points are added to the bucket selected by their
+ * window of the scalar, the buckets are converted to affine coordinates with a
+ * single inversion and summed up with running sums.
+ * Is NOT performed in constant time, only use it for public scalars.
+ * @param res the resulting point
+ * @param scalars the multiplicants (smaller than the group order)
+ * @param points the points to multiply
+ * @param count the number of points
+ * @param width the bucket window width (at most ECCP_MULTI_MAX_WINDOW)
+ * @param param elliptic curve parameters
+ */
+static void eccp_multi_pippenger( eccp_point_projective_t *res,
+                                  const gfp_t scalars[],
+                                  const eccp_point_affine_t points[],
+                                  const int count,
+                                  const int width,
+                                  const eccp_parameters_t *param ) {
+    eccp_point_projective_t buckets_projective[( 1 << ECCP_MULTI_MAX_WINDOW ) - 1];
+    eccp_point_affine_t buckets[( 1 << ECCP_MULTI_MAX_WINDOW ) - 1];
+    eccp_point_projective_t running, sum;
+    int i, j, offset, window;
+    int tbl_size = ( 1 << width ) - 1;
+    int words = param->order_n_data.words;
+
+    res->identity = 1;
+    for( offset = ( ( param->order_n_data.bits - 1 ) / width ) * width; offset >= 0; offset -= width ) {
+        eccp_jacobian_point_double_repeated( res, res, width, param );
+
+        // buckets[j] = sum of all points with window j+1
+        for( j = 0; j < tbl_size; j++ ) {
+            buckets_projective[j].identity = 1;
+        }
+        for( i = 0; i < count; i++ ) {
+            window = eccp_multi_get_window( scalars[i], offset, width, words );
+            if( window != 0 && points[i].identity == 0 ) {
+                eccp_jacobian_point_add_affine( &buckets_projective[window - 1], &buckets_projective[window - 1], &points[i], param );
+            }
+        }
+        eccp_jacobian_to_affine_batch( buckets, buckets_projective, tbl_size, param );
+
+        // sum of (j+1)*buckets[j]
+        running.identity = 1;
+        sum.identity = 1;
+        for( j = tbl_size - 1; j >= 0; j-- ) {
+            eccp_jacobian_point_add_affine( &running, &running, &buckets[j], param );
+            eccp_jacobian_point_add( &sum, &sum, &running, param );
+        }
+        eccp_jacobian_point_add( res, res, &sum, param );
+    }
+}
+
+/**
+ * Computes the multi-scalar multiplication res = sum of scalars[i]*points[i].
+ * Small counts use interleaved wNAF multiplications, large counts the bucket
+ * method of Pippenger. The window width of the bucket method is chosen from
+ * count and the length of the group order.
+ * Is NOT performed in constant time, only use it for public scalars.
+ * @param res the resulting point
+ * @param scalars the multiplicants (smaller than the group order)
+ * @param points the points to multiply
+ * @param count the number of points
+ * @param param elliptic curve parameters
+ */
+void eccp_multi_scalar_multiply( eccp_point_affine_t *res,
+                                 const gfp_t scalars[],
+                                 const eccp_point_affine_t points[],
+                                 const int count,
+                                 const eccp_parameters_t *param ) {
+    eccp_point_projective_t result_projective, temp;
+    int i, width, best_width = 2;
+    int bits = param->order_n_data.bits;
+
+    for( width = 3; width <= ECCP_MULTI_MAX_WINDOW; width++ ) {
+        if( eccp_multi_pippenger_cost( count, bits, width ) < eccp_multi_pippenger_cost( count, bits, best_width ) ) {
+            best_width = width;
+        }
+    }
+
+    if( eccp_multi_pippenger_cost( count, bits, best_width ) < eccp_multi_interleaved_cost( count, bits ) ) {
+        eccp_multi_pippenger( &result_projective, scalars, points, count, best_width, param );
+    } else {
+        result_projective.identity = 1;
+        for( i = 0; i < count; i += JCB_INTERLEAVED_MAX_POINTS ) {
+            eccp_jacobian_point_multiply_interleaved( &temp,
+                                                      &scalars[i],
+                                                      &points[i],
+                                                      count - i < JCB_INTERLEAVED_MAX_POINTS ? count - i : JCB_INTERLEAVED_MAX_POINTS,
+                                                      param );
+            eccp_jacobian_point_add( &result_projective, &result_projective, &temp, param );
+        }
+    }
+
+    eccp_jacobian_to_affine( res, &result_projective, param );
+}
@@ -81,76 +81,41 @@ int eccp_protected_std_projective_point_is_valid(
 #define AVOID_CACHE_TIMING_ATTACKS 1
 
 /**
- * Performs a point scalar multiplication based on "8/16/32 shades of ECC on embedded microprocessors"
- * @param result the resulting point (set to identity when error happens)
- * @param P The base point to multiply
+ * Montgomery ladder with common Z coordinate on the randomized projective base point (R1, R2, R3)
+ * (taken from "8/16/32 shades of ECC on embedded microprocessors")
+ * @param X1_ returns the x coordinate of scalar*P with the common Z coordinate
+ * @param X2_ returns the x coordinate of (scalar+1)*P with the common Z coordinate
+ * @param Z_ returns the common Z coordinate of X1_ and X2_
+ * @param R1 the x coordinate of the randomized base point (used as temporary)
+ * @param R2 the y coordinate of the randomized base point (used as temporary)
+ * @param R3 the z coordinate of the randomized base point (used as temporary)
+ * @param R4 temporary
+ * @param ECC_curve_b_4 returns 4*b
+ * @param P the affine base point
  * @param scalar the multiplicant
  * @param param elliptic curve parameters
  */
-void eccp_protected_point_multiply( eccp_point_affine_t *result,
-                                    const eccp_point_affine_t *P,
-                                    const gfp_t scalar,
-                                    const eccp_parameters_t *param ) {
-    gfp_t Z_, R1, R2, R3, R4, ECC_curve_b_4;
+static void eccp_protected_ladder( gfp_t X1_,
+                                   gfp_t X2_,
+                                   gfp_t Z_,
+                                   gfp_t R1,
+                                   gfp_t R2,
+                                   gfp_t R3,
+                                   gfp_t R4,
+                                   gfp_t ECC_curve_b_4,
+                                   const eccp_point_affine_t *P,
+                                   const gfp_t scalar,
+                                   const eccp_parameters_t *param ) {
     int bit, bit_is_set;
+    uint_t *X1 = X1_, *X2 = X2_;
 #if( AVOID_CACHE_TIMING_ATTACKS == 1 )
-    gfp_t X1, X2;
     int last_bit = 1;
 #else
-    gfp_t X1_, X2_;
-    uint_t *X1 = X1_, *X2 = X2_;
     uint_t *dest[2];
-    dest[0] = X1;
-    dest[1] = X2;
+    dest[0] = X1_;
+    dest[1] = X2_;
 #endif
 
-    if( P->identity == 1 ) {
-        result->identity = 1;
-        return;
-    }
-
-    if( !eccp_affine_point_is_valid( P, param ) ) {
-        /* TODO: fancier error handling? */
-        result->identity = 1;
-        return;
-    }
-
-    /* deal with the case that the scalar is larger than the group order */
-    if( bigint_compare_var( scalar, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
-        /* TODO: fancier error handling? */
-        result->identity = 1;
-        return;
-    }
-
-    /* deal with the case that the scalar is zero */
-    if( bigint_is_zero_var( scalar, param->order_n_data.words ) ) {
-        result->identity = 1;
-        return;
-    }
-
-    bigint_copy_var( R3, param->order_n_data.prime, param->order_n_data.words );
-    bigint_clear_var( R4, param->order_n_data.words );
-    R4[0] = 1;
-    bigint_subtract_var( R3, R3, R4, param->order_n_data.words );
-
-    /* deal with the case that the scalar is (order-1) */
-    if( bigint_compare_var( scalar, R3, param->order_n_data.words ) == 0 ) {
-        eccp_affine_point_negate( result, P, param );
-        return;
-    }
-
-    /* randomize projective coordinates */
-    gfp_rand( R4, &param->prime_data );
-    gfp_multiply( R1, P->x, R4 );
-    gfp_multiply( R2, P->y, R4 );
-    gfp_copy( R3, R4 );
-
-    if( !eccp_protected_std_projective_point_is_valid( R1, R2, R3, R4, X1, X2, param ) ) {
-        /* TODO: fancier error handling? */
-        result->identity = 1;
-        return;
-    }
-
     gfp_add( ECC_curve_b_4, param->param_b, param->param_b );
     gfp_add( ECC_curve_b_4, ECC_curve_b_4, ECC_curve_b_4 );
 
@@ -169,14 +134,14 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
     gfp_add( R1, X2, R2 );      /* 3*X^2 */
     gfp_square( R2, R3 );       /* Z^2 */
     gfp_multiply( Z_, R4, R2 ); /* 4*Y^2*Z^2 */
-#ifdef ECC_PARAM_A_IS_MINUS_THREE
-    gfp_subtract( R1, R1, R2 );
-    gfp_subtract( R1, R1, R2 );
-    gfp_subtract( R1, R1, R2 );
-#else
-    gfp_multiply( R3, R2, param->param_a );
-    gfp_add( R1, R1, R3 ); /* 3*X^2+a*Z^2 */
-#endif
+    if( param->param_a_is_minus_three ) {
+        gfp_subtract( R1, R1, R2 );
+        gfp_subtract( R1, R1, R2 );
+        gfp_subtract( R1, R1, R2 ); /* 3*X^2-3*Z^2 */
+    } else {
+        gfp_multiply( R3, R2, param->param_a );
+        gfp_add( R1, R1, R3 ); /* 3*X^2+a*Z^2 */
+    }
     gfp_square( X2, R1 );       /* (3*X^2+a*Z^2)^2 */
     gfp_subtract( X2, X2, X1 ); /* (3*X^2+a*Z^2)^2 - 4*X*Y^2 */
     gfp_subtract( X2, X2, X1 ); /* (3*X^2+a*Z^2)^2 - 8*X*Y^2 */
@@ -205,14 +170,14 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
         gfp_square( R3, Z_ );
         gfp_multiply( R4, Z_, R3 );
 
-#ifdef ECC_PARAM_A_IS_MINUS_THREE
-        /*gfp_multiply(R2, ECC_curve_a, R3); optimized for a=-3*/
-        gfp_subtract( R2, bigint_zero, R3 );
-        gfp_subtract( R2, R2, R3 );
-        gfp_subtract( R2, R2, R3 );
-#else
-        gfp_multiply( R2, param->param_a, R3 );
-#endif
+        if( param->param_a_is_minus_three ) {
+            /*gfp_multiply(R2, ECC_curve_a, R3); optimized for a=-3*/
+            gfp_add( R2, R3, R3 );
+            gfp_add( R2, R2, R3 );
+            gfp_negate( R2, R2 );
+        } else {
+            gfp_multiply( R2, param->param_a, R3 );
+        }
 
         gfp_add( R1, R1, R2 );
         gfp_add( X1, X1, X2 );
@@ -244,10 +209,71 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
     }
 #if( AVOID_CACHE_TIMING_ATTACKS == 1 )
     bigint_cr_switch( X1, X2, 1 ^ last_bit, param->prime_data.words );
-#else
-    X1 = dest[0];
-    X2 = dest[1];
 #endif
+    /* otherwise the results already are in dest[0] and dest[1] */
+}
+
+/**
+ * Performs a point scalar multiplication based on "8/16/32 shades of ECC on embedded microprocessors"
+ * @param result the resulting point (set to identity when error happens)
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ */
+void eccp_protected_point_multiply( eccp_point_affine_t *result,
+                                    const eccp_point_affine_t *P,
+                                    const gfp_t scalar,
+                                    const eccp_parameters_t *param ) {
+    gfp_t X1, X2, Z_, R1, R2, R3, R4, ECC_curve_b_4;
+
+    if( P->identity == 1 ) {
+        result->identity = 1;
+        return;
+    }
+
+    if( !eccp_affine_point_is_valid( P, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    /* deal with the case that the scalar is larger than the group order */
+    if( bigint_compare_var( scalar, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    /* deal with the case that the scalar is zero */
+    if( bigint_is_zero_var( scalar, param->order_n_data.words ) ) {
+        result->identity = 1;
+        return;
+    }
+
+    bigint_copy_var( R3, param->order_n_data.prime, param->order_n_data.words );
+    bigint_clear_var( R4, param->order_n_data.words );
+    R4[0] = 1;
+    bigint_subtract_var( R3, R3, R4, param->order_n_data.words );
+
+    /* deal with the case that the scalar is (order-1) */
+    if( bigint_compare_var( scalar, R3, param->order_n_data.words ) == 0 ) {
+        eccp_affine_point_negate( result, P, param );
+        return;
+    }
+
+    /* randomize projective coordinates */
+    gfp_rand( R4, &param->prime_data );
+    gfp_multiply( R1, P->x, R4 );
+    gfp_multiply( R2, P->y, R4 );
+    gfp_copy( R3, R4 );
+
+    if( !eccp_protected_std_projective_point_is_valid( R1, R2, R3, R4, X1, X2, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    eccp_protected_ladder( X1, X2, Z_, R1, R2, R3, R4, ECC_curve_b_4, P, scalar, param );
 
     /* y-recovery (taken from Hutter) */
     gfp_multiply( R1, P->x, Z_ );
@@ -257,13 +283,13 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
     gfp_multiply( R2, R1, X1 );
     gfp_add( R1, X1, R1 );
     gfp_square( X2, Z_ );
-#ifdef ECC_PARAM_A_IS_MINUS_THREE
-    gfp_add( R3, X2, X2 );
-    gfp_add( R3, R3, R3 );
-    gfp_subtract( R3, X2, R3 );
-#else
-    gfp_multiply( R3, param->param_a, X2 );
-#endif
+    if( param->param_a_is_minus_three ) {
+        gfp_add( R3, X2, X2 );
+        gfp_add( R3, R3, R3 );
+        gfp_subtract( R3, X2, R3 );
+    } else {
+        gfp_multiply( R3, param->param_a, X2 );
+    }
     gfp_add( R2, R2, R3 );
     gfp_multiply( R3, R2, R1 );
     gfp_subtract( R3, R3, R4 );
@@ -307,3 +333,302 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
         return;
     }
 }
+
+/**
+ * Computes only the x coordinate of a point scalar multiplication with the ladder of
+ * eccp_protected_point_multiply. Skips the y-recovery and the validity checks of the result,
+ * only the input point is checked.
+ * @param result_x the x coordinate of scalar*P
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ * @return 1 if successful, 0 if P is invalid or scalar*P is the point at infinity
+ */
+int eccp_protected_point_multiply_x( gfp_t result_x,
+                                     const eccp_point_affine_t *P,
+                                     const gfp_t scalar,
+                                     const eccp_parameters_t *param ) {
+    gfp_t X1, X2, Z_, R1, R2, R3, R4, ECC_curve_b_4;
+
+    if( P->identity == 1 || !eccp_affine_point_is_valid( P, param ) ) {
+        return 0;
+    }
+
+    /* deal with the case that the scalar is zero or not smaller than the group order */
+    if( bigint_is_zero_var( scalar, param->order_n_data.words ) ||
+        bigint_compare_var( scalar, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
+        return 0;
+    }
+
+    bigint_copy_var( R3, param->order_n_data.prime, param->order_n_data.words );
+    bigint_clear_var( R4, param->order_n_data.words );
+    R4[0] = 1;
+    bigint_subtract_var( R3, R3, R4, param->order_n_data.words );
+
+    /* deal with the case that the scalar is (order-1), -P has the same x coordinate */
+    if( bigint_compare_var( scalar, R3, param->order_n_data.words ) == 0 ) {
+        gfp_copy( result_x, P->x );
+        return 1;
+    }
+
+    /* randomize projective coordinates */
+    gfp_rand( R4, &param->prime_data );
+    gfp_multiply( R1, P->x, R4 );
+    gfp_multiply( R2, P->y, R4 );
+    gfp_copy( R3, R4 );
+
+    eccp_protected_ladder( X1, X2, Z_, R1, R2, R3, R4, ECC_curve_b_4, P, scalar, param );
+
+    if( gfp_is_zero( Z_ ) ) {
+        return 0;
+    }
+
+    gfp_inverse( R1, Z_ );
+    gfp_multiply( result_x, X1, R1 );
+    return 1;
+}
+
+/**
+ * Checks the given Jacobian x, y and z coordinate, if they are a valid combination
+ * (the counterpart of eccp_protected_std_projective_point_is_valid for the co-Z ladder).
+ * @param px
+ * @param py
+ * @param pz
+ * @param left  temporary
+ * @param right temporary
+ * @param temp  temporary
+ * @return 1 if valid, else 0
+ */
+static int eccp_protected_jacobian_point_is_valid(
+    const gfp_t px, const gfp_t py, const gfp_t pz, gfp_t left, gfp_t right, gfp_t temp, const eccp_parameters_t *param ) {
+
+    /* calculate the right side */
+    gfp_square( left, pz );                      /* Z^2                        */
+    gfp_square( temp, left );                    /* Z^4                        */
+    gfp_multiply( right, param->param_b, left ); /* bZ^2                       */
+    gfp_multiply( left, param->param_a, px );    /* aX                         */
+    gfp_add( right, right, left );               /* aX + bZ^2                  */
+    gfp_multiply( right, right, temp );          /* aXZ^4 + bZ^6               */
+    gfp_square( left, px );                      /* X^2                        */
+    gfp_multiply( temp, left, px );              /* X^3                        */
+    gfp_add( right, right, temp );               /* X^3 + aXZ^4 + bZ^6         */
+
+    /* calculate the left side */
+    gfp_square( left, py );
+
+    /* check if Y^2 == X^3 + a*X*Z^4 + b*Z^6 */
+    return gfp_is_equal( left, right );
+}
+
+/**
+ * Co-Z addition with update (XYCZ-ADD): computes Q = P + Q and updates P to
+ * the new common Z coordinate. Both points share the same (implicit) Z.
+ * @param xp x coordinate of P (updated)
+ * @param yp y coordinate of P (updated)
+ * @param xq x coordinate of Q (replaced by P + Q)
+ * @param yq y coordinate of Q (replaced by P + Q)
+ * @param param elliptic curve parameters
+ */
+static void eccp_protected_coz_add( gfp_t xp, gfp_t yp, gfp_t xq, gfp_t yq, const eccp_parameters_t *param ) {
+    gfp_t T1, T2, T3, T4;
+
+    gfp_subtract( T1, xq, xp );
+    gfp_square( T1, T1 );        /* A = (X2-X1)^2 */
+    gfp_multiply( T2, xq, T1 );  /* C = X2*A */
+    gfp_multiply( xp, xp, T1 );  /* B = X1*A */
+    gfp_subtract( T3, yq, yp );  /* Y2-Y1 */
+    gfp_square( T4, T3 );        /* D = (Y2-Y1)^2 */
+    gfp_subtract( T4, T4, xp );
+    gfp_subtract( T4, T4, T2 );  /* X3 = D-B-C */
+    gfp_subtract( T2, T2, xp );  /* C-B */
+    gfp_multiply( yp, yp, T2 );  /* E = Y1*(C-B) */
+    gfp_subtract( T2, xp, T4 );  /* B-X3 */
+    gfp_multiply( T2, T3, T2 );  /* (Y2-Y1)*(B-X3) */
+    gfp_subtract( yq, T2, yp );  /* Y3 = (Y2-Y1)*(B-X3)-E */
+    gfp_copy( xq, T4 );
+}
+
+/**
+ * Conjugate co-Z addition (XYCZ-ADDC): computes Q = P + Q and P = P - Q with
+ * a new common Z coordinate. Both points share the same (implicit) Z.
+ * @param xp x coordinate of P (replaced by P - Q)
+ * @param yp y coordinate of P (replaced by P - Q)
+ * @param xq x coordinate of Q (replaced by P + Q)
+ * @param yq y coordinate of Q (replaced by P + Q)
+ * @param param elliptic curve parameters
+ */
+static void eccp_protected_coz_add_conjugate( gfp_t xp, gfp_t yp, gfp_t xq, gfp_t yq, const eccp_parameters_t *param ) {
+    gfp_t T1, T2, T3, T4, T5, T6;
+
+    gfp_subtract( T1, xq, xp );
+    gfp_square( T1, T1 );        /* A = (X2-X1)^2 */
+    gfp_multiply( T2, xq, T1 );  /* C = X2*A */
+    gfp_multiply( T1, xp, T1 );  /* B = X1*A */
+    gfp_subtract( T3, yq, yp );  /* Y2-Y1 */
+    gfp_add( T4, yq, yp );       /* Y2+Y1 */
+    gfp_subtract( T5, T2, T1 );  /* C-B */
+    gfp_multiply( T5, yp, T5 );  /* E = Y1*(C-B) */
+    gfp_add( T2, T1, T2 );       /* B+C */
+    gfp_square( T6, T3 );
+    gfp_subtract( T6, T6, T2 );  /* X3 = (Y2-Y1)^2-B-C */
+    gfp_subtract( yq, T1, T6 );
+    gfp_multiply( yq, T3, yq );
+    gfp_subtract( yq, yq, T5 );  /* Y3 = (Y2-Y1)*(B-X3)-E */
+    gfp_square( xp, T4 );
+    gfp_subtract( xp, xp, T2 );  /* X3' = (Y2+Y1)^2-B-C */
+    gfp_subtract( yp, xp, T1 );
+    gfp_multiply( yp, T4, yp );
+    gfp_subtract( yp, yp, T5 );  /* Y3' = (Y2+Y1)*(X3'-B)-E */
+    gfp_copy( xq, T6 );
+}
+
+/**
+ * Performs a point scalar multiplication with the (X,Y)-only co-Z Montgomery ladder
+ * (Algorithm 9 of Goundar, Joye, Miyaji - "Co-Z Addition Formulae and Binary Ladders
+ * on Elliptic Curves"). Uses the same input checks, the same constant-time point switching
+ * and a randomized Z coordinate like eccp_protected_point_multiply. Like the check of the
+ * randomized base point there, both randomized starting points P and 2P are verified to
+ * lie on the curve before the ladder starts.
+ * @param result the resulting point (set to identity when error happens)
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ */
+void eccp_protected_point_multiply_coz( eccp_point_affine_t *result,
+                                        const eccp_point_affine_t *P,
+                                        const gfp_t scalar,
+                                        const eccp_parameters_t *param ) {
+    gfp_t X0, Y0, X1, Y1, px, py, R1, R2, R3, R4;
+    int bit, bit_is_set, last_bit = 1;
+
+    if( P->identity == 1 ) {
+        result->identity = 1;
+        return;
+    }
+
+    if( !eccp_affine_point_is_valid( P, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    /* deal with the case that the scalar is larger than the group order */
+    if( bigint_compare_var( scalar, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    /* deal with the case that the scalar is zero */
+    if( bigint_is_zero_var( scalar, param->order_n_data.words ) ) {
+        result->identity = 1;
+        return;
+    }
+
+    /* the ladder neither handles the scalar one nor (order-1) */
+    bigint_copy_var( R1, param->order_n_data.prime, param->order_n_data.words );
+    bigint_clear_var( R2, param->order_n_data.words );
+    R2[0] = 1;
+    if( bigint_compare_var( scalar, R2, param->order_n_data.words ) == 0 ) {
+        eccp_affine_point_copy( result, P, param );
+        return;
+    }
+    bigint_subtract_var( R1, R1, R2, param->order_n_data.words );
+    if( bigint_compare_var( scalar, R1, param->order_n_data.words ) == 0 ) {
+        eccp_affine_point_negate( result, P, param );
+        return;
+    }
+
+    /* result may equal P */
+    gfp_copy( px, P->x );
+    gfp_copy( py, P->y );
+
+    /* XYCZ-IDBL: R1 = 2P and R0 = P with the common Z = 2*y */
+    gfp_square( R1, py );       /* y^2 */
+    gfp_add( R1, R1, R1 );      /* 2*y^2 */
+    gfp_add( R2, R1, R1 );      /* 4*y^2 */
+    gfp_multiply( X0, px, R2 ); /* S = 4*x*y^2 */
+    gfp_square( Y0, R1 );
+    gfp_add( Y0, Y0, Y0 );      /* 8*y^4 */
+    gfp_square( R1, px );
+    gfp_add( R2, R1, R1 );
+    gfp_add( R1, R1, R2 );
+    gfp_add( R1, R1, param->param_a ); /* M = 3*x^2+a */
+    gfp_square( X1, R1 );
+    gfp_subtract( X1, X1, X0 );
+    gfp_subtract( X1, X1, X0 ); /* M^2-2*S */
+    gfp_subtract( R2, X0, X1 );
+    gfp_multiply( Y1, R1, R2 );
+    gfp_subtract( Y1, Y1, Y0 ); /* M*(S-X)-8*y^4 */
+
+    /* randomize the common Z coordinate by lambda */
+    gfp_rand( R3, &param->prime_data );
+    gfp_square( R1, R3 );
+    gfp_multiply( R2, R1, R3 );
+    gfp_multiply( X0, X0, R1 );
+    gfp_multiply( Y0, Y0, R2 );
+    gfp_multiply( X1, X1, R1 );
+    gfp_multiply( Y1, Y1, R2 );
+
+    /* both points have the common Z = 2*y*lambda */
+    gfp_add( R1, py, py );
+    gfp_multiply( R1, R1, R3 );
+    if( !eccp_protected_jacobian_point_is_valid( X0, Y0, R1, R2, R3, R4, param )
+        || !eccp_protected_jacobian_point_is_valid( X1, Y1, R1, R2, R3, R4, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    /* the multiplication starts with the second most significant bit,
+     * (X1, Y1) always holds R_b and (X0, Y0) holds R_(1-b) */
+    bit = bigint_get_msb_var( scalar, param->order_n_data.words ) - 1;
+    while( bit > 0 ) {
+        bit_is_set = bigint_test_bit_var( scalar, bit, param->order_n_data.words );
+        bigint_cr_switch( X0, X1, bit_is_set ^ last_bit, param->prime_data.words );
+        bigint_cr_switch( Y0, Y1, bit_is_set ^ last_bit, param->prime_data.words );
+        last_bit = bit_is_set;
+        bit--;
+
+        eccp_protected_coz_add_conjugate( X1, Y1, X0, Y0, param ); /* R_(1-b) = R_b + R_(1-b), R_b = R_b - R_(1-b) */
+        eccp_protected_coz_add( X0, Y0, X1, Y1, param );           /* R_b = 2*R_b */
+    }
+
+    bit_is_set = bigint_test_bit_var( scalar, 0, param->order_n_data.words );
+    bigint_cr_switch( X0, X1, bit_is_set ^ last_bit, param->prime_data.words );
+    bigint_cr_switch( Y0, Y1, bit_is_set ^ last_bit, param->prime_data.words );
+    eccp_protected_coz_add_conjugate( X1, Y1, X0, Y0, param );
+
+    /* R_b = (-1)^(1-b) * P now determines the common Z:
+     * 1/Z' = X_b * y_b / (Y_b * x * (X_b - X_(1-b))) with Z' = Z*(X_b - X_(1-b)) of the last addition */
+    gfp_negate( R3, py );
+    bigint_cr_select_2( R3, R3, py, bit_is_set, param->prime_data.words );
+    gfp_multiply( R3, R3, X1 );
+    gfp_subtract( R1, X1, X0 );
+    gfp_multiply( R1, R1, Y1 );
+    gfp_multiply( R1, R1, px );
+
+    /* the last ladder step: R_0 = R_0 + R_1 if b = 1, R_0 = 2*R_0 otherwise */
+    eccp_protected_coz_add( X0, Y0, X1, Y1, param );
+    bigint_cr_select_2( X1, X1, X0, bit_is_set, param->prime_data.words );
+    bigint_cr_select_2( Y1, Y1, Y0, bit_is_set, param->prime_data.words );
+
+    if( gfp_is_zero( R1 ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+    gfp_inverse( R2, R1 );
+    gfp_multiply( R2, R2, R3 ); /* 1/Z' */
+    gfp_square( R1, R2 );
+    gfp_multiply( result->x, X1, R1 );
+    gfp_multiply( R1, R1, R2 );
+    gfp_multiply( result->y, Y1, R1 );
+    result->identity = 0;
+
+    if( !eccp_affine_point_is_valid( result, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+}
@@ -38,6 +38,7 @@
 #include "flecc_in_c/eccp/eccp_std_projective.h"
 #include "flecc_in_c/bi/bi.h"
 #include "flecc_in_c/eccp/eccp_affine.h"
+#include "flecc_in_c/eccp/eccp_jacobian.h"
 #include "flecc_in_c/gfp/gfp.h"
 #include "flecc_in_c/utils/rand.h"
 
@@ -161,12 +162,20 @@ void eccp_std_projective_to_affine( eccp_point_affine_t *res, const eccp_point_p
 
 /**
  * Converts an affine point to a standard projective point.
+ * The identity is represented by (0:1:0) as needed by the complete formulas.
  * @param res the resulting standard projective point
  * @param A   the give affine point
  * @param param elliptic curve parameters
  */
 void eccp_affine_to_std_projective( eccp_point_projective_t *res, const eccp_point_affine_t *a, const eccp_parameters_t *param ) {
 #if 1
+    if( a->identity == 1 ) {
+        gfp_clear( res->x );
+        gfp_copy( res->y, param->prime_data.gfp_one );
+        gfp_clear( res->z );
+        res->identity = 1;
+        return;
+    }
     gfp_copy( res->x, a->x );
     gfp_copy( res->y, a->y );
     gfp_copy( res->z, param->prime_data.gfp_one );
@@ -194,3 +203,530 @@ void eccp_std_projective_point_negate( eccp_point_projective_t *res,
     gfp_copy( res->z, P->z );
     res->identity = P->identity;
 }
+
+/**
+ * Adds two points in standard projective coordinates with the complete formulas
+ * of Renes, Costello, Batina - "Complete addition formulas for prime order elliptic curves"
+ * (Algorithm 4 for a = -3, Algorithm 1 otherwise). No special cases are handled:
+ * The formulas are also correct for P = Q, P = -Q and the identity, which has
+ * to be represented as (0:1:0). The sequence of operations only depends on the curve.
+ * @param res the resulting point (may be equal to a or b)
+ * @param a the first summand
+ * @param b the second summand
+ * @param param elliptic curve parameters
+ */
+void eccp_std_projective_point_add_complete( eccp_point_projective_t *res,
+                                             const eccp_point_projective_t *a,
+                                             const eccp_point_projective_t *b,
+                                             const eccp_parameters_t *param ) {
+    gfp_t t0, t1, t2, t3, t4, t5, X3, Y3, Z3, b3;
+
+    gfp_multiply( t0, a->x, b->x );
+    gfp_multiply( t1, a->y, b->y );
+    gfp_multiply( t2, a->z, b->z );
+    gfp_add( t3, a->x, a->y );
+    gfp_add( t4, b->x, b->y );
+    gfp_multiply( t3, t3, t4 );
+    gfp_add( t4, t0, t1 );
+    gfp_subtract( t3, t3, t4 ); /* X1*Y2 + X2*Y1 */
+    gfp_add( t4, a->y, a->z );
+    gfp_add( X3, b->y, b->z );
+    gfp_multiply( t4, t4, X3 );
+    gfp_add( X3, t1, t2 );
+    gfp_subtract( t4, t4, X3 ); /* Y1*Z2 + Y2*Z1 */
+    gfp_add( X3, a->x, a->z );
+    gfp_add( Y3, b->x, b->z );
+    gfp_multiply( X3, X3, Y3 );
+    gfp_add( Y3, t0, t2 );
+    gfp_subtract( t5, X3, Y3 ); /* X1*Z2 + X2*Z1 */
+
+    if( param->param_a_is_minus_three ) {
+        gfp_multiply( Z3, param->param_b, t2 );
+        gfp_subtract( X3, t5, Z3 );
+        gfp_add( Z3, X3, X3 );
+        gfp_add( X3, X3, Z3 );
+        gfp_subtract( Z3, t1, X3 );
+        gfp_add( X3, t1, X3 );
+        gfp_multiply( Y3, param->param_b, t5 );
+        gfp_add( t1, t2, t2 );
+        gfp_add( t2, t1, t2 );
+        gfp_subtract( Y3, Y3, t2 );
+        gfp_subtract( Y3, Y3, t0 );
+        gfp_add( t1, Y3, Y3 );
+        gfp_add( Y3, t1, Y3 );
+        gfp_add( t1, t0, t0 );
+        gfp_add( t0, t1, t0 );
+        gfp_subtract( t0, t0, t2 );
+        gfp_multiply( t1, t4, Y3 );
+        gfp_multiply( t2, t0, Y3 );
+        gfp_multiply( Y3, X3, Z3 );
+        gfp_add( Y3, Y3, t2 );
+        gfp_multiply( X3, t3, X3 );
+        gfp_subtract( X3, X3, t1 );
+        gfp_multiply( t1, t3, t0 );
+        gfp_multiply( Z3, t4, Z3 );
+        gfp_add( Z3, Z3, t1 );
+    } else {
+        gfp_add( b3, param->param_b, param->param_b );
+        gfp_add( b3, b3, param->param_b );
+        gfp_multiply( Z3, param->param_a, t5 );
+        gfp_multiply( X3, b3, t2 );
+        gfp_add( Z3, X3, Z3 );
+        gfp_subtract( X3, t1, Z3 );
+        gfp_add( Z3, t1, Z3 );
+        gfp_multiply( Y3, X3, Z3 );
+        gfp_add( t1, t0, t0 );
+        gfp_add( t1, t1, t0 );
+        gfp_multiply( t2, param->param_a, t2 );
+        gfp_multiply( t5, b3, t5 );
+        gfp_add( t1, t1, t2 );
+        gfp_subtract( t2, t0, t2 );
+        gfp_multiply( t2, param->param_a, t2 );
+        gfp_add( t5, t5, t2 );
+        gfp_multiply( t0, t1, t5 );
+        gfp_add( Y3, Y3, t0 );
+        gfp_multiply( t0, t4, t5 );
+        gfp_multiply( X3, t3, X3 );
+        gfp_subtract( X3, X3, t0 );
+        gfp_multiply( t0, t3, t1 );
+        gfp_multiply( Z3, t4, Z3 );
+        gfp_add( Z3, Z3, t0 );
+    }
+
+    gfp_copy( res->x, X3 );
+    gfp_copy( res->y, Y3 );
+    gfp_copy( res->z, Z3 );
+    res->identity = bigint_cr_is_zero_var( Z3, param->prime_data.words );
+}
+
+/**
+ * Doubles a point in standard projective coordinates with the complete formulas
+ * of Renes, Costello, Batina - "Complete addition formulas for prime order elliptic curves"
+ * (Algorithm 6 for a = -3, Algorithm 3 otherwise). The identity has to be
+ * represented as (0:1:0). The sequence of operations only depends on the curve.
+ * @param res the doubled point (may be equal to a)
+ * @param a the point to double
+ * @param param elliptic curve parameters
+ */
+void eccp_std_projective_point_double_complete( eccp_point_projective_t *res,
+                                                const eccp_point_projective_t *a,
+                                                const eccp_parameters_t *param ) {
+    gfp_t t0, t1, t2, t3, X3, Y3, Z3, b3;
+
+    gfp_square( t0, a->x );
+    gfp_square( t1, a->y );
+    gfp_square( t2, a->z );
+    gfp_multiply( t3, a->x, a->y );
+    gfp_add( t3, t3, t3 );
+    gfp_multiply( Z3, a->x, a->z );
+    gfp_add( Z3, Z3, Z3 );
+
+    if( param->param_a_is_minus_three ) {
+        gfp_multiply( Y3, param->param_b, t2 );
+        gfp_subtract( Y3, Y3, Z3 );
+        gfp_add( X3, Y3, Y3 );
+        gfp_add( Y3, X3, Y3 );
+        gfp_subtract( X3, t1, Y3 );
+        gfp_add( Y3, t1, Y3 );
+        gfp_multiply( Y3, X3, Y3 );
+        gfp_multiply( X3, X3, t3 );
+        gfp_add( t3, t2, t2 );
+        gfp_add( t2, t2, t3 );
+        gfp_multiply( Z3, param->param_b, Z3 );
+        gfp_subtract( Z3, Z3, t2 );
+        gfp_subtract( Z3, Z3, t0 );
+        gfp_add( t3, Z3, Z3 );
+        gfp_add( Z3, Z3, t3 );
+        gfp_add( t3, t0, t0 );
+        gfp_add( t0, t3, t0 );
+        gfp_subtract( t0, t0, t2 );
+        gfp_multiply( t0, t0, Z3 );
+        gfp_add( Y3, Y3, t0 );
+        gfp_multiply( t0, a->y, a->z );
+        gfp_add( t0, t0, t0 );
+        gfp_multiply( Z3, t0, Z3 );
+        gfp_subtract( X3, X3, Z3 );
+        gfp_multiply( Z3, t0, t1 );
+        gfp_add( Z3, Z3, Z3 );
+        gfp_add( Z3, Z3, Z3 );
+    } else {
+        gfp_add( b3, param->param_b, param->param_b );
+        gfp_add( b3, b3, param->param_b );
+        gfp_multiply( X3, param->param_a, Z3 );
+        gfp_multiply( Y3, b3, t2 );
+        gfp_add( Y3, X3, Y3 );
+        gfp_subtract( X3, t1, Y3 );
+        gfp_add( Y3, t1, Y3 );
+        gfp_multiply( Y3, X3, Y3 );
+        gfp_multiply( X3, t3, X3 );
+        gfp_multiply( Z3, b3, Z3 );
+        gfp_multiply( t2, param->param_a, t2 );
+        gfp_subtract( t3, t0, t2 );
+        gfp_multiply( t3, param->param_a, t3 );
+        gfp_add( t3, t3, Z3 );
+        gfp_add( Z3, t0, t0 );
+        gfp_add( t0, Z3, t0 );
+        gfp_add( t0, t0, t2 );
+        gfp_multiply( t0, t0, t3 );
+        gfp_add( Y3, Y3, t0 );
+        gfp_multiply( t2, a->y, a->z );
+        gfp_add( t2, t2, t2 );
+        gfp_multiply( t0, t2, t3 );
+        gfp_subtract( X3, X3, t0 );
+        gfp_multiply( Z3, t2, t1 );
+        gfp_add( Z3, Z3, Z3 );
+        gfp_add( Z3, Z3, Z3 );
+    }
+
+    gfp_copy( res->x, X3 );
+    gfp_copy( res->y, Y3 );
+    gfp_copy( res->z, Z3 );
+    res->identity = bigint_cr_is_zero_var( Z3, param->prime_data.words );
+}
+
+/**
+ * Selects table[index] IN CONSTANT TIME by copying every entry of the table
+ * with a mask (see bigint_cr_conditional_copy), so neither the control flow nor
+ * the memory access pattern depends on the index. Works for every projective
+ * representation, e.g. jacobian coordinates as well.
+ * @param res the selected point (must not be part of the table)
+ * @param table the table to select from
+ * @param count the number of entries of the table
+ * @param index the index of the entry to select (secret, smaller than count)
+ * @param param elliptic curve parameters
+ */
+void eccp_std_projective_table_select_ct( eccp_point_projective_t *res,
+                                          const eccp_point_projective_t *table,
+                                          const int count,
+                                          const uint_t index,
+                                          const eccp_parameters_t *param ) {
+    uint_t difference;
+    uint8_t identity = 0;
+    int i;
+
+    gfp_clear( res->x );
+    gfp_clear( res->y );
+    gfp_clear( res->z );
+    for( i = 0; i < count; i++ ) {
+        // 1 if i equals index, 0 otherwise
+        difference = (uint_t)i ^ index;
+        difference = 1 ^ ( ( difference | ( 0 - difference ) ) >> ( BITS_PER_WORD - 1 ) );
+        bigint_cr_conditional_copy( res->x, table[i].x, (int)difference, param->prime_data.words );
+        bigint_cr_conditional_copy( res->y, table[i].y, (int)difference, param->prime_data.words );
+        bigint_cr_conditional_copy( res->z, table[i].z, (int)difference, param->prime_data.words );
+        identity |= table[i].identity & (uint8_t)( 0 - difference );
+    }
+    res->identity = identity;
+}
+
+/**
+ * Selects table[index] IN CONSTANT TIME from a table of affine points (see
+ * eccp_affine_table_select_ct). The identity is returned as (0:1:0).
+ * @param res the selected point in standard projective coordinates
+ * @param table the table to select from
+ * @param count the number of entries of the table
+ * @param index the index of the entry to select (secret)
+ * @param param elliptic curve parameters
+ */
+static void eccp_std_projective_select_from_affine_table( eccp_point_projective_t *res,
+                                                          const eccp_point_affine_t *table,
+                                                          const int count,
+                                                          const uint_t index,
+                                                          const eccp_parameters_t *param ) {
+    eccp_point_affine_t selected;
+    gfp_t zero;
+
+    eccp_affine_table_select_ct( &selected, table, count, index, param );
+    gfp_clear( zero );
+    bigint_cr_select_2( res->x, selected.x, zero, selected.identity, param->prime_data.words );
+    bigint_cr_select_2( res->y, selected.y, param->prime_data.gfp_one, selected.identity, param->prime_data.words );
+    bigint_cr_select_2( res->z, param->prime_data.gfp_one, zero, selected.identity, param->prime_data.words );
+    res->identity = selected.identity;
+}
+
+/**
+ * Performs a point scalar multiplication IN CONSTANT TIME with a fixed window of
+ * ECCP_STD_PROJECTIVE_WINDOW bits. Uses the complete addition formulas only,
+ * so the sequence of operations solely depends on the bit length of the group order,
+ * and selects the precomputed multiples in constant time.
+ * @param result the resulting point (set to identity when error happens)
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ */
+void eccp_std_projective_point_multiply_window( eccp_point_affine_t *result,
+                                                const eccp_point_affine_t *P,
+                                                const gfp_t scalar,
+                                                const eccp_parameters_t *param ) {
+    eccp_point_projective_t table[1 << ECCP_STD_PROJECTIVE_WINDOW];
+    eccp_point_projective_t result_projective, selected;
+    int digits = ( param->order_n_data.bits - 1 ) / ECCP_STD_PROJECTIVE_WINDOW + 1;
+    int i, j, bit;
+    uint_t digit;
+
+    if( P->identity == 1 || !eccp_affine_point_is_valid( P, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    /* deal with the case that the scalar is larger than the group order */
+    if( bigint_compare_var( scalar, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    // table[i] = i*P, table[0] is the identity
+    gfp_clear( table[0].x );
+    gfp_copy( table[0].y, param->prime_data.gfp_one );
+    gfp_clear( table[0].z );
+    table[0].identity = 1;
+    eccp_affine_to_std_projective( &table[1], P, param );
+    for( i = 2; i < ( 1 << ECCP_STD_PROJECTIVE_WINDOW ); i++ ) {
+        eccp_std_projective_point_add_complete( &table[i], &table[i - 1], &table[1], param );
+    }
+
+    eccp_std_projective_point_copy( &result_projective, &table[0], param );
+    eccp_std_projective_point_copy( &selected, &table[0], param );
+    for( i = digits - 1; i >= 0; i-- ) {
+        digit = 0;
+        for( j = ECCP_STD_PROJECTIVE_WINDOW - 1; j >= 0; j-- ) {
+            bit = i * ECCP_STD_PROJECTIVE_WINDOW + j;
+            digit <<= 1;
+            if( bit < (int)param->order_n_data.bits ) {
+                digit |= (uint_t)bigint_test_bit_var( scalar, bit, param->order_n_data.words );
+            }
+            if( i != digits - 1 ) {
+                eccp_std_projective_point_double_complete( &result_projective, &result_projective, param );
+            }
+        }
+        eccp_std_projective_table_select_ct( &selected, table, 1 << ECCP_STD_PROJECTIVE_WINDOW, digit, param );
+        eccp_std_projective_point_add_complete( &result_projective, &result_projective, &selected, param );
+    }
+
+    eccp_std_projective_to_affine( result, &result_projective, param );
+}
+
+/**
+ * Performs a point scalar multiplication IN CONSTANT TIME with a signed fixed window
+ * of ECCP_STD_PROJECTIVE_SIGNED_WINDOW bits. The scalar is Booth recoded into digits
+ * in [-2^(w-1), 2^(w-1)], so only 2^(w-1) multiples have to be precomputed and every
+ * window costs one addition. The multiples are selected in constant time and
+ * negated with a masked selection. Uses the complete addition formulas only.
+ * Like eccp_protected_point_multiply, it rejects scalars that are not smaller than
+ * the group order, randomizes the projective coordinates and validates the result,
+ * so it may be used with secret scalars.
+ * @param result the resulting point (set to identity when error happens)
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ */
+void eccp_std_projective_point_multiply_signed_window( eccp_point_affine_t *result,
+                                                       const eccp_point_affine_t *P,
+                                                       const gfp_t scalar,
+                                                       const eccp_parameters_t *param ) {
+    eccp_point_projective_t table[( 1 << ( ECCP_STD_PROJECTIVE_SIGNED_WINDOW - 1 ) ) + 1];
+    eccp_point_projective_t result_projective, selected;
+    gfp_t negated_y, lambda;
+    int digits = param->order_n_data.bits / ECCP_STD_PROJECTIVE_SIGNED_WINDOW + 1;
+    int i, j, bit;
+    uint_t window, sign, digit;
+
+    if( P->identity == 1 || !eccp_affine_point_is_valid( P, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    /* deal with the case that the scalar is larger than the group order */
+    if( bigint_compare_var( scalar, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    // table[i] = i*P, table[0] is the identity
+    gfp_clear( table[0].x );
+    gfp_copy( table[0].y, param->prime_data.gfp_one );
+    gfp_clear( table[0].z );
+    table[0].identity = 1;
+    eccp_affine_to_std_projective( &table[1], P, param );
+    /* randomize the projective coordinates of P, the other multiples inherit the randomization */
+    gfp_rand( lambda, &param->prime_data );
+    gfp_multiply( table[1].x, table[1].x, lambda );
+    gfp_multiply( table[1].y, table[1].y, lambda );
+    gfp_multiply( table[1].z, table[1].z, lambda );
+    for( i = 2; i <= ( 1 << ( ECCP_STD_PROJECTIVE_SIGNED_WINDOW - 1 ) ); i++ ) {
+        eccp_std_projective_point_add_complete( &table[i], &table[i - 1], &table[1], param );
+    }
+
+    eccp_std_projective_point_copy( &result_projective, &table[0], param );
+    eccp_std_projective_point_copy( &selected, &table[0], param );
+    for( i = digits - 1; i >= 0; i-- ) {
+        // the w+1 bits from i*w-1 to i*w+w-1 determine the Booth digit
+        window = 0;
+        for( j = ECCP_STD_PROJECTIVE_SIGNED_WINDOW; j >= 0; j-- ) {
+            bit = i * ECCP_STD_PROJECTIVE_SIGNED_WINDOW + j - 1;
+            window <<= 1;
+            if( bit >= 0 && bit < (int)param->order_n_data.bits ) {
+                window |= (uint_t)bigint_test_bit_var( scalar, bit, param->order_n_data.words );
+            }
+            if( i != digits - 1 && j > 0 ) {
+                eccp_std_projective_point_double_complete( &result_projective, &result_projective, param );
+            }
+        }
+        sign = 0 - ( window >> ECCP_STD_PROJECTIVE_SIGNED_WINDOW ); // all ones if negative
+        digit = ( ( ( 1 << ( ECCP_STD_PROJECTIVE_SIGNED_WINDOW + 1 ) ) - window - 1 ) & sign ) | ( window & ~sign );
+        digit = ( digit >> 1 ) + ( digit & 1 );
+
+        eccp_std_projective_table_select_ct(
+            &selected, table, ( 1 << ( ECCP_STD_PROJECTIVE_SIGNED_WINDOW - 1 ) ) + 1, digit, param );
+        gfp_negate( negated_y, selected.y );
+        bigint_cr_select_2( selected.y, selected.y, negated_y, (int)( sign & 1 ), param->prime_data.words );
+        eccp_std_projective_point_add_complete( &result_projective, &result_projective, &selected, param );
+    }
+
+    eccp_std_projective_to_affine( result, &result_projective, param );
+
+    if( result->identity == 0 && !eccp_affine_point_is_valid( result, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+    }
+}
+
+/**
+ * Performs a point scalar multiplication of the base point IN CONSTANT TIME with
+ * the comb method of Lim and Lee. The scalar is split into width rows of d bits
+ * and the columns into ECCP_STD_PROJECTIVE_COMB_TABLES blocks, every block has
+ * its own table, so only ceil(d / ECCP_STD_PROJECTIVE_COMB_TABLES) - 1 doublings
+ * are needed. Every column costs one complete addition of an entry that is
+ * selected by scanning the whole table, including the identity for a zero column.
+ * Like eccp_protected_point_multiply, it rejects scalars that are not smaller than
+ * the group order, randomizes the projective coordinates and validates the result,
+ * so it may be used with secret scalars.
+ * @param result the resulting point (set to identity when error happens)
+ * @param scalar the multiplicant (smaller than the group order)
+ * @param param elliptic curve parameters (includes pre-computation table)
+ *
+ * Hankerson Page 106 Algorithm 3.45, generalized to more than two tables
+ */
+void eccp_std_projective_point_multiply_COMB_LL( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    int width = param->base_point_precomputed_table_width;
+    int tbl_size = 1 << width;
+    int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1;               // same as ceil (bits / width)
+    int comb_param_b = ( comb_param_d - 1 ) / ECCP_STD_PROJECTIVE_COMB_TABLES + 1; // same as ceil (d / tables)
+    eccp_point_projective_t result_projective, selected;
+    int i, j, k, bit, column;
+    uint_t index;
+
+    /* deal with the case that the scalar is larger than the group order */
+    if( bigint_compare_var( scalar, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+
+    /* start with a randomized identity (0:lambda:0), the complete formulas carry the randomization over to all sums */
+    gfp_clear( result_projective.x );
+    gfp_rand( result_projective.y, &param->prime_data );
+    gfp_clear( result_projective.z );
+    result_projective.identity = 1;
+
+    for( k = comb_param_b - 1; k >= 0; k-- ) {
+        if( k != comb_param_b - 1 ) {
+            eccp_std_projective_point_double_complete( &result_projective, &result_projective, param );
+        }
+        for( j = 0; j < ECCP_STD_PROJECTIVE_COMB_TABLES; j++ ) {
+            column = j * comb_param_b + k;
+            index = 0;
+            for( i = width - 1; i >= 0; i-- ) {
+                bit = i * comb_param_d + column;
+                index <<= 1;
+                // the last block may be shorter than the others and the last row
+                // may be longer than the scalar
+                if( column < comb_param_d && bit < (int)param->order_n_data.bits ) {
+                    index |= (uint_t)bigint_test_bit_var( scalar, bit, param->order_n_data.words );
+                }
+            }
+            eccp_std_projective_select_from_affine_table(
+                &selected, &param->base_point_precomputed_table[j * tbl_size], tbl_size, index, param );
+            eccp_std_projective_point_add_complete( &result_projective, &result_projective, &selected, param );
+        }
+    }
+
+    eccp_std_projective_to_affine( result, &result_projective, param );
+
+    if( result->identity == 0 && !eccp_affine_point_is_valid( result, param ) ) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+    }
+}
+
+/**
+ * Initializes the pre-computation table for eccp_std_projective_point_multiply_COMB_LL
+ * and registers it as param->eccp_mul_base_point. Entry u of table j is
+ * sum over the bits i of u of 2^(i*d + j*b) * P, entry 0 is the identity.
+ * @param table the table to fill (ECCP_STD_PROJECTIVE_COMB_TBL_SIZE(base_point_precomputed_table_width) entries),
+ * is set as param->base_point_precomputed_table
+ * @param param elliptic curve parameters
+ */
+void eccp_std_projective_point_multiply_COMB_LL_precompute( eccp_point_affine_t *table, eccp_parameters_t *param ) {
+    int width = param->base_point_precomputed_table_width;
+    int tbl_size = 1 << width;
+    int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1;               // same as ceil (bits / width)
+    int comb_param_b = ( comb_param_d - 1 ) / ECCP_STD_PROJECTIVE_COMB_TABLES + 1; // same as ceil (d / tables)
+    eccp_point_projective_t row, temp;
+    eccp_point_projective_t doubles_p[ECCP_STD_PROJECTIVE_COMB_TABLES];
+    eccp_point_affine_t doubles[ECCP_STD_PROJECTIVE_COMB_TABLES];
+    eccp_point_affine_t *res[ECCP_AFFINE_BATCH_SIZE];
+    const eccp_point_affine_t *summand_a[ECCP_AFFINE_BATCH_SIZE];
+    const eccp_point_affine_t *summand_b[ECCP_AFFINE_BATCH_SIZE];
+    int i, j, r, count;
+
+    eccp_affine_to_jacobian( &row, &param->base_point, param );
+    for( i = 0; i < width; i++ ) {
+        // 2^(i*d + j*b) * P of all tables share a single inversion
+        eccp_jacobian_point_copy( &temp, &row, param );
+        for( j = 0; j < ECCP_STD_PROJECTIVE_COMB_TABLES; j++ ) {
+            if( j > 0 ) {
+                eccp_jacobian_point_double_repeated( &temp, &temp, comb_param_b, param );
+            }
+            eccp_jacobian_point_copy( &doubles_p[j], &temp, param );
+        }
+        eccp_jacobian_to_affine_batch( doubles, doubles_p, ECCP_STD_PROJECTIVE_COMB_TABLES, param );
+        for( j = 0; j < ECCP_STD_PROJECTIVE_COMB_TABLES; j++ ) {
+            eccp_affine_point_copy( &table[j * tbl_size + ( 1 << i )], &doubles[j], param );
+        }
+        eccp_jacobian_point_double_repeated( &row, &row, comb_param_d, param );
+    }
+
+    for( j = 0; j < ECCP_STD_PROJECTIVE_COMB_TABLES; j++ ) {
+        gfp_clear( table[j * tbl_size].x );
+        gfp_clear( table[j * tbl_size].y );
+        table[j * tbl_size].identity = 1;
+    }
+
+    // entry 2^i + r is 2^i + entry r, the additions of all tables are independent and share their inversions
+    for( i = 1; i < width; i++ ) {
+        count = 0;
+        for( j = 0; j < ECCP_STD_PROJECTIVE_COMB_TABLES; j++ ) {
+            for( r = 1; r < ( 1 << i ); r++ ) {
+                res[count] = &table[j * tbl_size + ( 1 << i ) + r];
+                summand_a[count] = &table[j * tbl_size + ( 1 << i )];
+                summand_b[count] = &table[j * tbl_size + r];
+                count++;
+                if( count == ECCP_AFFINE_BATCH_SIZE ) {
+                    eccp_affine_point_add_batch( res, summand_a, summand_b, count, param );
+                    count = 0;
+                }
+            }
+        }
+        if( count > 0 ) {
+            eccp_affine_point_add_batch( res, summand_a, summand_b, count, param );
+        }
+    }
+
+    param->base_point_precomputed_table = table;
+    param->eccp_mul_base_point = &eccp_std_projective_point_multiply_COMB_LL;
+}
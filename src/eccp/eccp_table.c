@@ -0,0 +1,342 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+// open, fstat and mmap are POSIX functions (not part of C99)
+#define _POSIX_C_SOURCE 200112L
+
+#include "flecc_in_c/eccp/eccp_table.h"
+#include "flecc_in_c/eccp/eccp_jacobian.h"
+#include "flecc_in_c/eccp/eccp_std_projective.h"
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#define ECCP_TABLE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const uint8_t eccp_table_magic[8] = {'F', 'L', 'E', 'C', 'C', 'T', 'B', 'L'};
+
+/** Fletcher-64 checksum (sums of 32-bit words modulo 2^32 - 1) */
+typedef struct {
+    uint64_t sum1;
+    uint64_t sum2;
+} eccp_table_checksum_t;
+
+/**
+ * adds the next bytes to the checksum
+ * @param checksum the checksum state
+ * @param data the bytes to add
+ * @param length the number of bytes (a multiple of 4)
+ */
+static void eccp_table_checksum_update( eccp_table_checksum_t *checksum, const void *data, const size_t length ) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t word;
+    size_t i;
+
+    assert( length % 4 == 0 );
+    for( i = 0; i < length; i += 4 ) {
+        memcpy( &word, bytes + i, 4 );
+        checksum->sum1 = ( checksum->sum1 + word ) % 0xFFFFFFFF;
+        checksum->sum2 = ( checksum->sum2 + checksum->sum1 ) % 0xFFFFFFFF;
+    }
+}
+
+/**
+ * starts the checksum of a table file with the header (with zero checksum)
+ * and the curve parameters the table belongs to (prime and base point)
+ * @param checksum the checksum state to initialize
+ * @param header the header of the table file
+ * @param param elliptic curve parameters
+ */
+static void eccp_table_checksum_header( eccp_table_checksum_t *checksum,
+                                        const eccp_table_header_t *header,
+                                        const eccp_parameters_t *param ) {
+    eccp_table_header_t temp = *header;
+    size_t length = param->prime_data.words * BYTES_PER_WORD;
+
+    temp.checksum = 0;
+    checksum->sum1 = 0;
+    checksum->sum2 = 0;
+    eccp_table_checksum_update( checksum, &temp, sizeof( temp ) );
+    eccp_table_checksum_update( checksum, param->prime_data.prime, length );
+    eccp_table_checksum_update( checksum, param->base_point.x, length );
+    eccp_table_checksum_update( checksum, param->base_point.y, length );
+}
+
+/**
+ * finishes the checksum of a table file
+ * @param checksum the checksum state
+ * @return the checksum
+ */
+static uint64_t eccp_table_checksum_final( const eccp_table_checksum_t *checksum ) {
+    return ( checksum->sum2 << 32 ) | checksum->sum1;
+}
+
+/**
+ * determines the pre-computation method from param->eccp_mul_base_point
+ * @param param elliptic curve parameters
+ * @return the eccp_table_algorithm_t or 0 if the method has no table
+ */
+static uint32_t eccp_table_get_algorithm( const eccp_parameters_t *param ) {
+    if( param->eccp_mul_base_point == &eccp_jacobian_point_multiply_COMB ) {
+        return ECCP_TABLE_COMB;
+    } else if( param->eccp_mul_base_point == &eccp_jacobian_point_multiply_COMB_WOZ ) {
+        return ECCP_TABLE_COMB_WOZ;
+    } else if( param->eccp_mul_base_point == &eccp_std_projective_point_multiply_COMB_LL ) {
+        return ECCP_TABLE_COMB_LL;
+    }
+    return 0;
+}
+
+/**
+ * returns the number of table entries of a pre-computation method
+ * @param algorithm the eccp_table_algorithm_t
+ * @param width the comb width
+ * @return the number of entries or 0 if the method or width is not supported
+ */
+static uint32_t eccp_table_get_entries( const uint32_t algorithm, const uint32_t width ) {
+    if( width < 1 || width > 16 ) {
+        return 0;
+    }
+    switch( algorithm ) {
+    case ECCP_TABLE_COMB:
+        return JCB_COMB_TBL_SIZE( width );
+    case ECCP_TABLE_COMB_WOZ:
+        return JCB_COMB_WOZ_TBL_SIZE( width );
+    case ECCP_TABLE_COMB_LL:
+        return ECCP_STD_PROJECTIVE_COMB_TBL_SIZE( width );
+    default:
+        return 0;
+    }
+}
+
+/**
+ * Writes the pre-computation table of the base point (param->base_point_precomputed_table
+ * of the method registered as param->eccp_mul_base_point) into a file that can be
+ * shared with eccp_table_map.
+ * @param path the name of the file to (over)write
+ * @param param elliptic curve parameters with initialized pre-computation table
+ * @return 1 if successful, 0 otherwise (the file is removed)
+ */
+int eccp_table_save( const char *path, const eccp_parameters_t *param ) {
+    eccp_table_header_t header;
+    eccp_table_checksum_t checksum;
+    eccp_point_affine_t entry;
+    uint8_t padding[ECCP_TABLE_HEADER_SIZE - sizeof( eccp_table_header_t )];
+    size_t length = param->prime_data.words * BYTES_PER_WORD;
+    FILE *file;
+    uint32_t i;
+    int success;
+
+    memset( &header, 0, sizeof( header ) );
+    memcpy( header.magic, eccp_table_magic, sizeof( header.magic ) );
+    header.version = ECCP_TABLE_VERSION;
+    header.header_size = ECCP_TABLE_HEADER_SIZE;
+    header.curve_type = param->curve_type;
+    header.algorithm = eccp_table_get_algorithm( param );
+    header.width = param->base_point_precomputed_table_width;
+    header.bytes_per_word = BYTES_PER_WORD;
+    header.words = param->prime_data.words;
+    header.montgomery_domain = param->prime_data.montgomery_domain;
+    header.entry_size = sizeof( eccp_point_affine_t );
+    header.entries = eccp_table_get_entries( header.algorithm, header.width );
+    if( header.entries == 0 || param->base_point_precomputed_table == NULL ) {
+        return 0;
+    }
+
+    file = fopen( path, "wb" );
+    if( file == NULL ) {
+        return 0;
+    }
+
+    // the header is written again as soon as the checksum is known
+    eccp_table_checksum_header( &checksum, &header, param );
+    memset( padding, 0, sizeof( padding ) );
+    success = fwrite( &header, sizeof( header ), 1, file ) == 1 && fwrite( padding, sizeof( padding ), 1, file ) == 1;
+    for( i = 0; success && i < header.entries; i++ ) {
+        // unused words and padding bytes are stored as zeros
+        memset( &entry, 0, sizeof( entry ) );
+        memcpy( entry.x, param->base_point_precomputed_table[i].x, length );
+        memcpy( entry.y, param->base_point_precomputed_table[i].y, length );
+        entry.identity = param->base_point_precomputed_table[i].identity;
+        eccp_table_checksum_update( &checksum, &entry, sizeof( entry ) );
+        success = fwrite( &entry, sizeof( entry ), 1, file ) == 1;
+    }
+    if( success ) {
+        header.checksum = eccp_table_checksum_final( &checksum );
+        success = fseek( file, 0, SEEK_SET ) == 0 && fwrite( &header, sizeof( header ), 1, file ) == 1;
+    }
+
+    if( fclose( file ) != 0 ) {
+        success = 0;
+    }
+    if( !success ) {
+        remove( path );
+    }
+    return success;
+}
+
+#ifdef ECCP_TABLE_MMAP
+/**
+ * checks whether a table file header is valid for the given curve parameters
+ * @param header the header of the table file
+ * @param size the size of the table file
+ * @param param elliptic curve parameters
+ * @return 1 if the header matches, 0 otherwise
+ */
+static int eccp_table_header_matches( const eccp_table_header_t *header, const size_t size, const eccp_parameters_t *param ) {
+    if( memcmp( header->magic, eccp_table_magic, sizeof( header->magic ) ) != 0 || header->version != ECCP_TABLE_VERSION
+        || header->header_size != ECCP_TABLE_HEADER_SIZE ) {
+        return 0;
+    }
+    if( header->curve_type != (uint32_t)param->curve_type || header->bytes_per_word != BYTES_PER_WORD
+        || header->words != param->prime_data.words || header->montgomery_domain != param->prime_data.montgomery_domain
+        || header->entry_size != sizeof( eccp_point_affine_t ) ) {
+        return 0;
+    }
+    if( header->entries == 0 || header->entries != eccp_table_get_entries( header->algorithm, header->width ) ) {
+        return 0;
+    }
+    return size == ECCP_TABLE_HEADER_SIZE + (size_t)header->entries * sizeof( eccp_point_affine_t );
+}
+#endif
+
+/**
+ * Maps a table file written by eccp_table_save read-only into memory and uses it as
+ * pre-computation table of the base point, the table is shared with all processes
+ * that map the same file. The header and the checksum (which covers the prime and
+ * the base point) are verified before mapping and param are modified. A previous
+ * mapping of the handle is released if (and only if) the new file is mapped.
+ * Only available on POSIX systems, fails otherwise.
+ * @param mapping the handle that keeps the mapping until eccp_table_unmap
+ * @param path the name of the table file
+ * @param param elliptic curve parameters, base_point_precomputed_table,
+ * base_point_precomputed_table_width and eccp_mul_base_point are set if successful
+ * @return 1 if successful, 0 otherwise
+ */
+int eccp_table_map( eccp_table_mapping_t *mapping, const char *path, eccp_parameters_t *param ) {
+#ifdef ECCP_TABLE_MMAP
+    const eccp_table_header_t *header;
+    const eccp_point_affine_t *table;
+    eccp_table_checksum_t checksum;
+    struct stat status;
+    void *base;
+    size_t size;
+    int fd, valid;
+
+    fd = open( path, O_RDONLY );
+    if( fd < 0 ) {
+        return 0;
+    }
+    if( fstat( fd, &status ) != 0 || status.st_size < ECCP_TABLE_HEADER_SIZE ) {
+        close( fd );
+        return 0;
+    }
+    size = (size_t)status.st_size;
+    base = mmap( NULL, size, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd ); // the mapping stays valid
+    if( base == MAP_FAILED ) {
+        return 0;
+    }
+
+    header = (const eccp_table_header_t *)base;
+    table = (const eccp_point_affine_t *)( (const uint8_t *)base + ECCP_TABLE_HEADER_SIZE );
+    valid = eccp_table_header_matches( header, size, param );
+    if( valid ) {
+        eccp_table_checksum_header( &checksum, header, param );
+        eccp_table_checksum_update( &checksum, table, header->entries * sizeof( eccp_point_affine_t ) );
+        valid = eccp_table_checksum_final( &checksum ) == header->checksum;
+    }
+    if( !valid ) {
+        munmap( base, size );
+        return 0;
+    }
+
+    if( mapping->base != NULL ) {
+        munmap( mapping->base, mapping->length );
+    }
+    mapping->base = base;
+    mapping->length = size;
+    param->base_point_precomputed_table = table;
+    param->base_point_precomputed_table_width = header->width;
+    switch( header->algorithm ) {
+    case ECCP_TABLE_COMB:
+        param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB;
+        break;
+    case ECCP_TABLE_COMB_WOZ:
+        param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB_WOZ;
+        break;
+    default:
+        param->eccp_mul_base_point = &eccp_std_projective_point_multiply_COMB_LL;
+        break;
+    }
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Releases a table mapped with eccp_table_map, does nothing if the handle holds no
+ * mapping. If param uses the released table, its pre-computation of the base point
+ * is reset (param->eccp_mul_base_point is set to NULL), tables that were not mapped
+ * (e.g. the ones of param_load) are left untouched.
+ * @param mapping the handle passed to eccp_table_map (holds no mapping afterwards)
+ * @param param elliptic curve parameters
+ */
+void eccp_table_unmap( eccp_table_mapping_t *mapping, eccp_parameters_t *param ) {
+    if( mapping->base == NULL ) {
+        return;
+    }
+    if( (const uint8_t *)param->base_point_precomputed_table == (const uint8_t *)mapping->base + ECCP_TABLE_HEADER_SIZE ) {
+        param->base_point_precomputed_table = NULL;
+        param->base_point_precomputed_table_width = 0;
+        param->eccp_mul_base_point = NULL;
+    }
+#ifdef ECCP_TABLE_MMAP
+    munmap( mapping->base, mapping->length );
+#endif
+    mapping->base = NULL;
+    mapping->length = 0;
+}
@@ -0,0 +1,273 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "flecc_in_c/gfp/gfp_chain.h"
+#include "flecc_in_c/bi/bi.h"
+#include "flecc_in_c/gfp/gfp_gen.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+// Addition chains for the fixed exponents of the standardized curves. The long runs of ones of an exponent are
+// computed as x^(2^k - 1), these values are built first (temp[1] and following), afterwards the exponent is
+// processed from its most significant bit using a single accumulator (the last temporary).
+// clang-format off
+// exponent p - 2: 191 squarings, 13 multiplications
+static const gfp_chain_step_t SECP192R1_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 0, 1}, {4, 3, 2, 3}, {5, 4, 0, 1}, {6, 5, 4, 7}, {7, 6, 6, 15}, {8, 7, 7, 30},
+    {9, 8, 8, 60}, {9, 9, 4, 7}, {9, 9, 8, 61}, {9, 9, 1, 2}, {9, 9, 0, 2}
+};
+static const gfp_chain_t SECP192R1_INVERSE_CHAIN = {SECP192R1_INVERSE_STEPS, 13, 10};
+
+// exponent n - 2: 191 squarings, 34 multiplications
+static const gfp_chain_step_t SECP192R1_ORDER_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 0, 1}, {4, 3, 0, 1}, {5, 4, 2, 3}, {6, 5, 5, 8}, {7, 6, 6, 16}, {8, 7, 7, 32},
+    {8, 8, 7, 32}, {8, 8, 0, 1}, {8, 8, 1, 4}, {8, 8, 2, 5}, {8, 8, 3, 5}, {8, 8, 4, 6}, {8, 8, 1, 7}, {8, 8, 1, 3},
+    {8, 8, 0, 5}, {8, 8, 0, 2}, {8, 8, 1, 5}, {8, 8, 0, 2}, {8, 8, 3, 5}, {8, 8, 0, 3}, {8, 8, 1, 4}, {8, 8, 1, 3},
+    {8, 8, 1, 5}, {8, 8, 1, 3}, {8, 8, 0, 2}, {8, 8, 1, 4}, {8, 8, 0, 2}, {8, 8, 0, 3}, {8, 8, 0, 4}, {8, 8, 0, 2},
+    {8, 8, 0, 6}, {8, 8, 3, 5}
+};
+static const gfp_chain_t SECP192R1_ORDER_INVERSE_CHAIN = {SECP192R1_ORDER_INVERSE_STEPS, 34, 9};
+
+// exponent (p + 1) / 4: 189 squarings, 7 multiplications
+static const gfp_chain_step_t SECP192R1_SQRT_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 1, 2}, {3, 2, 2, 4}, {4, 3, 3, 8}, {5, 4, 4, 16}, {6, 5, 5, 32}, {7, 6, 6, 64},
+    {7, 7, GFP_CHAIN_NONE, 62}
+};
+static const gfp_chain_t SECP192R1_SQRT_CHAIN = {SECP192R1_SQRT_STEPS, 8, 8};
+
+// exponent p - 2: 224 squarings, 11 multiplications
+static const gfp_chain_step_t SECP224R1_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 2, 3}, {4, 3, 3, 6}, {5, 4, 4, 12}, {6, 5, 5, 24}, {7, 6, 6, 48}, {8, 7, 3, 6},
+    {9, 5, 0, 1}, {10, 8, 9, 25}, {10, 10, 7, 97}
+};
+static const gfp_chain_t SECP224R1_INVERSE_CHAIN = {SECP224R1_INVERSE_STEPS, 11, 11};
+
+// exponent n - 2: 223 squarings, 38 multiplications
+static const gfp_chain_step_t SECP224R1_ORDER_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 0, 1}, {4, 3, 0, 1}, {5, 4, 1, 2}, {6, 5, 5, 7}, {7, 6, 6, 14}, {8, 7, 7, 28},
+    {9, 8, 8, 56}, {9, 9, 0, 4}, {9, 9, 1, 3}, {9, 9, 0, 2}, {9, 9, 0, 2}, {9, 9, 0, 4}, {9, 9, 2, 4}, {9, 9, 0, 6},
+    {9, 9, 2, 4}, {9, 9, 3, 7}, {9, 9, 4, 11}, {9, 9, 0, 5}, {9, 9, 3, 6}, {9, 9, 2, 4}, {9, 9, 0, 2}, {9, 9, 0, 3},
+    {9, 9, 0, 2}, {9, 9, 0, 3}, {9, 9, 0, 2}, {9, 9, 0, 4}, {9, 9, 0, 2}, {9, 9, 0, 2}, {9, 9, 2, 4}, {9, 9, 0, 4},
+    {9, 9, 2, 4}, {9, 9, 0, 5}, {9, 9, 0, 2}, {9, 9, 0, 2}, {9, 9, 2, 6}, {9, 9, 1, 3}
+};
+static const gfp_chain_t SECP224R1_ORDER_INVERSE_CHAIN = {SECP224R1_ORDER_INVERSE_STEPS, 38, 10};
+
+// exponent (q - 1) / 2 with p - 1 = 2^96 * q: 126 squarings, 10 multiplications
+static const gfp_chain_step_t SECP224R1_SQRT_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 1, 2}, {4, 3, 3, 5}, {5, 4, 0, 1}, {6, 5, 4, 10}, {7, 6, 6, 21}, {8, 7, 7, 42},
+    {8, 8, 7, 42}, {8, 8, 0, 1}
+};
+static const gfp_chain_t SECP224R1_SQRT_CHAIN = {SECP224R1_SQRT_STEPS, 10, 9};
+
+// exponent p - 2: 255 squarings, 14 multiplications
+static const gfp_chain_step_t SECP256R1_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 1, 2}, {4, 3, 3, 5}, {5, 4, 0, 1}, {6, 5, 4, 10}, {7, 6, 5, 11}, {7, 7, 0, 32},
+    {7, 7, 6, 117}, {7, 7, 6, 21}, {7, 7, 6, 21}, {7, 7, 6, 21}, {7, 7, 4, 10}, {7, 7, 0, 2}
+};
+static const gfp_chain_t SECP256R1_INVERSE_CHAIN = {SECP256R1_INVERSE_STEPS, 14, 8};
+
+// exponent n - 2: 255 squarings, 43 multiplications
+static const gfp_chain_step_t SECP256R1_ORDER_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 0, 1}, {4, 3, 0, 1}, {5, 4, 0, 1}, {6, 5, 1, 2}, {7, 6, 6, 8}, {8, 7, 7, 16},
+    {9, 8, 8, 64}, {9, 9, 8, 32}, {9, 9, 0, 1}, {9, 9, 3, 5}, {9, 9, 2, 5}, {9, 9, 1, 4}, {9, 9, 4, 6}, {9, 9, 0, 2},
+    {9, 9, 0, 2}, {9, 9, 0, 2}, {9, 9, 1, 3}, {9, 9, 1, 3}, {9, 9, 0, 2}, {9, 9, 2, 5}, {9, 9, 0, 4}, {9, 9, 3, 5},
+    {9, 9, 3, 6}, {9, 9, 0, 2}, {9, 9, 0, 5}, {9, 9, 3, 6}, {9, 9, 2, 5}, {9, 9, 2, 4}, {9, 9, 2, 5}, {9, 9, 0, 3},
+    {9, 9, 0, 2}, {9, 9, 1, 3}, {9, 9, 0, 5}, {9, 9, 5, 7}, {9, 9, 1, 5}, {9, 9, 1, 5}, {9, 9, 0, 3}, {9, 9, 0, 3},
+    {9, 9, 0, 2}, {9, 9, 0, 2}, {9, 9, 3, 6}
+};
+static const gfp_chain_t SECP256R1_ORDER_INVERSE_CHAIN = {SECP256R1_ORDER_INVERSE_STEPS, 43, 10};
+
+// exponent (p + 1) / 4: 253 squarings, 7 multiplications
+static const gfp_chain_step_t SECP256R1_SQRT_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 1, 2}, {3, 2, 2, 4}, {4, 3, 3, 8}, {5, 4, 4, 16}, {5, 5, 0, 32}, {5, 5, 0, 96},
+    {5, 5, GFP_CHAIN_NONE, 94}
+};
+static const gfp_chain_t SECP256R1_SQRT_CHAIN = {SECP256R1_SQRT_STEPS, 8, 6};
+
+// exponent p - 2: 383 squarings, 15 multiplications
+static const gfp_chain_step_t SECP384R1_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 0, 1}, {4, 3, 2, 3}, {5, 4, 0, 1}, {6, 5, 4, 7}, {7, 6, 6, 15}, {8, 7, 1, 2},
+    {9, 8, 7, 30}, {10, 9, 9, 62}, {11, 10, 10, 124}, {11, 11, 4, 7}, {11, 11, 8, 33}, {11, 11, 7, 94}, {11, 11, 0, 2}
+};
+static const gfp_chain_t SECP384R1_INVERSE_CHAIN = {SECP384R1_INVERSE_STEPS, 15, 12};
+
+// exponent n - 2: 383 squarings, 61 multiplications
+static const gfp_chain_step_t SECP384R1_ORDER_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 0, 1}, {4, 3, 0, 1}, {5, 4, 2, 3}, {6, 5, 5, 8}, {7, 6, 6, 16}, {8, 7, 7, 32},
+    {9, 8, 8, 64}, {9, 9, 8, 64}, {9, 9, 1, 2}, {9, 9, 2, 6}, {9, 9, 1, 3}, {9, 9, 1, 5}, {9, 9, 0, 2}, {9, 9, 1, 4},
+    {9, 9, 1, 3}, {9, 9, 4, 11}, {9, 9, 0, 2}, {9, 9, 1, 6}, {9, 9, 2, 4}, {9, 9, 0, 3}, {9, 9, 1, 3}, {9, 9, 2, 4},
+    {9, 9, 4, 6}, {9, 9, 0, 2}, {9, 9, 1, 3}, {9, 9, 1, 8}, {9, 9, 0, 2}, {9, 9, 1, 7}, {9, 9, 1, 3}, {9, 9, 1, 3},
+    {9, 9, 0, 3}, {9, 9, 0, 3}, {9, 9, 0, 3}, {9, 9, 0, 4}, {9, 9, 1, 3}, {9, 9, 0, 5}, {9, 9, 0, 2}, {9, 9, 2, 5},
+    {9, 9, 3, 5}, {9, 9, 0, 2}, {9, 9, 2, 4}, {9, 9, 1, 3}, {9, 9, 2, 5}, {9, 9, 1, 3}, {9, 9, 1, 7}, {9, 9, 0, 3},
+    {9, 9, 1, 3}, {9, 9, 0, 2}, {9, 9, 0, 2}, {9, 9, 1, 3}, {9, 9, 1, 4}, {9, 9, 1, 4}, {9, 9, 0, 4}, {9, 9, 0, 2},
+    {9, 9, 0, 3}, {9, 9, 0, 2}, {9, 9, 0, 3}, {9, 9, 2, 4}, {9, 9, 0, 4}
+};
+static const gfp_chain_t SECP384R1_ORDER_INVERSE_CHAIN = {SECP384R1_ORDER_INVERSE_STEPS, 61, 10};
+
+// exponent (p + 1) / 4: 381 squarings, 13 multiplications
+static const gfp_chain_step_t SECP384R1_SQRT_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 1, 2}, {3, 2, 2, 4}, {4, 3, 3, 8}, {5, 4, 4, 16}, {6, 5, 2, 4}, {7, 6, 0, 1}, {8, 7, 6, 36},
+    {9, 8, 8, 73}, {9, 9, 8, 73}, {9, 9, 6, 36}, {9, 9, 5, 33}, {9, 9, 0, 64}, {9, 9, GFP_CHAIN_NONE, 30}
+};
+static const gfp_chain_t SECP384R1_SQRT_CHAIN = {SECP384R1_SQRT_STEPS, 14, 10};
+
+// exponent p - 2: 520 squarings, 13 multiplications
+static const gfp_chain_step_t SECP521R1_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 1, 2}, {3, 2, 2, 4}, {4, 3, 3, 8}, {5, 4, 4, 16}, {6, 5, 5, 32}, {7, 6, 0, 1}, {8, 7, 6, 64},
+    {9, 8, 0, 1}, {10, 9, 8, 129}, {11, 10, 10, 259}, {11, 11, 0, 1}, {11, 11, 0, 2}
+};
+static const gfp_chain_t SECP521R1_INVERSE_CHAIN = {SECP521R1_INVERSE_STEPS, 13, 12};
+
+// exponent n - 2: 520 squarings, 73 multiplications
+static const gfp_chain_step_t SECP521R1_ORDER_INVERSE_STEPS[] = {
+    {1, 0, 0, 1}, {2, 1, 0, 1}, {3, 2, 0, 1}, {4, 3, 0, 1}, {5, 4, 0, 1}, {6, 5, 2, 3}, {7, 6, 3, 4}, {8, 7, 7, 13},
+    {9, 8, 8, 26}, {10, 9, 0, 1}, {11, 10, 9, 52}, {12, 11, 11, 105}, {12, 12, 9, 52}, {12, 12, 0, 2}, {12, 12, 0, 3},
+    {12, 12, 0, 2}, {12, 12, 1, 5}, {12, 12, 1, 6}, {12, 12, 0, 2}, {12, 12, 3, 8}, {12, 12, 2, 8}, {12, 12, 5, 7},
+    {12, 12, 0, 3}, {12, 12, 4, 6}, {12, 12, 0, 3}, {12, 12, 1, 3}, {12, 12, 1, 4}, {12, 12, 0, 2}, {12, 12, 1, 3},
+    {12, 12, 6, 10}, {12, 12, 1, 4}, {12, 12, 0, 10}, {12, 12, 0, 2}, {12, 12, 0, 3}, {12, 12, 3, 7}, {12, 12, 2, 4},
+    {12, 12, 0, 5}, {12, 12, 1, 4}, {12, 12, 0, 2}, {12, 12, 0, 3}, {12, 12, 2, 4}, {12, 12, 0, 2}, {12, 12, 2, 9},
+    {12, 12, 2, 4}, {12, 12, 1, 3}, {12, 12, 0, 2}, {12, 12, 2, 4}, {12, 12, 0, 3}, {12, 12, 1, 4}, {12, 12, 2, 4},
+    {12, 12, 0, 4}, {12, 12, 0, 4}, {12, 12, 1, 4}, {12, 12, 2, 5}, {12, 12, 0, 4}, {12, 12, 3, 7}, {12, 12, 0, 2},
+    {12, 12, 2, 4}, {12, 12, 0, 2}, {12, 12, 2, 4}, {12, 12, 1, 3}, {12, 12, 1, 3}, {12, 12, 4, 6}, {12, 12, 1, 3},
+    {12, 12, 2, 4}, {12, 12, 3, 7}, {12, 12, 0, 2}, {12, 12, 0, 3}, {12, 12, 0, 4}, {12, 12, 2, 5}, {12, 12, 1, 6},
+    {12, 12, 0, 3}, {12, 12, 2, 10}
+};
+static const gfp_chain_t SECP521R1_ORDER_INVERSE_CHAIN = {SECP521R1_ORDER_INVERSE_STEPS, 73, 13};
+
+// exponent (p + 1) / 4: 519 squarings, 0 multiplications
+static const gfp_chain_step_t SECP521R1_SQRT_STEPS[] = {
+    {1, 0, GFP_CHAIN_NONE, 519}
+};
+static const gfp_chain_t SECP521R1_SQRT_CHAIN = {SECP521R1_SQRT_STEPS, 1, 2};
+// clang-format on
+
+/**
+ * Exponentiates a by the fixed exponent described by an addition chain IN CONSTANT TIME.
+ * Uses the representation given by prime_data (see gfp_gen_multiply). Does support a=res.
+ * @param res a^exponent mod prime
+ * @param a the base
+ * @param chain the addition chain of the exponent
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_chain_exponent( gfp_t res, const gfp_t a, const gfp_chain_t *chain, const gfp_prime_data_t *prime_data ) {
+    gfp_t temp[GFP_CHAIN_MAX_TEMPS];
+    gfp_t squared;
+    const gfp_chain_step_t *step;
+    int i;
+
+    assert( chain->temps <= GFP_CHAIN_MAX_TEMPS );
+
+    bigint_copy_var( temp[0], a, prime_data->words );
+    for( i = 0; i < chain->length; i++ ) {
+        step = &chain->steps[i];
+        gfp_gen_square_repeated( squared, temp[step->src], step->squarings, prime_data );
+        if( step->multiplier == GFP_CHAIN_NONE ) {
+            bigint_copy_var( temp[step->dst], squared, prime_data->words );
+        } else {
+            gfp_gen_multiply( temp[step->dst], squared, temp[step->multiplier], prime_data );
+        }
+    }
+    bigint_copy_var( res, temp[chain->steps[chain->length - 1].dst], prime_data->words );
+}
+
+/**
+ * Returns the addition chain of the exponent prime-2 used for inversions.
+ * @param type the type of curve
+ * @return the addition chain or NULL if none is available
+ */
+const gfp_chain_t *gfp_chain_get_inverse( const curve_type_t type ) {
+    switch( type ) {
+    case SECP192R1:
+        return &SECP192R1_INVERSE_CHAIN;
+    case SECP224R1:
+        return &SECP224R1_INVERSE_CHAIN;
+    case SECP256R1:
+        return &SECP256R1_INVERSE_CHAIN;
+    case SECP384R1:
+        return &SECP384R1_INVERSE_CHAIN;
+    case SECP521R1:
+        return &SECP521R1_INVERSE_CHAIN;
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * Returns the addition chain of the exponent n-2 used for inversions modulo the group order.
+ * @param type the type of curve
+ * @return the addition chain or NULL if none is available
+ */
+const gfp_chain_t *gfp_chain_get_order_inverse( const curve_type_t type ) {
+    switch( type ) {
+    case SECP192R1:
+        return &SECP192R1_ORDER_INVERSE_CHAIN;
+    case SECP224R1:
+        return &SECP224R1_ORDER_INVERSE_CHAIN;
+    case SECP256R1:
+        return &SECP256R1_ORDER_INVERSE_CHAIN;
+    case SECP384R1:
+        return &SECP384R1_ORDER_INVERSE_CHAIN;
+    case SECP521R1:
+        return &SECP521R1_ORDER_INVERSE_CHAIN;
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * Returns the addition chain of the square root exponent (see gfp_prime_data_t).
+ * @param type the type of curve
+ * @return the addition chain or NULL if none is available
+ */
+const gfp_chain_t *gfp_chain_get_sqrt( const curve_type_t type ) {
+    switch( type ) {
+    case SECP192R1:
+        return &SECP192R1_SQRT_CHAIN;
+    case SECP224R1:
+        return &SECP224R1_SQRT_CHAIN;
+    case SECP256R1:
+        return &SECP256R1_SQRT_CHAIN;
+    case SECP384R1:
+        return &SECP384R1_SQRT_CHAIN;
+    case SECP521R1:
+        return &SECP521R1_SQRT_CHAIN;
+    default:
+        return NULL;
+    }
+}
@@ -37,6 +37,7 @@
 
 #include "flecc_in_c/bi/bi.h"
 #include "flecc_in_c/gfp/gfp_gen.h"
+#include "flecc_in_c/gfp/gfp_mont.h"
 
 /**
  * Adds two numbers a,b and stores the result in res IN CONSTANT TIME.
@@ -70,6 +71,42 @@ void gfp_cr_subtract( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_d
     bigint_cr_select_2( res, res, temp, carry, prime_data->words );
 }
 
+/**
+ * Montgomery reduction of the double sized product stored in temp_buffer
+ * (reduction part of the SOS method) IN CONSTANT TIME
+ * @param res the result = temp_buffer * R^-1 mod prime
+ * @param temp_buffer the product to reduce (2 * prime_data->words words), gets overwritten
+ * @param prime_data the used prime data needed to do the reduction
+ */
+static void gfp_cr_mont_reduce_sos( gfp_t res, uint_t *temp_buffer, const gfp_prime_data_t *prime_data ) {
+    int i, j;
+    ulong_t product;
+    uint_t global_carry = 0;
+    uint_t carry;
+    uint_t temp;
+    int length = prime_data->words;
+    for( i = 0; i < length; i++ ) {
+        carry = 0;
+        temp = temp_buffer[i] * prime_data->n0;
+        for( j = 0; j < length; j++ ) {
+            product = temp_buffer[i + j];
+            product += (ulong_t)temp * (ulong_t)prime_data->prime[j];
+            product += carry;
+            temp_buffer[i + j] = ( product & UINT_T_MAX );
+            carry = product >> BITS_PER_WORD;
+        }
+        // the carry of the previous row belongs to the same word, add both at once instead of
+        // propagating each carry up to the most significant word
+        product = temp_buffer[i + length];
+        product += carry;
+        product += global_carry;
+        temp_buffer[i + length] = ( product & UINT_T_MAX );
+        global_carry = product >> BITS_PER_WORD;
+    }
+    carry = 1 + bigint_subtract_var( temp_buffer, temp_buffer + length, prime_data->prime, length );
+    bigint_cr_select_2( res, temp_buffer + length, temp_buffer, global_carry | carry, prime_data->words );
+}
+
 /**
  * Montgomery multiplication based on Separated Operand Scanning (SOS) method
  * Koc, ACar, Kaliski "Analyzing and Comparing Montgomery Multiplication
@@ -82,7 +119,6 @@ void gfp_cr_subtract( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_d
 void gfp_cr_mont_multiply_sos( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
     int i, j;
     ulong_t product;
-    uint_t global_carry = 0;
     uint_t carry;
     uint_t temp;
     uint_t temp_buffer[2 * WORDS_PER_GFP];
@@ -100,27 +136,133 @@ void gfp_cr_mont_multiply_sos( gfp_t res, const gfp_t a, const gfp_t b, const gf
         }
         temp_buffer[i + length] = carry;
     }
+    gfp_cr_mont_reduce_sos( res, temp_buffer, prime_data );
+}
+
+/**
+ * Montgomery multiplication based on Coarsely Integrated Operand Scanning
+ * (CIOS) method Koc, ACar, Kaliski "Analyzing and Comparing Montgomery
+ * Multiplication Algorithms" IN CONSTANT TIME. Multiplication and reduction
+ * are interleaved word by word and need only words + 2 words of temporary memory.
+ * @param res the result = a * b * R^-1 mod prime
+ * @param a first operand
+ * @param b second operand
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+void gfp_cr_mont_multiply_cios( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+    int i, j;
+    ulong_t product;
+    uint_t carry;
+    uint_t temp;
+    uint_t temp_buffer[WORDS_PER_GFP + 2];
+    gfp_t difference;
+    int length = prime_data->words;
+    bigint_clear_var( temp_buffer, length + 2 );
     for( i = 0; i < length; i++ ) {
+        // temp_buffer += a * b[i]
         carry = 0;
-        temp = temp_buffer[i] * prime_data->n0;
+        temp = b[i];
         for( j = 0; j < length; j++ ) {
-            product = temp_buffer[i + j];
-            product += (ulong_t)temp * (ulong_t)prime_data->prime[j];
+            product = temp_buffer[j];
+            product += (ulong_t)a[j] * (ulong_t)temp;
             product += carry;
-            temp_buffer[i + j] = ( product & UINT_T_MAX );
+            temp_buffer[j] = ( product & UINT_T_MAX );
             carry = product >> BITS_PER_WORD;
         }
-        // TODO: carry propagation can be optimized
-        for( j = i + length; j < 2 * length; j++ ) {
+        product = (ulong_t)temp_buffer[length] + carry;
+        temp_buffer[length] = ( product & UINT_T_MAX );
+        temp_buffer[length + 1] = product >> BITS_PER_WORD;
+
+        // temp_buffer = ( temp_buffer + m * prime ) / 2^BITS_PER_WORD
+        temp = temp_buffer[0] * prime_data->n0;
+        product = temp_buffer[0];
+        product += (ulong_t)temp * (ulong_t)prime_data->prime[0];
+        carry = product >> BITS_PER_WORD;
+        for( j = 1; j < length; j++ ) {
             product = temp_buffer[j];
+            product += (ulong_t)temp * (ulong_t)prime_data->prime[j];
             product += carry;
-            temp_buffer[j] = ( product & UINT_T_MAX );
+            temp_buffer[j - 1] = ( product & UINT_T_MAX );
             carry = product >> BITS_PER_WORD;
         }
-        global_carry += carry;
+        product = (ulong_t)temp_buffer[length] + carry;
+        temp_buffer[length - 1] = ( product & UINT_T_MAX );
+        temp_buffer[length] = temp_buffer[length + 1] + (uint_t)( product >> BITS_PER_WORD );
     }
-    carry = 1 + bigint_subtract_var( temp_buffer, temp_buffer + length, prime_data->prime, length );
-    bigint_cr_select_2( res, temp_buffer + length, temp_buffer, global_carry | carry, prime_data->words );
+    carry = temp_buffer[length];
+    temp = 1 + bigint_subtract_var( difference, temp_buffer, prime_data->prime, length );
+    bigint_cr_select_2( res, temp_buffer, difference, carry | temp, length );
+}
+
+/**
+ * Montgomery multiplication based on the Finely Integrated Product Scanning
+ * (FIPS, Comba-style column-wise) method Koc, ACar, Kaliski "Analyzing and
+ * Comparing Montgomery Multiplication Algorithms" IN CONSTANT TIME. The
+ * columns of a * b and m * prime are summed up in a three word accumulator.
+ * @param res the result = a * b * R^-1 mod prime
+ * @param a first operand
+ * @param b second operand
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+void gfp_cr_mont_multiply_comba( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+    int i, j;
+    ulong_t product;
+    ulong_t accumulator = 0;
+    uint_t overflow = 0;
+    uint_t carry;
+    uint_t temp_buffer[2 * WORDS_PER_GFP];
+    uint_t *m = temp_buffer;
+    uint_t *difference = temp_buffer + WORDS_PER_GFP;
+    int length = prime_data->words;
+    for( i = 0; i < length; i++ ) {
+        for( j = 0; j < i; j++ ) {
+            product = (ulong_t)a[j] * (ulong_t)b[i - j];
+            accumulator += product;
+            overflow += ( accumulator < product );
+            product = (ulong_t)m[j] * (ulong_t)prime_data->prime[i - j];
+            accumulator += product;
+            overflow += ( accumulator < product );
+        }
+        product = (ulong_t)a[i] * (ulong_t)b[0];
+        accumulator += product;
+        overflow += ( accumulator < product );
+        m[i] = (uint_t)accumulator * prime_data->n0;
+        product = (ulong_t)m[i] * (ulong_t)prime_data->prime[0];
+        accumulator += product;
+        overflow += ( accumulator < product );
+        accumulator = ( accumulator >> BITS_PER_WORD ) | ( (ulong_t)overflow << BITS_PER_WORD );
+        overflow = 0;
+    }
+    for( i = length; i < 2 * length; i++ ) {
+        for( j = i - length + 1; j < length; j++ ) {
+            product = (ulong_t)a[j] * (ulong_t)b[i - j];
+            accumulator += product;
+            overflow += ( accumulator < product );
+            product = (ulong_t)m[j] * (ulong_t)prime_data->prime[i - j];
+            accumulator += product;
+            overflow += ( accumulator < product );
+        }
+        // m[0..i-length] is not needed anymore and gets replaced by the result
+        m[i - length] = ( accumulator & UINT_T_MAX );
+        accumulator = ( accumulator >> BITS_PER_WORD ) | ( (ulong_t)overflow << BITS_PER_WORD );
+        overflow = 0;
+    }
+    carry = accumulator & UINT_T_MAX;
+    overflow = 1 + bigint_subtract_var( difference, m, prime_data->prime, length );
+    bigint_cr_select_2( res, m, difference, carry | overflow, length );
+}
+
+/**
+ * Montgomery squaring based on the SOS method IN CONSTANT TIME. The products
+ * a[i]*a[j] with i != j are computed only once and doubled afterwards.
+ * @param res the result = a * a * R^-1 mod prime
+ * @param a the operand to square
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+void gfp_cr_mont_square_sos( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data ) {
+    uint_t temp_buffer[2 * WORDS_PER_GFP];
+    bigint_square_var( temp_buffer, a, prime_data->words );
+    gfp_cr_mont_reduce_sos( res, temp_buffer, prime_data );
 }
 
 /**
@@ -154,3 +296,166 @@ void gfp_cr_negate( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data
     int is_zero = bigint_cr_is_zero_var( a, prime_data->words );
     bigint_cr_select_2( res, temp, a, is_zero, prime_data->words );
 }
+
+/** the maximum window size of gfp_cr_exponent_fixed_window (2^size precomputed powers) */
+#define GFP_FIXED_WINDOW_MAX 4
+
+/**
+ * Selects table[index] IN CONSTANT TIME by touching every entry of the table.
+ * @param res the selected entry
+ * @param table the table to select from
+ * @param count the number of entries of the table
+ * @param index the index of the entry to select (secret)
+ * @param length the number of words of an entry
+ */
+static void gfp_cr_select_from_table( gfp_t res, const gfp_t *table, const int count, const uint_t index, const int length ) {
+    uint_t difference;
+    int i;
+
+    for( i = 0; i < count; i++ ) {
+        // 1 if i equals index, 0 otherwise
+        difference = (uint_t)i ^ index;
+        difference = 1 ^ ( ( difference | ( 0 - difference ) ) >> ( BITS_PER_WORD - 1 ) );
+        bigint_cr_select_2( res, res, table[i], (int)difference, length );
+    }
+}
+
+/**
+ * Perform a fixed window exponentiation with the given field operations IN CONSTANT TIME.
+ * The sequence of operations only depends on exponent_length, which also determines
+ * the window size. The powers are selected from the table in constant time. Does support a=res.
+ * @param res a^exponent mod prime
+ * @param a the base
+ * @param exponent the (secret) exponent
+ * @param exponent_length the number of words needed to represent the exponent
+ * @param multiply the multiplication used (has to run in constant time)
+ * @param square the squaring used (has to run in constant time)
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_cr_exponent_fixed_window( gfp_t res,
+                                   const gfp_t a,
+                                   const uint_t *exponent,
+                                   const int exponent_length,
+                                   gfp_operation_t multiply,
+                                   gfp_square_operation_t square,
+                                   const gfp_prime_data_t *prime_data ) {
+    gfp_t table[1 << GFP_FIXED_WINDOW_MAX];
+    gfp_t temp, selected;
+    uint_t digit;
+    int i, j, window, digits, bit;
+    const int bits = exponent_length * BITS_PER_WORD;
+
+    // minimize the number of multiplications 2^window + bits/window
+    window = 1;
+    while( window < GFP_FIXED_WINDOW_MAX && ( 1 << ( window + 1 ) ) + bits / ( window + 1 ) < ( 1 << window ) + bits / window ) {
+        window++;
+    }
+    digits = ( bits + window - 1 ) / window;
+
+    // table[i] = a^i
+    bigint_copy_var( table[0], prime_data->gfp_one, prime_data->words );
+    bigint_copy_var( table[1], a, prime_data->words );
+    for( i = 2; i < ( 1 << window ); i++ ) {
+        multiply( table[i], table[i - 1], a, prime_data );
+    }
+
+    bigint_copy_var( temp, prime_data->gfp_one, prime_data->words );
+    for( i = digits - 1; i >= 0; i-- ) {
+        digit = 0;
+        for( j = window - 1; j >= 0; j-- ) {
+            bit = i * window + j;
+            digit <<= 1;
+            if( bit < bits ) {
+                digit |= (uint_t)bigint_test_bit_var( exponent, bit, exponent_length );
+            }
+            if( i != digits - 1 ) {
+                square( temp, temp, prime_data );
+            }
+        }
+        gfp_cr_select_from_table( selected, (const gfp_t *)table, 1 << window, digit, prime_data->words );
+        multiply( temp, temp, selected, prime_data );
+    }
+    bigint_copy_var( res, temp, prime_data->words );
+}
+
+/**
+ * Perform an exponentiation in the representation given by prime_data
+ * (see gfp_gen_multiply) IN CONSTANT TIME using gfp_cr_exponent_fixed_window.
+ * @param res a^exponent mod prime
+ * @param a the base
+ * @param exponent the (secret) exponent
+ * @param exponent_length the number of words needed to represent the exponent
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_cr_exponent(
+    gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data ) {
+    gfp_cr_exponent_fixed_window( res, a, exponent, exponent_length, &gfp_gen_multiply, &gfp_gen_square, prime_data );
+}
+
+/**
+ * Multiplication in Montgomery domain to be passed as gfp_operation_t.
+ * @param res the result = a * b * R^-1 mod prime
+ * @param a first operand
+ * @param b second operand
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+static void gfp_cr_mont_multiply_operation( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+    gfp_mont_multiply( res, a, b, prime_data );
+}
+
+/**
+ * Perform an exponentiation in Montgomery domain IN CONSTANT TIME using gfp_cr_exponent_fixed_window.
+ * @param res a^exponent mod prime (within the Montgomery domain)
+ * @param a the base (within the Montgomery domain)
+ * @param exponent the (secret) exponent
+ * @param exponent_length the number of words needed to represent the exponent
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+void gfp_cr_mont_exponent(
+    gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data ) {
+    gfp_cr_exponent_fixed_window(
+        res, a, exponent, exponent_length, &gfp_cr_mont_multiply_operation, &gfp_cr_mont_square_sos, prime_data );
+}
+
+/**
+ * Inverts count numbers at once IN CONSTANT TIME using Montgomery's trick:
+ * a single (constant time) inversion and 3*(count-1) multiplications
+ * (see gfp_gen_multiply for the representation). Zero elements result in zero.
+ * @param res the inverted numbers (must not overlap with to_invert)
+ * @param to_invert the numbers to invert
+ * @param count the number of elements
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_cr_batch_inverse( gfp_t *res, const gfp_t *to_invert, const int count, const gfp_prime_data_t *prime_data ) {
+    gfp_t inverse, temp, zero;
+    int i, is_zero;
+
+    if( count <= 0 ) {
+        return;
+    }
+
+    // zero elements are replaced by one, res[i] = product of to_invert[0..i]
+    bigint_clear_var( zero, prime_data->words );
+    for( i = 0; i < count; i++ ) {
+        is_zero = bigint_cr_is_equal_var( to_invert[i], zero, prime_data->words );
+        bigint_cr_select_2( temp, to_invert[i], prime_data->gfp_one, is_zero, prime_data->words );
+        if( i == 0 ) {
+            bigint_copy_var( res[0], temp, prime_data->words );
+        } else {
+            gfp_gen_multiply( res[i], res[i - 1], temp, prime_data );
+        }
+    }
+
+    gfp_gen_inverse( inverse, res[count - 1], prime_data );
+    for( i = count - 1; i >= 0; i-- ) {
+        is_zero = bigint_cr_is_equal_var( to_invert[i], zero, prime_data->words );
+        bigint_cr_select_2( temp, to_invert[i], prime_data->gfp_one, is_zero, prime_data->words );
+        if( i > 0 ) {
+            gfp_gen_multiply( res[i], inverse, res[i - 1], prime_data );
+            gfp_gen_multiply( inverse, inverse, temp, prime_data );
+        } else {
+            bigint_copy_var( res[0], inverse, prime_data->words );
+        }
+        bigint_cr_select_2( res[i], res[i], zero, is_zero, prime_data->words );
+    }
+}
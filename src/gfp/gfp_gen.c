@@ -37,6 +37,11 @@
 
 #include "flecc_in_c/gfp/gfp_gen.h"
 #include "flecc_in_c/bi/bi.h"
+#include "flecc_in_c/gfp/gfp_chain.h"
+#include "flecc_in_c/gfp/gfp_mont.h"
+#include "flecc_in_c/gfp/gfp_safegcd.h"
+
+#include <stddef.h>
 
 /**
  * Adds two numbers a,b and stores the result in res. A finite field reduction
@@ -124,6 +129,325 @@ void gfp_gen_multiply_div( gfp_t res, const gfp_t a, const gfp_t b, const gfp_pr
     bigint_copy_var( res, remainder, prime_data->words );
 }
 
+/**
+ * Multiplies two field elements using the representation given by prime_data:
+ * the fast reduction of special primes if available and Montgomery
+ * multiplication otherwise. Runs in constant time if the used multiplication does.
+ * @param res the product (a * b mod prime or a * b * R^-1 mod prime)
+ * @param a first operand
+ * @param b second operand
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_gen_multiply( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+    uint_t product[2 * WORDS_PER_GFP];
+
+    if( prime_data->reduction != NULL ) {
+        bigint_multiply_var( product, a, b, prime_data->words, prime_data->words );
+        prime_data->reduction( res, product, prime_data );
+    } else {
+        gfp_mont_multiply( res, a, b, prime_data );
+    }
+}
+
+/**
+ * Squares a field element using the representation given by prime_data
+ * (see gfp_gen_multiply).
+ * @param res the square (a * a mod prime or a * a * R^-1 mod prime)
+ * @param a the operand to square
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_gen_square( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data ) {
+    uint_t product[2 * WORDS_PER_GFP];
+
+    if( prime_data->reduction != NULL ) {
+        bigint_square_var( product, a, prime_data->words );
+        prime_data->reduction( res, product, prime_data );
+    } else {
+        gfp_mont_square( res, a, prime_data );
+    }
+}
+
+/**
+ * Squares a field element count times in a row (see gfp_gen_square). Does support a=res.
+ * @param res a^(2^count)
+ * @param a the operand to square
+ * @param count the number of squarings (0 copies a)
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_gen_square_repeated( gfp_t res, const gfp_t a, const int count, const gfp_prime_data_t *prime_data ) {
+    int i;
+
+    bigint_copy_var( res, a, prime_data->words );
+    for( i = 0; i < count; i++ ) {
+        gfp_gen_square( res, res, prime_data );
+    }
+}
+
+/** the maximum window size of gfp_exponent_sliding_window (2^(size-1) precomputed powers) */
+#define GFP_SLIDING_WINDOW_MAX 5
+
+/**
+ * Perform a left-to-right sliding window exponentiation with the given field
+ * operations. The window size is chosen from the size of the exponent. Does
+ * support a=res. Is NOT performed in constant time regarding the exponent.
+ * @param res a^exponent mod prime
+ * @param a the base
+ * @param exponent the exponent
+ * @param exponent_length the number of words needed to represent the exponent
+ * @param multiply the multiplication used
+ * @param square the squaring used
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_exponent_sliding_window( gfp_t res,
+                                  const gfp_t a,
+                                  const uint_t *exponent,
+                                  const int exponent_length,
+                                  gfp_operation_t multiply,
+                                  gfp_square_operation_t square,
+                                  const gfp_prime_data_t *prime_data ) {
+    gfp_t table[1 << ( GFP_SLIDING_WINDOW_MAX - 1 )];
+    gfp_t temp;
+    int bit, low, value, window, i;
+    int msb = bigint_get_msb_var( exponent, exponent_length );
+
+    if( msb < 0 ) {
+        bigint_copy_var( res, prime_data->gfp_one, prime_data->words );
+        return;
+    }
+
+    // minimize the number of multiplications 2^(window-1) + bits/(window+1)
+    window = 1;
+    while( window < GFP_SLIDING_WINDOW_MAX
+           && ( 1 << window ) + ( msb + 1 ) / ( window + 2 ) < ( 1 << ( window - 1 ) ) + ( msb + 1 ) / ( window + 1 ) ) {
+        window++;
+    }
+
+    // table[i] = a^(2*i+1)
+    bigint_copy_var( table[0], a, prime_data->words );
+    if( window > 1 ) {
+        square( temp, a, prime_data );
+        for( i = 1; i < ( 1 << ( window - 1 ) ); i++ ) {
+            multiply( table[i], table[i - 1], temp, prime_data );
+        }
+    }
+
+    bigint_copy_var( temp, prime_data->gfp_one, prime_data->words );
+    for( bit = msb; bit >= 0; ) {
+        if( bigint_test_bit_var( exponent, bit, exponent_length ) == 0 ) {
+            square( temp, temp, prime_data );
+            bit--;
+            continue;
+        }
+
+        // the longest window ending with a set bit
+        low = bit - window + 1 < 0 ? 0 : bit - window + 1;
+        while( bigint_test_bit_var( exponent, low, exponent_length ) == 0 ) {
+            low++;
+        }
+        value = 0;
+        for( i = bit; i >= low; i-- ) {
+            value = ( value << 1 ) | bigint_test_bit_var( exponent, i, exponent_length );
+            if( bit != msb ) {
+                square( temp, temp, prime_data );
+            }
+        }
+        if( bit == msb ) {
+            bigint_copy_var( temp, table[value >> 1], prime_data->words );
+        } else {
+            multiply( temp, temp, table[value >> 1], prime_data );
+        }
+        bit = low - 1;
+    }
+    bigint_copy_var( res, temp, prime_data->words );
+}
+
+/**
+ * Perform an exponentiation in the representation given by prime_data
+ * (see gfp_gen_multiply) using gfp_exponent_sliding_window. Does support a=res.
+ * Is NOT performed in constant time regarding the exponent (see gfp_cr_exponent).
+ * @param res a^exponent mod prime
+ * @param a the base
+ * @param exponent the exponent
+ * @param exponent_length the number of words needed to represent the exponent
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_gen_exponent(
+    gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data ) {
+    gfp_exponent_sliding_window( res, a, exponent, exponent_length, &gfp_gen_multiply, &gfp_gen_square, prime_data );
+}
+
+/**
+ * Inverts a number IN CONSTANT TIME in the representation given by prime_data
+ * (see gfp_gen_multiply) using the divstep algorithm of gfp_cr_inverse_safegcd.
+ * @param res the inverted number
+ * @param to_invert the number to invert
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_gen_inverse( gfp_t res, const gfp_t to_invert, const gfp_prime_data_t *prime_data ) {
+    if( prime_data->reduction != NULL ) {
+        gfp_cr_inverse_safegcd( res, to_invert, prime_data );
+    } else {
+        gfp_cr_mont_inverse_safegcd( res, to_invert, prime_data );
+    }
+}
+
+/**
+ * Inverts count numbers at once using Montgomery's trick: a single inversion
+ * and 3*(count-1) multiplications (see gfp_gen_multiply for the representation).
+ * Zero elements are skipped and result in zero. Is NOT performed in constant time
+ * regarding the zero elements (see gfp_cr_batch_inverse).
+ * @param res the inverted numbers (must not overlap with to_invert)
+ * @param to_invert the numbers to invert
+ * @param count the number of elements
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_batch_inverse( gfp_t *res, const gfp_t *to_invert, const int count, const gfp_prime_data_t *prime_data ) {
+    gfp_t inverse, temp;
+    int i, last = -1;
+
+    // res[i] = product of all non-zero to_invert[0..i]
+    for( i = 0; i < count; i++ ) {
+        if( bigint_is_zero_var( to_invert[i], prime_data->words ) ) {
+            continue;
+        }
+        if( last < 0 ) {
+            bigint_copy_var( res[i], to_invert[i], prime_data->words );
+        } else {
+            gfp_gen_multiply( res[i], res[last], to_invert[i], prime_data );
+        }
+        last = i;
+    }
+    for( i = 0; i < count; i++ ) {
+        if( bigint_is_zero_var( to_invert[i], prime_data->words ) ) {
+            bigint_clear_var( res[i], prime_data->words );
+        }
+    }
+    if( last < 0 ) {
+        return;
+    }
+
+    gfp_gen_inverse( inverse, res[last], prime_data );
+    for( i = last - 1; i >= 0; i-- ) {
+        if( bigint_is_zero_var( to_invert[i], prime_data->words ) ) {
+            continue;
+        }
+        // inverse of the product up to to_invert[last] times the product up to to_invert[i]
+        gfp_gen_multiply( temp, inverse, res[i], prime_data );
+        gfp_gen_multiply( inverse, inverse, to_invert[last], prime_data );
+        bigint_copy_var( res[last], temp, prime_data->words );
+        last = i;
+    }
+    bigint_copy_var( res[last], inverse, prime_data->words );
+}
+
+/**
+ * Invert a number by exponentiating it with (prime-2) in the representation
+ * given by prime_data (see gfp_gen_multiply), uses prime_data->inverse_chain if available.
+ * @param res the inverted number
+ * @param to_invert the number to invert
+ * @param prime_data the prime number data to reduce the result
+ */
+void gfp_gen_inverse_fermat( gfp_t res, const gfp_t to_invert, const gfp_prime_data_t *prime_data ) {
+    gfp_t exponent;
+    gfp_t two;
+
+    if( prime_data->inverse_chain != NULL ) {
+        gfp_chain_exponent( res, to_invert, prime_data->inverse_chain, prime_data );
+        return;
+    }
+
+    bigint_copy_var( exponent, prime_data->prime, prime_data->words );
+    bigint_clear_var( two, prime_data->words );
+    two[0] = 2;
+    bigint_subtract_var( exponent, exponent, two, prime_data->words );
+
+    gfp_gen_exponent( res, to_invert, exponent, prime_data->words, prime_data );
+}
+
+/**
+ * Computes a square root in the representation given by prime_data (see gfp_gen_multiply).
+ * Uses a^((prime+1)/4) if prime = 3 mod 4 and the algorithm of Tonelli and Shanks
+ * otherwise, the fixed exponents are computed by prime_data->sqrt_chain if available.
+ * Is NOT performed in constant time if prime = 1 mod 4.
+ * @param res a square root of a (undefined if a is not a square)
+ * @param a the number to compute the square root of
+ * @param prime_data the prime number data to reduce the result
+ * @return 1 if a is a square, 0 otherwise
+ */
+int gfp_gen_sqrt( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data ) {
+    gfp_t exponent;
+    gfp_t root, b, c, temp;
+    int s, m, i, length = prime_data->words;
+
+    if( ( prime_data->prime[0] & 3 ) == 3 ) {
+        if( prime_data->sqrt_chain != NULL ) {
+            gfp_chain_exponent( root, a, prime_data->sqrt_chain, prime_data );
+        } else {
+            // (prime+1)/4 = (prime>>2)+1 avoids an overflow of prime+1
+            bigint_shift_right_var( exponent, prime_data->prime, 2, length );
+            bigint_clear_var( temp, length );
+            temp[0] = 1;
+            bigint_add_var( exponent, exponent, temp, length );
+            gfp_gen_exponent( root, a, exponent, length, prime_data );
+        }
+        gfp_gen_square( temp, root, prime_data );
+        bigint_copy_var( res, root, length );
+        return bigint_is_equal_var( temp, a, length );
+    }
+
+    if( bigint_is_zero_var( a, length ) ) {
+        bigint_clear_var( res, length );
+        return 1;
+    }
+
+    // prime - 1 = 2^s * q with q odd, exponent = (q-1)/2
+    for( s = 1; bigint_test_bit_var( prime_data->prime, s, length ) == 0; s++ ) {
+    }
+    bigint_shift_right_var( exponent, prime_data->prime, s + 1, length );
+
+    // root = a^((q+1)/2), b = a^q
+    if( prime_data->sqrt_chain != NULL ) {
+        gfp_chain_exponent( temp, a, prime_data->sqrt_chain, prime_data );
+    } else {
+        gfp_gen_exponent( temp, a, exponent, length, prime_data );
+    }
+    gfp_gen_multiply( root, temp, a, prime_data );
+    gfp_gen_multiply( b, root, temp, prime_data );
+
+    // c = z^q for the smallest non-square z > 1
+    bigint_shift_right_var( exponent, prime_data->prime, 1, length );
+    gfp_gen_add( c, prime_data->gfp_one, prime_data->gfp_one, prime_data );
+    for( ;; ) {
+        gfp_gen_exponent( temp, c, exponent, length, prime_data );
+        gfp_gen_add( temp, temp, prime_data->gfp_one, prime_data );
+        if( bigint_is_zero_var( temp, length ) ) {
+            break;
+        }
+        gfp_gen_add( c, c, prime_data->gfp_one, prime_data );
+    }
+    bigint_shift_right_var( exponent, prime_data->prime, s, length );
+    gfp_gen_exponent( c, c, exponent, length, prime_data );
+
+    m = s;
+    while( !bigint_is_equal_var( b, prime_data->gfp_one, length ) ) {
+        // find the least i with b^(2^i) = 1
+        bigint_copy_var( temp, b, length );
+        for( i = 0; i < m && !bigint_is_equal_var( temp, prime_data->gfp_one, length ); i++ ) {
+            gfp_gen_square( temp, temp, prime_data );
+        }
+        if( i == m ) {
+            return 0;
+        }
+        gfp_gen_square_repeated( temp, c, m - i - 1, prime_data );
+        gfp_gen_multiply( root, root, temp, prime_data );
+        gfp_gen_square( c, temp, prime_data );
+        gfp_gen_multiply( b, b, c, prime_data );
+        m = i;
+    }
+    bigint_copy_var( res, root, length );
+    return 1;
+}
+
 /**
  * Stupidly calculate a-=prime until a < prime
  * @param a the parameter to reduce
@@ -37,8 +37,11 @@
 
 #include "flecc_in_c/gfp/gfp_mont.h"
 #include "flecc_in_c/bi/bi.h"
+#include "flecc_in_c/gfp/gfp_chain.h"
 #include "flecc_in_c/gfp/gfp_gen.h"
 
+#include <stddef.h>
+
 /**
  * Convert a normal number (mod p) into the montgomery domain.
  * @param res the resulting number
@@ -63,37 +66,19 @@ void gfp_montgomery_to_normal( gfp_t res, const gfp_t src, const gfp_prime_data_
 }
 
 /**
- * Montgomery multiplication based on Separated Operand Scanning (SOS) method
- * Koc, ACar, Kaliski "Analyzing and Comparing Montgomery Multiplication
- * Algorithms"
- * @param res the result = a * b * R^-1 mod prime
- * @param a first operand
- * @param b second operand
- * @param prime_data the used prime data needed to do the multiplication
+ * Montgomery reduction of the double sized product stored in temp_buffer
+ * (reduction part of the SOS method)
+ * @param res the result = temp_buffer * R^-1 mod prime
+ * @param temp_buffer the product to reduce (2 * prime_data->words words), gets overwritten
+ * @param prime_data the used prime data needed to do the reduction
  */
-void gfp_mont_multiply_sos( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+static void gfp_mont_reduce_sos( gfp_t res, uint_t *temp_buffer, const gfp_prime_data_t *prime_data ) {
     int i, j;
     ulong_t product;
     uint_t global_carry = 0;
     uint_t carry;
     uint_t temp;
-    uint_t temp_buffer[2 * WORDS_PER_GFP];
     int length = prime_data->words;
-    for( i = 0; i < length; i++ ) {
-        temp_buffer[i] = 0;
-    }
-    for( i = 0; i < length; i++ ) {
-        carry = 0;
-        temp = a[i];
-        for( j = 0; j < length; j++ ) {
-            product = temp_buffer[i + j];
-            product += (ulong_t)temp * (ulong_t)b[j];
-            product += carry;
-            temp_buffer[i + j] = ( product & UINT_T_MAX );
-            carry = product >> BITS_PER_WORD;
-        }
-        temp_buffer[i + length] = carry;
-    }
     for( i = 0; i < length; i++ ) {
         carry = 0;
         temp = temp_buffer[i] * prime_data->n0;
@@ -120,6 +105,53 @@ void gfp_mont_multiply_sos( gfp_t res, const gfp_t a, const gfp_t b, const gfp_p
     }
 }
 
+/**
+ * Montgomery multiplication based on Separated Operand Scanning (SOS) method
+ * Koc, ACar, Kaliski "Analyzing and Comparing Montgomery Multiplication
+ * Algorithms"
+ * @param res the result = a * b * R^-1 mod prime
+ * @param a first operand
+ * @param b second operand
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+void gfp_mont_multiply_sos( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+    int i, j;
+    ulong_t product;
+    uint_t carry;
+    uint_t temp;
+    uint_t temp_buffer[2 * WORDS_PER_GFP];
+    int length = prime_data->words;
+    for( i = 0; i < length; i++ ) {
+        temp_buffer[i] = 0;
+    }
+    for( i = 0; i < length; i++ ) {
+        carry = 0;
+        temp = a[i];
+        for( j = 0; j < length; j++ ) {
+            product = temp_buffer[i + j];
+            product += (ulong_t)temp * (ulong_t)b[j];
+            product += carry;
+            temp_buffer[i + j] = ( product & UINT_T_MAX );
+            carry = product >> BITS_PER_WORD;
+        }
+        temp_buffer[i + length] = carry;
+    }
+    gfp_mont_reduce_sos( res, temp_buffer, prime_data );
+}
+
+/**
+ * Montgomery squaring based on the SOS method. The products a[i]*a[j] with
+ * i != j are computed only once and doubled afterwards.
+ * @param res the result = a * a * R^-1 mod prime
+ * @param a the operand to square
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+void gfp_mont_square_sos( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data ) {
+    uint_t temp_buffer[2 * WORDS_PER_GFP];
+    bigint_square_var( temp_buffer, a, prime_data->words );
+    gfp_mont_reduce_sos( res, temp_buffer, prime_data );
+}
+
 /**
  * Calculate the montgomery inverse for the given globally defined constants
  * based on Hankerson p. 42
@@ -183,7 +215,8 @@ void gfp_mont_inverse_binary( gfp_t res, const gfp_t a, const gfp_prime_data_t *
 }
 
 /**
- * Invert a number by exponentiating it with (prime-2)
+ * Invert a number by exponentiating it with (prime-2), uses
+ * prime_data->inverse_chain if available
  * @param res the inverted number
  * @param to_invert the number to invert
  * @param prime_data the prime number data to reduce the result
@@ -192,6 +225,11 @@ void gfp_mont_inverse_fermat( gfp_t res, const gfp_t to_invert, const gfp_prime_
     gfp_t exponent;
     gfp_t two;
 
+    if( prime_data->inverse_chain != NULL ) {
+        gfp_chain_exponent( res, to_invert, prime_data->inverse_chain, prime_data );
+        return;
+    }
+
     bigint_copy_var( exponent, prime_data->prime, prime_data->words );
     bigint_clear_var( two, prime_data->words );
     two[0] = 2;
@@ -201,7 +239,20 @@ void gfp_mont_inverse_fermat( gfp_t res, const gfp_t to_invert, const gfp_prime_
 }
 
 /**
- * Perform an exponentiation with a custom modulus and custom length. Does support a=res.
+ * Multiplication in Montgomery domain to be passed as gfp_operation_t.
+ * @param res the result = a * b * R^-1 mod prime
+ * @param a first operand
+ * @param b second operand
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+static void gfp_mont_multiply_operation( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+    gfp_mont_multiply( res, a, b, prime_data );
+}
+
+/**
+ * Perform an exponentiation with a custom modulus and custom length using
+ * gfp_exponent_sliding_window. Does support a=res. Is NOT performed in
+ * constant time regarding the exponent (see gfp_cr_mont_exponent).
  * @param res a^exponent mod modulus
  * @param a
  * @param exponent
@@ -210,17 +261,8 @@ void gfp_mont_inverse_fermat( gfp_t res, const gfp_t to_invert, const gfp_prime_
  */
 void gfp_mont_exponent(
     gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data ) {
-    gfp_t temp;
-    int bit;
-
-    bigint_copy_var( temp, prime_data->gfp_one, prime_data->words );
-    for( bit = bigint_get_msb_var( exponent, exponent_length ); bit >= 0; bit-- ) {
-        gfp_mont_multiply( temp, temp, temp, prime_data );
-        if( bigint_test_bit_var( exponent, bit, exponent_length ) == 1 ) {
-            gfp_mont_multiply( temp, temp, a, prime_data );
-        }
-    }
-    bigint_copy_var( res, temp, prime_data->words );
+    gfp_exponent_sliding_window(
+        res, a, exponent, exponent_length, &gfp_mont_multiply_operation, &gfp_cr_mont_square_sos, prime_data );
 }
 
 /**
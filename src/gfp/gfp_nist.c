@@ -0,0 +1,224 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "flecc_in_c/gfp/gfp_nist.h"
+#include "flecc_in_c/bi/bi.h"
+#include "flecc_in_c/gfp/gfp_p521.h"
+
+#include <stddef.h>
+
+/** the i-th 32-bit chunk of the double sized product */
+#if( BYTES_PER_WORD == 4 )
+#define C( i ) ( (int64_t)product[i] )
+#else
+#define C( i ) ( (int64_t)(uint32_t)( product[( i ) >> 1] >> ( ( ( i ) & 1 ) << 5 ) ) )
+#endif
+
+/**
+ * Converts the signed 32-bit columns of a Solinas reduction into the final
+ * result IN CONSTANT TIME. The columns are propagated in three rounds, the
+ * carry beyond the prime size of each round is folded back using
+ * 2^bits = delta mod prime. The first carry is a small signed multiple, and as
+ * it times delta is far below 2^bits, the second carry is -1, 0 or 1. If it is
+ * not zero, the chunks of the second round lie at the opposite end of
+ * [0, 2^bits) and folding it back keeps the value in that range, the third
+ * round only propagates the folded columns and ends without carry. The result
+ * is then smaller than 2^bits < 2 * prime and a single conditional subtraction
+ * suffices.
+ * @param res the reduced result
+ * @param column the signed columns (count 32-bit columns, get overwritten)
+ * @param count the number of 32-bit columns (bits of the prime / 32)
+ * @param delta pairs of column index and sign representing 2^bits - prime
+ * @param delta_count the number of pairs in delta
+ * @param prime_data the prime data of the used prime
+ */
+static void gfp_nist_normalize( uint_t *res,
+                                int64_t *column,
+                                const int count,
+                                const int8_t *delta,
+                                const int delta_count,
+                                const gfp_prime_data_t *prime_data ) {
+    uint32_t chunk[2 * WORDS_PER_GFP];
+    int64_t carry;
+    gfp_t temp;
+    int i, round;
+    int length = prime_data->words;
+
+    for( round = 0; round < 3; round++ ) {
+        carry = 0;
+        for( i = 0; i < count; i++ ) {
+            carry += column[i];
+            chunk[i] = (uint32_t)carry;
+            // exact division, avoids the implementation defined shift of negative numbers
+            carry = ( carry - (int64_t)chunk[i] ) / ( (int64_t)1 << 32 );
+            column[i] = chunk[i];
+        }
+        for( i = 0; i < delta_count; i++ ) {
+            column[delta[2 * i]] += delta[2 * i + 1] * carry;
+        }
+    }
+
+    // pack the 32-bit chunks into words
+    chunk[count] = 0;
+    for( i = 0; i < length; i++ ) {
+#if( BYTES_PER_WORD == 4 )
+        res[i] = chunk[i];
+#else
+        res[i] = ( (uint_t)chunk[2 * i + 1] << 32 ) | chunk[2 * i];
+#endif
+    }
+
+    carry = 1 + bigint_subtract_var( temp, res, prime_data->prime, length );
+    bigint_cr_select_2( res, res, temp, (int)carry, length );
+}
+
+/**
+ * Fast reduction modulo the NIST prime p192 = 2^192 - 2^64 - 1 IN CONSTANT TIME
+ * (FIPS 186-4, D.2.1)
+ * @param res the reduced result = product mod p192
+ * @param product the double sized product to reduce
+ * @param prime_data the prime data of p192
+ */
+void gfp_nist_reduce_p192( uint_t *res, const uint_t *product, const gfp_prime_data_t *prime_data ) {
+    static const int8_t delta[] = {0, 1, 2, 1};
+    int64_t column[6];
+
+    column[0] = C( 0 ) + C( 6 ) + C( 10 );
+    column[1] = C( 1 ) + C( 7 ) + C( 11 );
+    column[2] = C( 2 ) + C( 6 ) + C( 8 ) + C( 10 );
+    column[3] = C( 3 ) + C( 7 ) + C( 9 ) + C( 11 );
+    column[4] = C( 4 ) + C( 8 ) + C( 10 );
+    column[5] = C( 5 ) + C( 9 ) + C( 11 );
+
+    gfp_nist_normalize( res, column, 6, delta, 2, prime_data );
+}
+
+/**
+ * Fast reduction modulo the NIST prime p224 = 2^224 - 2^96 + 1 IN CONSTANT TIME
+ * (FIPS 186-4, D.2.2)
+ * @param res the reduced result = product mod p224
+ * @param product the double sized product to reduce
+ * @param prime_data the prime data of p224
+ */
+void gfp_nist_reduce_p224( uint_t *res, const uint_t *product, const gfp_prime_data_t *prime_data ) {
+    static const int8_t delta[] = {0, -1, 3, 1};
+    int64_t column[7];
+
+    column[0] = C( 0 ) - C( 7 ) - C( 11 );
+    column[1] = C( 1 ) - C( 8 ) - C( 12 );
+    column[2] = C( 2 ) - C( 9 ) - C( 13 );
+    column[3] = C( 3 ) + C( 7 ) + C( 11 ) - C( 10 );
+    column[4] = C( 4 ) + C( 8 ) + C( 12 ) - C( 11 );
+    column[5] = C( 5 ) + C( 9 ) + C( 13 ) - C( 12 );
+    column[6] = C( 6 ) + C( 10 ) - C( 13 );
+
+    gfp_nist_normalize( res, column, 7, delta, 2, prime_data );
+}
+
+/**
+ * Fast reduction modulo the NIST prime p256 = 2^256 - 2^224 + 2^192 + 2^96 - 1 IN CONSTANT TIME
+ * (FIPS 186-4, D.2.3)
+ * @param res the reduced result = product mod p256
+ * @param product the double sized product to reduce
+ * @param prime_data the prime data of p256
+ */
+void gfp_nist_reduce_p256( uint_t *res, const uint_t *product, const gfp_prime_data_t *prime_data ) {
+    static const int8_t delta[] = {0, 1, 3, -1, 6, -1, 7, 1};
+    int64_t column[8];
+
+    column[0] = C( 0 ) + C( 8 ) + C( 9 ) - C( 11 ) - C( 12 ) - C( 13 ) - C( 14 );
+    column[1] = C( 1 ) + C( 9 ) + C( 10 ) - C( 12 ) - C( 13 ) - C( 14 ) - C( 15 );
+    column[2] = C( 2 ) + C( 10 ) + C( 11 ) - C( 13 ) - C( 14 ) - C( 15 );
+    column[3] = C( 3 ) + 2 * C( 11 ) + 2 * C( 12 ) + C( 13 ) - C( 8 ) - C( 9 ) - C( 15 );
+    column[4] = C( 4 ) + 2 * C( 12 ) + 2 * C( 13 ) + C( 14 ) - C( 9 ) - C( 10 );
+    column[5] = C( 5 ) + 2 * C( 13 ) + 2 * C( 14 ) + C( 15 ) - C( 10 ) - C( 11 );
+    column[6] = C( 6 ) + C( 13 ) + 3 * C( 14 ) + 2 * C( 15 ) - C( 8 ) - C( 9 );
+    column[7] = C( 7 ) + C( 8 ) + 3 * C( 15 ) - C( 10 ) - C( 11 ) - C( 12 ) - C( 13 );
+
+    gfp_nist_normalize( res, column, 8, delta, 4, prime_data );
+}
+
+/**
+ * Fast reduction modulo the NIST prime p384 = 2^384 - 2^128 - 2^96 + 2^32 - 1 IN CONSTANT TIME
+ * (FIPS 186-4, D.2.4)
+ * @param res the reduced result = product mod p384
+ * @param product the double sized product to reduce
+ * @param prime_data the prime data of p384
+ */
+void gfp_nist_reduce_p384( uint_t *res, const uint_t *product, const gfp_prime_data_t *prime_data ) {
+    static const int8_t delta[] = {0, 1, 1, -1, 3, 1, 4, 1};
+    int64_t column[12];
+
+    column[0] = C( 0 ) + C( 12 ) + C( 20 ) + C( 21 ) - C( 23 );
+    column[1] = C( 1 ) + C( 13 ) + C( 22 ) + C( 23 ) - C( 12 ) - C( 20 );
+    column[2] = C( 2 ) + C( 14 ) + C( 23 ) - C( 13 ) - C( 21 );
+    column[3] = C( 3 ) + C( 12 ) + C( 15 ) + C( 20 ) + C( 21 ) - C( 14 ) - C( 22 ) - C( 23 );
+    column[4] = C( 4 ) + C( 12 ) + C( 13 ) + C( 16 ) + C( 20 ) + 2 * C( 21 ) + C( 22 ) - C( 15 ) - 2 * C( 23 );
+    column[5] = C( 5 ) + C( 13 ) + C( 14 ) + C( 17 ) + C( 21 ) + 2 * C( 22 ) + C( 23 ) - C( 16 );
+    column[6] = C( 6 ) + C( 14 ) + C( 15 ) + C( 18 ) + C( 22 ) + 2 * C( 23 ) - C( 17 );
+    column[7] = C( 7 ) + C( 15 ) + C( 16 ) + C( 19 ) + C( 23 ) - C( 18 );
+    column[8] = C( 8 ) + C( 16 ) + C( 17 ) + C( 20 ) - C( 19 );
+    column[9] = C( 9 ) + C( 17 ) + C( 18 ) + C( 21 ) - C( 20 );
+    column[10] = C( 10 ) + C( 18 ) + C( 19 ) + C( 22 ) - C( 21 );
+    column[11] = C( 11 ) + C( 19 ) + C( 20 ) + C( 23 ) - C( 22 );
+
+    gfp_nist_normalize( res, column, 12, delta, 4, prime_data );
+}
+
+/**
+ * Returns the fast reduction for the given curve if its prime is one of the
+ * generalized Mersenne primes standardized by NIST.
+ * @param type the type of curve
+ * @return the reduction function or NULL if none is available
+ */
+gfp_reduction_t gfp_nist_get_reduction( const curve_type_t type ) {
+    switch( type ) {
+    case SECP192R1:
+        return &gfp_nist_reduce_p192;
+    case SECP224R1:
+        return &gfp_nist_reduce_p224;
+    case SECP256R1:
+        return &gfp_nist_reduce_p256;
+    case SECP384R1:
+        return &gfp_nist_reduce_p384;
+    case SECP521R1:
+        return &gfp_p521_reduce;
+    default:
+        return NULL;
+    }
+}
@@ -0,0 +1,88 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "flecc_in_c/gfp/gfp_p521.h"
+#include "flecc_in_c/bi/bi.h"
+
+/** the number of bits of p521 within the most significant word */
+#define P521_TOP_BITS ( 521 & ( BITS_PER_WORD - 1 ) )
+
+/** mask of the bits of p521 within the most significant word */
+#define P521_TOP_MASK ( ( (uint_t)1 << P521_TOP_BITS ) - 1 )
+
+/**
+ * Fast reduction modulo the Mersenne prime p521 = 2^521 - 1 IN CONSTANT TIME
+ * (FIPS 186-4, D.2.5). As 2^521 = 1 mod p521, the bits above 2^521 are shifted
+ * down and added to the lower half, the single carry bit of that sum is added
+ * once more and a final conditional subtraction yields the result.
+ * @param res the reduced result = product mod p521
+ * @param product the double sized product to reduce (smaller than p521^2)
+ * @param prime_data the prime data of p521
+ */
+void gfp_p521_reduce( uint_t *res, const uint_t *product, const gfp_prime_data_t *prime_data ) {
+    const int length = prime_data->words;
+    const uint_t *high = product + length - 1;
+    gfp_t temp;
+    ulong_t sum = 0;
+    uint_t carry;
+    int i;
+
+    // res = (product mod 2^521) + (product >> 521), smaller than 2^522
+    for( i = 0; i < length - 1; i++ ) {
+        sum += product[i];
+        sum += ( high[i] >> P521_TOP_BITS ) | ( high[i + 1] << ( BITS_PER_WORD - P521_TOP_BITS ) );
+        res[i] = (uint_t)sum;
+        sum >>= BITS_PER_WORD;
+    }
+    sum += product[length - 1] & P521_TOP_MASK;
+    sum += high[length - 1] >> P521_TOP_BITS;
+    res[length - 1] = (uint_t)sum;
+
+    // fold bit 521 back, afterwards res <= p521
+    carry = res[length - 1] >> P521_TOP_BITS;
+    res[length - 1] &= P521_TOP_MASK;
+    sum = carry;
+    for( i = 0; i < length; i++ ) {
+        sum += res[i];
+        res[i] = (uint_t)sum;
+        sum >>= BITS_PER_WORD;
+    }
+
+    carry = 1 + bigint_subtract_var( temp, res, prime_data->prime, length );
+    bigint_cr_select_2( res, res, temp, (int)carry, length );
+}
@@ -0,0 +1,317 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "flecc_in_c/gfp/gfp_safegcd.h"
+#include "flecc_in_c/bi/bi.h"
+#include "flecc_in_c/gfp/gfp_mont.h"
+
+/** the number of bits per signed limb (and the number of divsteps per batch) */
+#define LIMB_BITS 30
+
+/** mask of the bits of a signed limb */
+#define LIMB_MASK ( ( (int32_t)1 << LIMB_BITS ) - 1 )
+
+/** the maximum number of signed limbs needed for a gfp_t (one more for the sign) */
+#define MAX_LIMBS ( MIN_BITS_PER_GFP / LIMB_BITS + 1 )
+
+/** arithmetic shift right by LIMB_BITS, avoids the implementation defined shift of negative numbers */
+#define SHIFT_LIMB( x ) ( ( ( x ) - ( ( x ) & LIMB_MASK ) ) / ( (int64_t)1 << LIMB_BITS ) )
+
+/** all bits set if the signed 32-bit number x is negative, 0 otherwise */
+#define SIGN_MASK( x ) ( -(int32_t)( (uint32_t)( x ) >> 31 ) )
+
+/** transition matrix of LIMB_BITS divsteps, scaled by 2^LIMB_BITS */
+typedef struct {
+    int32_t u, v, q, r;
+} gfp_safegcd_matrix_t;
+
+/**
+ * Converts a big integer into signed limbs of LIMB_BITS bits.
+ * @param res the signed limbs
+ * @param a the big integer to convert
+ * @param limbs the number of signed limbs
+ * @param words the number of words of a
+ */
+static void gfp_safegcd_to_limbs( int32_t *res, const uint_t *a, const int limbs, const int words ) {
+    int i, bit, word, offset;
+    uint_t value;
+
+    for( i = 0; i < limbs; i++ ) {
+        bit = i * LIMB_BITS;
+        word = bit >> LD_BITS_PER_WORD;
+        offset = bit & ( BITS_PER_WORD - 1 );
+        value = 0;
+        if( word < words ) {
+            value = a[word] >> offset;
+            if( offset > BITS_PER_WORD - LIMB_BITS && word + 1 < words ) {
+                value |= a[word + 1] << ( BITS_PER_WORD - offset );
+            }
+        }
+        res[i] = (int32_t)( value & LIMB_MASK );
+    }
+}
+
+/**
+ * Converts normalized (non-negative) signed limbs back into a big integer.
+ * @param res the big integer
+ * @param a the signed limbs to convert
+ * @param limbs the number of signed limbs
+ * @param words the number of words of res
+ */
+static void gfp_safegcd_from_limbs( uint_t *res, const int32_t *a, const int limbs, const int words ) {
+    int i, bit, word, offset;
+
+    bigint_clear_var( res, words );
+    for( i = 0; i < limbs; i++ ) {
+        bit = i * LIMB_BITS;
+        word = bit >> LD_BITS_PER_WORD;
+        offset = bit & ( BITS_PER_WORD - 1 );
+        if( word < words ) {
+            res[word] |= (uint_t)(uint32_t)a[i] << offset;
+            if( offset > BITS_PER_WORD - LIMB_BITS && word + 1 < words ) {
+                res[word + 1] |= (uint_t)(uint32_t)a[i] >> ( BITS_PER_WORD - offset );
+            }
+        }
+    }
+}
+
+/**
+ * Performs LIMB_BITS divsteps on the least significant bits of f and g IN CONSTANT TIME.
+ * @param eta the negated delta of the divstep algorithm
+ * @param f the least significant bits of f (odd)
+ * @param g the least significant bits of g
+ * @param t the resulting transition matrix
+ * @return the updated eta
+ */
+static int32_t gfp_safegcd_divsteps( int32_t eta, uint32_t f, uint32_t g, gfp_safegcd_matrix_t *t ) {
+    uint32_t u = 1, v = 0, q = 0, r = 1;
+    uint32_t c1, c2, x, y, z;
+    int i;
+
+    for( i = 0; i < LIMB_BITS; i++ ) {
+        // c1: eta < 0 (delta > 0), c2: g is odd
+        c1 = -( (uint32_t)eta >> 31 );
+        c2 = -( g & 1 );
+        x = ( f ^ c1 ) - c1;
+        y = ( u ^ c1 ) - c1;
+        z = ( v ^ c1 ) - c1;
+        g += x & c2;
+        q += y & c2;
+        r += z & c2;
+        // swap (and negate eta) if both conditions hold
+        c1 &= c2;
+        eta = (int32_t)( ( (uint32_t)eta ^ c1 ) - ( c1 + 1 ) );
+        f += g & c1;
+        u += q & c1;
+        v += r & c1;
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+    t->u = (int32_t)u;
+    t->v = (int32_t)v;
+    t->q = (int32_t)q;
+    t->r = (int32_t)r;
+    return eta;
+}
+
+/**
+ * Applies the transition matrix to f and g: [f, g] = t * [f, g] / 2^LIMB_BITS.
+ * @param f the signed limbs of f
+ * @param g the signed limbs of g
+ * @param t the transition matrix
+ * @param limbs the number of signed limbs
+ */
+static void gfp_safegcd_update_fg( int32_t *f, int32_t *g, const gfp_safegcd_matrix_t *t, const int limbs ) {
+    int64_t cf, cg;
+    int i;
+
+    cf = (int64_t)t->u * f[0] + (int64_t)t->v * g[0];
+    cg = (int64_t)t->q * f[0] + (int64_t)t->r * g[0];
+    cf = SHIFT_LIMB( cf );
+    cg = SHIFT_LIMB( cg );
+    for( i = 1; i < limbs; i++ ) {
+        cf += (int64_t)t->u * f[i] + (int64_t)t->v * g[i];
+        cg += (int64_t)t->q * f[i] + (int64_t)t->r * g[i];
+        f[i - 1] = (int32_t)( cf & LIMB_MASK );
+        g[i - 1] = (int32_t)( cg & LIMB_MASK );
+        cf = SHIFT_LIMB( cf );
+        cg = SHIFT_LIMB( cg );
+    }
+    f[limbs - 1] = (int32_t)cf;
+    g[limbs - 1] = (int32_t)cg;
+}
+
+/**
+ * Applies the transition matrix to d and e modulo the prime:
+ * [d, e] = t * [d, e] / 2^LIMB_BITS mod prime. A multiple of the prime is added
+ * such that the division is exact, d and e stay within (-2 * prime, prime).
+ * @param d the signed limbs of d
+ * @param e the signed limbs of e
+ * @param t the transition matrix
+ * @param prime the signed limbs of the prime
+ * @param prime_inverse prime^-1 mod 2^LIMB_BITS
+ * @param limbs the number of signed limbs
+ */
+static void gfp_safegcd_update_de( int32_t *d,
+                                   int32_t *e,
+                                   const gfp_safegcd_matrix_t *t,
+                                   const int32_t *prime,
+                                   const uint32_t prime_inverse,
+                                   const int limbs ) {
+    int32_t sd, se, md, me;
+    int64_t cd, ce;
+    int i;
+
+    // start with the multiples needed to make negative inputs positive
+    sd = SIGN_MASK( d[limbs - 1] );
+    se = SIGN_MASK( e[limbs - 1] );
+    md = ( t->u & sd ) + ( t->v & se );
+    me = ( t->q & sd ) + ( t->r & se );
+
+    cd = (int64_t)t->u * d[0] + (int64_t)t->v * e[0];
+    ce = (int64_t)t->q * d[0] + (int64_t)t->r * e[0];
+
+    // correct md and me such that the least significant limb becomes zero
+    md -= (int32_t)( ( prime_inverse * (uint32_t)cd + (uint32_t)md ) & LIMB_MASK );
+    me -= (int32_t)( ( prime_inverse * (uint32_t)ce + (uint32_t)me ) & LIMB_MASK );
+    cd += (int64_t)prime[0] * md;
+    ce += (int64_t)prime[0] * me;
+    cd = SHIFT_LIMB( cd );
+    ce = SHIFT_LIMB( ce );
+
+    for( i = 1; i < limbs; i++ ) {
+        cd += (int64_t)t->u * d[i] + (int64_t)t->v * e[i] + (int64_t)prime[i] * md;
+        ce += (int64_t)t->q * d[i] + (int64_t)t->r * e[i] + (int64_t)prime[i] * me;
+        d[i - 1] = (int32_t)( cd & LIMB_MASK );
+        e[i - 1] = (int32_t)( ce & LIMB_MASK );
+        cd = SHIFT_LIMB( cd );
+        ce = SHIFT_LIMB( ce );
+    }
+    d[limbs - 1] = (int32_t)cd;
+    e[limbs - 1] = (int32_t)ce;
+}
+
+/**
+ * Adds the prime to the signed limbs r if mask is set and propagates the carries.
+ * @param r the signed limbs
+ * @param prime the signed limbs of the prime
+ * @param mask all bits set to add the prime, 0 otherwise
+ * @param limbs the number of signed limbs
+ */
+static void gfp_safegcd_add_prime( int32_t *r, const int32_t *prime, const int32_t mask, const int limbs ) {
+    int64_t carry = 0;
+    int i;
+
+    for( i = 0; i < limbs - 1; i++ ) {
+        carry += (int64_t)r[i] + ( prime[i] & mask );
+        r[i] = (int32_t)( carry & LIMB_MASK );
+        carry = SHIFT_LIMB( carry );
+    }
+    r[limbs - 1] = (int32_t)( carry + r[limbs - 1] + ( prime[limbs - 1] & mask ) );
+}
+
+/**
+ * Inverts a number modulo an odd prime IN CONSTANT TIME using the
+ * divstep algorithm of Bernstein and Yang ("Fast constant-time gcd computation
+ * and modular inversion", 2019). The number of divsteps only depends on the
+ * size of the prime, no Montgomery conversion is involved: res = a^-1 mod prime.
+ * The inverse of zero is zero.
+ * @param res the inverted number
+ * @param a the number to invert (smaller than 2^prime_data->bits)
+ * @param prime_data the prime number data (prime_data->prime has to be odd)
+ */
+void gfp_cr_inverse_safegcd( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data ) {
+    int32_t f[MAX_LIMBS], g[MAX_LIMBS], d[MAX_LIMBS], e[MAX_LIMBS], prime[MAX_LIMBS];
+    gfp_safegcd_matrix_t t;
+    uint32_t prime_inverse;
+    int32_t eta = -1, negate;
+    int i, steps;
+    const int limbs = prime_data->bits / LIMB_BITS + 1;
+    const int bits = prime_data->bits;
+
+    // iteration bound of Bernstein and Yang (Theorem 11.2)
+    steps = ( bits < 46 ) ? ( 49 * bits + 57 ) / 17 : ( 49 * bits + 80 ) / 17;
+
+    // prime^-1 mod 2^32 using Newton iterations (correct to 3 bits for odd primes)
+    prime_inverse = (uint32_t)prime_data->prime[0];
+    for( i = 0; i < 4; i++ ) {
+        prime_inverse *= 2 - (uint32_t)prime_data->prime[0] * prime_inverse;
+    }
+
+    gfp_safegcd_to_limbs( prime, prime_data->prime, limbs, prime_data->words );
+    gfp_safegcd_to_limbs( g, a, limbs, prime_data->words );
+    for( i = 0; i < limbs; i++ ) {
+        f[i] = prime[i];
+        d[i] = 0;
+        e[i] = 0;
+    }
+    e[0] = 1;
+
+    for( i = 0; i < steps; i += LIMB_BITS ) {
+        eta = gfp_safegcd_divsteps( eta, (uint32_t)f[0], (uint32_t)g[0], &t );
+        gfp_safegcd_update_de( d, e, &t, prime, prime_inverse, limbs );
+        gfp_safegcd_update_fg( f, g, &t, limbs );
+    }
+
+    // g is zero and f = +-1 now, d * f is the inverse within (-2 * prime, prime)
+    gfp_safegcd_add_prime( d, prime, SIGN_MASK( d[limbs - 1] ), limbs );
+    negate = SIGN_MASK( f[limbs - 1] );
+    for( i = 0; i < limbs; i++ ) {
+        d[i] = ( d[i] ^ negate ) - negate;
+    }
+    gfp_safegcd_add_prime( d, prime, 0, limbs );
+    gfp_safegcd_add_prime( d, prime, SIGN_MASK( d[limbs - 1] ), limbs );
+
+    gfp_safegcd_from_limbs( res, d, limbs, prime_data->words );
+}
+
+/**
+ * Calculates the Montgomery inverse IN CONSTANT TIME using gfp_cr_inverse_safegcd.
+ * @param res the inverse: (a * R)^-1 * R^2 mod prime
+ * @param a the number to invert (within the Montgomery domain)
+ * @param prime_data the used prime data needed to do the multiplication
+ */
+void gfp_cr_mont_inverse_safegcd( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data ) {
+    gfp_t inverse;
+    gfp_t r_cubed;
+
+    gfp_cr_inverse_safegcd( inverse, a, prime_data );
+    gfp_mont_multiply( r_cubed, prime_data->r_squared, prime_data->r_squared, prime_data );
+    gfp_mont_multiply( res, inverse, r_cubed, prime_data );
+}
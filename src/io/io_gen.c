@@ -52,6 +52,17 @@ const char hex_lookup[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a'
  */
 char *print_uint_to_buffer( char *buffer, const uint_t u ) {
 
+#if( BYTES_PER_WORD > 4 )
+    *buffer++ = hex_lookup[( u >> 60 ) & 0xF];
+    *buffer++ = hex_lookup[( u >> 56 ) & 0xF];
+    *buffer++ = hex_lookup[( u >> 52 ) & 0xF];
+    *buffer++ = hex_lookup[( u >> 48 ) & 0xF];
+    *buffer++ = hex_lookup[( u >> 44 ) & 0xF];
+    *buffer++ = hex_lookup[( u >> 40 ) & 0xF];
+    *buffer++ = hex_lookup[( u >> 36 ) & 0xF];
+    *buffer++ = hex_lookup[( u >> 32 ) & 0xF];
+#endif
+
 #if( BYTES_PER_WORD > 2 )
     *buffer++ = hex_lookup[( u >> 28 ) & 0xF];
     *buffer++ = hex_lookup[( u >> 24 ) & 0xF];
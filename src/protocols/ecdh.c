@@ -35,6 +35,7 @@
 **
 ****************************************************************************/
 
+#include "flecc_in_c/bi/bi.h"
 #include "flecc_in_c/eccp/eccp.h"
 #include "flecc_in_c/gfp/gfp.h"
 
@@ -86,3 +87,46 @@ void ecdh_phase_two( eccp_point_affine_t *res,
         gfp_montgomery_to_normal( res->y, res->y, &param->prime_data );
     }
 }
+
+/**
+ * Second phase of a diffie-hellman key exchange that only computes the x coordinate of the
+ * commonly derived point (without y-recovery) and returns it as shared secret
+ * @param shared_x the x coordinate as big-endian byte array (BYTES_PER_BITS(param->prime_data.bits) bytes)
+ * @param scalar ephemeral or static private key (param->order_n_mont_data.prime_data.words large)
+ * @param other_party_point the (ephemeral) public key of the other party (not in Montgomery domain)
+ * @param param elliptic curve parameters
+ * @return 1 if successful, 0 if other_party_point is invalid or the derived point is the identity
+ */
+int ecdh_compute_shared_x( uint8_t *shared_x,
+                           const gfp_t scalar,
+                           const eccp_point_affine_t *other_party_point,
+                           const eccp_parameters_t *param ) {
+    eccp_point_affine_t point;
+    gfp_t x;
+    int bytes = BYTES_PER_BITS( param->prime_data.bits );
+    int i;
+
+    // assume that the other party does not use Montgomery domain
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_normal_to_montgomery( point.x, other_party_point->x, &param->prime_data );
+        gfp_normal_to_montgomery( point.y, other_party_point->y, &param->prime_data );
+    } else {
+        gfp_copy( point.x, other_party_point->x );
+        gfp_copy( point.y, other_party_point->y );
+    }
+    point.identity = other_party_point->identity;
+
+    if( eccp_protected_point_multiply_x( x, &point, scalar, param ) == 0 ) {
+        return 0;
+    }
+
+    // the commonly derived key shall not be in montgomery domain
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_montgomery_to_normal( x, x, &param->prime_data );
+    }
+
+    for( i = 0; i < bytes; i++ ) {
+        shared_x[i] = bigint_get_byte_var( x, param->prime_data.words, bytes - 1 - i );
+    }
+    return 1;
+}
@@ -35,11 +35,16 @@
 **
 ****************************************************************************/
 
+#include "flecc_in_c/protocols/ecdsa.h"
 #include "flecc_in_c/bi/bi.h"
 #include "flecc_in_c/eccp/eccp.h"
 #include "flecc_in_c/gfp/gfp.h"
+#include "flecc_in_c/hash/sha2.h"
 #include "flecc_in_c/utils/rand.h"
 
+#include <assert.h>
+#include <stddef.h>
+
 /**
  * Sign the given hash of a message.
  * @param signature the resulting signature
@@ -130,13 +135,10 @@ int ecdsa_is_valid( const ecdsa_signature_t *signature,
     gfp_mont_multiply( u1, hash_of_message, w, &param->order_n_data ); // u1 = e*s^-1*R*R^-1
     gfp_mont_multiply( w, signature->r, w, &param->order_n_data );     // u2 = r*s^-1*R*R^-1
 
-    // TODO: replace by joint sparse form simultaneous point multiplication
-    // TODO: safe memory
-    eccp_generic_mul_wrapper( &P2, &P1, w, param );
-    eccp_generic_mul_wrapper( &P1, &param->base_point, u1, param );
-    eccp_affine_point_add( &P1, &P1, &P2, param );
+    // u1 and u2 are public, which allows variable-time multiplications
+    eccp_jacobian_double_scalar_multiply( &P2, u1, &param->base_point, w, &P1, param );
 
-    if( P1.identity == 1 ) {
+    if( P2.identity == 1 ) {
         return 0;
     }
 
@@ -144,9 +146,9 @@ int ecdsa_is_valid( const ecdsa_signature_t *signature,
     w[param->order_n_data.words - 1] = 0;
     if( param->prime_data.montgomery_domain == 1 ) {
         // convert to normal basis is necessary
-        gfp_montgomery_to_normal( w, P1.x, &param->prime_data );
+        gfp_montgomery_to_normal( w, P2.x, &param->prime_data );
     } else {
-        bigint_copy_var( w, P1.x, param->prime_data.words );
+        bigint_copy_var( w, P2.x, param->prime_data.words );
     }
     gfp_reduce( w, &param->order_n_data );
 
@@ -156,6 +158,355 @@ int ecdsa_is_valid( const ecdsa_signature_t *signature,
     return 0;
 }
 
+#if ECDSA_BATCH_SIZE + 1 > JCB_INTERLEAVED_MAX_POINTS
+#error "ECDSA_BATCH_SIZE signatures and the base point have to fit into eccp_jacobian_point_multiply_interleaved"
+#endif
+
+/** SHA-256 of arbitrary many big integers, collects the bytes into blocks */
+typedef struct {
+    hash_sha224_256_t state;
+    uint8_t block[64];
+    int length;
+    int total_length;
+} ecdsa_batch_hash_t;
+
+/**
+ * Appends the bytes of a big integer (least significant byte first) to the hash.
+ * @param hash the hash state
+ * @param value the big integer
+ * @param words the length of value in words
+ */
+static void ecdsa_batch_hash_bigint( ecdsa_batch_hash_t *hash, const uint_t *value, const int words ) {
+    int i;
+
+    for( i = 0; i < words * BYTES_PER_WORD; i++ ) {
+        hash->block[hash->length++] = bigint_get_byte_var( value, words, i );
+        if( hash->length == 64 ) {
+            hash_sha2_update( &hash->state, hash->block );
+            hash->length = 0;
+        }
+        hash->total_length++;
+    }
+}
+
+/**
+ * Hashes all signatures, hashes and public keys of a batch into the seed of the weights.
+ * As the weights depend on the whole batch, they are not known before the batch is fixed
+ * and invalid signatures cannot be chosen such that they cancel out in the equation.
+ * @param seed the resulting seed (32 bytes)
+ * @param signatures the signatures to verify
+ * @param hashes the hashes of the messages
+ * @param public_keys the public keys
+ * @param count the number of signatures
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_batch_seed( uint8_t *seed,
+                              const ecdsa_signature_t signatures[],
+                              const gfp_t hashes[],
+                              const eccp_point_affine_t public_keys[],
+                              const int count,
+                              const eccp_parameters_t *param ) {
+    ecdsa_batch_hash_t hash;
+    int i;
+
+    hash_sha256_init( &hash.state );
+    hash.length = 0;
+    hash.total_length = 0;
+    for( i = 0; i < count; i++ ) {
+        ecdsa_batch_hash_bigint( &hash, signatures[i].r, param->order_n_data.words );
+        ecdsa_batch_hash_bigint( &hash, signatures[i].s, param->order_n_data.words );
+        ecdsa_batch_hash_bigint( &hash, hashes[i], param->order_n_data.words );
+        ecdsa_batch_hash_bigint( &hash, public_keys[i].x, param->prime_data.words );
+        ecdsa_batch_hash_bigint( &hash, public_keys[i].y, param->prime_data.words );
+    }
+    hash_sha2_final( &hash.state, hash.block, hash.length, hash.total_length );
+    hash_sha256_to_byte_array( seed, &hash.state );
+}
+
+/**
+ * Derives the odd weight of ECDSA_BATCH_WEIGHT_BITS bits of a signature from
+ * SHA-256(seed || index).
+ * @param weight the resulting weight
+ * @param seed the seed of the batch (32 bytes)
+ * @param index the index of the signature within the batch
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_batch_weight( gfp_t weight, const uint8_t *seed, const int index, const eccp_parameters_t *param ) {
+    hash_sha224_256_t state;
+    uint8_t message[36];
+    uint8_t digest[32];
+    int i;
+
+    for( i = 0; i < 32; i++ ) {
+        message[i] = seed[i];
+    }
+    for( i = 0; i < 4; i++ ) {
+        message[32 + i] = (uint8_t)( index >> ( 24 - 8 * i ) );
+    }
+    hash_sha256_init( &state );
+    hash_sha2_final( &state, message, 36, 36 );
+    hash_sha256_to_byte_array( digest, &state );
+
+    bigint_clear_var( weight, param->order_n_data.words );
+    for( i = 0; i < ECDSA_BATCH_WEIGHT_BITS / 8; i++ ) {
+        bigint_set_byte_var( weight, param->order_n_data.words, i, digest[i] );
+    }
+    weight[0] |= 1;
+}
+
+/**
+ * Returns the position of the least significant set bit.
+ * @param value the value (not zero)
+ * @return the number of trailing zero bits of value
+ */
+static int ecdsa_batch_lowest_bit( const int value ) {
+    int bit = 0;
+
+    while( ( value & ( 1 << bit ) ) == 0 ) {
+        bit++;
+    }
+    return bit;
+}
+
+/**
+ * Multiplies a point with a short public weight of ECDSA_BATCH_WEIGHT_BITS bits
+ * by double-and-add without a final inversion.
+ * @param res the resulting point
+ * @param P the point to multiply
+ * @param weight the weight
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_batch_multiply_weight( eccp_point_projective_t *res,
+                                         const eccp_point_affine_t *P,
+                                         const gfp_t weight,
+                                         const eccp_parameters_t *param ) {
+    int bit = ECDSA_BATCH_WEIGHT_BITS - 1;
+
+    if( bit >= (int)param->order_n_data.bits ) {
+        bit = param->order_n_data.bits - 1;
+    }
+    res->identity = 1;
+    for( ; bit >= 0; bit-- ) {
+        eccp_jacobian_point_double( res, res, param );
+        if( bigint_test_bit_var( weight, bit, param->order_n_data.words ) == 1 ) {
+            eccp_jacobian_point_add_affine( res, res, P, param );
+        }
+    }
+}
+
+/**
+ * Returns 1 if the projective point S equals A or -A.
+ * @param S the point in jacobian coordinates
+ * @param A the affine point
+ * @param param elliptic curve parameters
+ * @return 1 if S equals +-A, otherwise 0
+ */
+static int ecdsa_batch_matches( const eccp_point_projective_t *S, const eccp_point_affine_t *A, const eccp_parameters_t *param ) {
+    gfp_t T1, T2;
+
+    if( S->identity == 1 || gfp_is_zero( S->z ) ) {
+        return A->identity;
+    }
+    if( A->identity == 1 ) {
+        return 0;
+    }
+    gfp_square( T1, S->z );
+    gfp_multiply( T2, A->x, T1 ); // x*Z^2
+    if( !gfp_is_equal( T2, S->x ) ) {
+        return 0;
+    }
+    gfp_multiply( T1, T1, S->z );
+    gfp_multiply( T2, A->y, T1 ); // y*Z^3
+    if( gfp_is_equal( T2, S->y ) ) {
+        return 1;
+    }
+    gfp_negate( T2, T2 );
+    return gfp_is_equal( T2, S->y );
+}
+
+/**
+ * Checks the signatures with a single randomized equation. With the weights z_i,
+ * u1_i = e_i*s_i^-1, u2_i = r_i*s_i^-1 and the points R_i with x coordinate r_i,
+ * (sum z_i*u1_i)*G + sum (z_i*u2_i)*Q_i = sum +-z_i*R_i
+ * holds for valid signatures. The left side is a single interleaved multiplication
+ * that shares one chain of doublings. The signs of the R_i are unknown, they are
+ * found by stepping through all 2^(count-1) combinations in Gray code order.
+ * @param signatures the signatures to verify
+ * @param hashes the hashes of the messages
+ * @param public_keys the public keys (assumed to be not in montgomery domain)
+ * @param count the number of signatures (at most ECDSA_BATCH_SIZE)
+ * @param seed the seed of the weights (see ecdsa_batch_seed)
+ * @param first the index of the first signature within the batch the seed was computed of
+ * @param param elliptic curve parameters
+ * @return 1 if the equation holds, 0 if at least one signature is invalid or cannot be batched
+ */
+static int ecdsa_batch_equation( const ecdsa_signature_t signatures[],
+                                 const gfp_t hashes[],
+                                 const eccp_point_affine_t public_keys[],
+                                 const int count,
+                                 const uint8_t *seed,
+                                 const int first,
+                                 const eccp_parameters_t *param ) {
+    gfp_t scalars[ECDSA_BATCH_SIZE + 1];
+    eccp_point_affine_t points[ECDSA_BATCH_SIZE + 1];
+    eccp_point_projective_t weighted[ECDSA_BATCH_SIZE];
+    eccp_point_affine_t doubled[ECDSA_BATCH_SIZE];
+    uint8_t negated[ECDSA_BATCH_SIZE];
+    eccp_point_affine_t R, A;
+    eccp_point_projective_t sum, left;
+    gfp_t w, z, temp;
+    int i, j, gray;
+
+    assert( count <= ECDSA_BATCH_SIZE );
+
+    bigint_clear_var( scalars[0], param->order_n_data.words );
+    eccp_affine_point_copy( &points[0], &param->base_point, param );
+    sum.identity = 1;
+    for( i = 0; i < count; i++ ) {
+        if( bigint_is_zero_var( signatures[i].r, param->order_n_data.words ) == 1
+            || bigint_is_zero_var( signatures[i].s, param->order_n_data.words ) == 1
+            || bigint_compare_var( signatures[i].r, param->order_n_data.prime, param->order_n_data.words ) >= 0
+            || bigint_compare_var( signatures[i].s, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
+            return 0;
+        }
+
+        eccp_affine_point_copy( &points[i + 1], &public_keys[i], param );
+        if( param->prime_data.montgomery_domain == 1 ) {
+            gfp_normal_to_montgomery( points[i + 1].x, public_keys[i].x, &param->prime_data );
+            gfp_normal_to_montgomery( points[i + 1].y, public_keys[i].y, &param->prime_data );
+        }
+        if( eccp_affine_point_is_valid( &points[i + 1], param ) == 0 || points[i + 1].identity == 1 ) {
+            return 0;
+        }
+
+        // R has the x coordinate r, the rare case of x = r + n is left to ecdsa_is_valid
+        bigint_clear_var( temp, param->prime_data.words );
+        bigint_copy_var( temp, signatures[i].r, param->order_n_data.words );
+        bigint_clear_var( w, param->prime_data.words );
+        bigint_copy_var( w, param->order_n_data.prime, param->order_n_data.words );
+        if( bigint_add_var( w, w, temp, param->prime_data.words ) == 0
+            && bigint_compare_var( w, param->prime_data.prime, param->prime_data.words ) < 0 ) {
+            return 0;
+        }
+        if( param->prime_data.montgomery_domain == 1 ) {
+            gfp_normal_to_montgomery( temp, temp, &param->prime_data );
+        }
+        if( eccp_affine_point_decompress( &R, temp, param ) == 0 ) {
+            return 0;
+        }
+
+        ecdsa_batch_weight( z, seed, first + i, param );
+
+        gfp_normal_to_montgomery( w, signatures[i].s, &param->order_n_data );          // s*R
+        gfp_mont_inverse( w, w, &param->order_n_data );                                // s^-1*R
+        gfp_normal_to_montgomery( temp, z, &param->order_n_data );                     // z*R
+        gfp_mont_multiply( w, temp, w, &param->order_n_data );                         // z*s^-1*R
+        gfp_mont_multiply( scalars[i + 1], signatures[i].r, w, &param->order_n_data ); // z*u2
+        gfp_mont_multiply( temp, hashes[i], w, &param->order_n_data );                 // z*u1
+        gfp_gen_add( scalars[0], scalars[0], temp, &param->order_n_data );
+
+        ecdsa_batch_multiply_weight( &weighted[i], &R, z, param );
+        eccp_jacobian_point_add( &sum, &sum, &weighted[i], param );
+        eccp_jacobian_point_double( &weighted[i], &weighted[i], param );
+        negated[i] = 0;
+    }
+
+    eccp_jacobian_point_multiply_interleaved( &left, (const gfp_t *)scalars, points, count + 1, param );
+    eccp_jacobian_to_affine( &A, &left, param );
+    eccp_jacobian_to_affine_batch( doubled, weighted, count, param );
+
+    if( ecdsa_batch_matches( &sum, &A, param ) ) {
+        return 1;
+    }
+    // the sign of R_0 is covered by comparing with +-sum, every step flips the sign of one R_j
+    for( gray = 1; gray < ( 1 << ( count - 1 ) ); gray++ ) {
+        // the Gray code of gray differs from the one of gray - 1 in its lowest set bit
+        j = 1 + ecdsa_batch_lowest_bit( gray );
+        if( negated[j] == 0 ) {
+            eccp_affine_point_negate( &R, &doubled[j], param );
+            eccp_jacobian_point_add_affine( &sum, &sum, &R, param );
+        } else {
+            eccp_jacobian_point_add_affine( &sum, &sum, &doubled[j], param );
+        }
+        negated[j] ^= 1;
+        if( ecdsa_batch_matches( &sum, &A, param ) ) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Verifies the signatures with ecdsa_batch_equation and locates invalid
+ * signatures by bisection, single signatures are verified with ecdsa_is_valid.
+ * @param valid the verification result of every signature
+ * @param signatures the signatures to verify
+ * @param hashes the hashes of the messages
+ * @param public_keys the public keys (assumed to be not in montgomery domain)
+ * @param count the number of signatures (at most ECDSA_BATCH_SIZE)
+ * @param seed the seed of the weights (see ecdsa_batch_seed)
+ * @param first the index of the first signature within the batch the seed was computed of
+ * @param param elliptic curve parameters
+ * @return the number of invalid signatures
+ */
+static int ecdsa_batch_bisect( uint8_t *valid,
+                               const ecdsa_signature_t signatures[],
+                               const gfp_t hashes[],
+                               const eccp_point_affine_t public_keys[],
+                               const int count,
+                               const uint8_t *seed,
+                               const int first,
+                               const eccp_parameters_t *param ) {
+    int i, half = count / 2;
+
+    if( count == 1 ) {
+        valid[0] = (uint8_t)ecdsa_is_valid( &signatures[0], hashes[0], &public_keys[0], param );
+        return 1 - valid[0];
+    }
+    if( ecdsa_batch_equation( signatures, hashes, public_keys, count, seed, first, param ) == 1 ) {
+        for( i = 0; i < count; i++ ) {
+            valid[i] = 1;
+        }
+        return 0;
+    }
+    return ecdsa_batch_bisect( valid, signatures, hashes, public_keys, half, seed, first, param )
+           + ecdsa_batch_bisect(
+               &valid[half], &signatures[half], &hashes[half], &public_keys[half], count - half, seed, first + half, param );
+}
+
+/**
+ * Verifies a batch of ECDSA signatures. Groups of up to ECDSA_BATCH_SIZE
+ * signatures are checked with a single randomized multi-scalar equation, which
+ * shares the doublings of the verifications of a group. The weights of the
+ * equations are derived from a hash of the whole batch. If the equation of a
+ * group does not hold, the invalid signatures are located by bisection.
+ * @param valid the verification result of every signature (1 if valid, 0 if invalid), may be NULL
+ * @param signatures the signatures to verify
+ * @param hashes the hashes of the messages (smaller than param->order_n_data.prime)
+ * @param public_keys the public keys (assumed to be not in montgomery domain)
+ * @param count the number of signatures
+ * @param param elliptic curve parameters
+ * @return 1 if all signatures are valid, 0 otherwise
+ */
+int ecdsa_batch_is_valid( uint8_t *valid,
+                          const ecdsa_signature_t signatures[],
+                          const gfp_t hashes[],
+                          const eccp_point_affine_t public_keys[],
+                          const int count,
+                          const eccp_parameters_t *param ) {
+    uint8_t group_valid[ECDSA_BATCH_SIZE];
+    uint8_t seed[32];
+    int i, size, invalid = 0;
+
+    ecdsa_batch_seed( seed, signatures, hashes, public_keys, count, param );
+    for( i = 0; i < count; i += ECDSA_BATCH_SIZE ) {
+        size = count - i < ECDSA_BATCH_SIZE ? count - i : ECDSA_BATCH_SIZE;
+        invalid += ecdsa_batch_bisect(
+            valid != NULL ? &valid[i] : group_valid, &signatures[i], &hashes[i], &public_keys[i], size, seed, i, param );
+    }
+    return invalid == 0;
+}
+
 /**
  * Converts the computed hash into a number smaller than order n. (usable for
  * ECDSA)
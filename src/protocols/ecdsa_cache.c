@@ -0,0 +1,288 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "flecc_in_c/protocols/ecdsa_cache.h"
+#include "flecc_in_c/bi/bi.h"
+#include "flecc_in_c/eccp/eccp.h"
+#include "flecc_in_c/gfp/gfp.h"
+#include "flecc_in_c/protocols/ecdsa.h"
+
+#include <stddef.h>
+
+#ifdef ECDSA_CACHE_PTHREAD
+#define ECDSA_CACHE_LOCK( cache ) pthread_mutex_lock( &( cache )->lock )
+#define ECDSA_CACHE_UNLOCK( cache ) pthread_mutex_unlock( &( cache )->lock )
+#else
+#define ECDSA_CACHE_LOCK( cache )
+#define ECDSA_CACHE_UNLOCK( cache )
+#endif
+
+/**
+ * Initializes an empty cache and computes the comb table of the base point.
+ * The cache may only be used with the parameters it was initialized with.
+ * @param cache the cache to initialize
+ * @param param elliptic curve parameters
+ */
+void ecdsa_cache_init( ecdsa_cache_t *cache, const eccp_parameters_t *param ) {
+    int i;
+
+    eccp_jacobian_comb_table_precompute( cache->base_point_table, &param->base_point, ECDSA_CACHE_COMB_WIDTH, param );
+    for( i = 0; i < ECDSA_CACHE_SIZE; i++ ) {
+        cache->keys[i].last_use = 0;
+        cache->keys[i].users = 0;
+        cache->keys[i].valid = 0;
+    }
+    cache->clock = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+#ifdef ECDSA_CACHE_PTHREAD
+    pthread_mutex_init( &cache->lock, NULL );
+#endif
+}
+
+/**
+ * Releases the resources of a cache, it must not be in use anymore.
+ * @param cache the cache to destroy
+ */
+void ecdsa_cache_destroy( ecdsa_cache_t *cache ) {
+#ifdef ECDSA_CACHE_PTHREAD
+    pthread_mutex_destroy( &cache->lock );
+#endif
+}
+
+/**
+ * Returns the number of verifications that found their public key in the cache and
+ * the number of verifications that had to prepare the public key.
+ * @param cache the cache
+ * @param hits the number of hits
+ * @param misses the number of misses
+ */
+void ecdsa_cache_get_statistics( ecdsa_cache_t *cache, unsigned long *hits, unsigned long *misses ) {
+    ECDSA_CACHE_LOCK( cache );
+    *hits = cache->hits;
+    *misses = cache->misses;
+    ECDSA_CACHE_UNLOCK( cache );
+}
+
+/**
+ * Returns 1 if the prepared key belongs to the public key.
+ * @param key the prepared key
+ * @param public_key the public key (not in Montgomery domain)
+ * @param param elliptic curve parameters
+ * @return 1 if the keys match, 0 otherwise
+ */
+static int ecdsa_cache_key_matches( const ecdsa_prepared_key_t *key,
+                                    const eccp_point_affine_t *public_key,
+                                    const eccp_parameters_t *param ) {
+    return key->public_key.identity == public_key->identity
+           && bigint_compare_var( key->public_key.x, public_key->x, param->prime_data.words ) == 0
+           && bigint_compare_var( key->public_key.y, public_key->y, param->prime_data.words ) == 0;
+}
+
+/**
+ * Looks up the public key and reserves its entry. On a miss, the least recently
+ * used entry that is not in use is reserved and has to be prepared by the caller.
+ * @param cache the cache
+ * @param hit set to 1 if the key was found, 0 otherwise
+ * @param public_key the public key (not in Montgomery domain)
+ * @param param elliptic curve parameters
+ * @return the reserved entry or NULL if all entries are in use
+ */
+static ecdsa_prepared_key_t *ecdsa_cache_acquire( ecdsa_cache_t *cache,
+                                                  int *hit,
+                                                  const eccp_point_affine_t *public_key,
+                                                  const eccp_parameters_t *param ) {
+    ecdsa_prepared_key_t *key = NULL, *victim = NULL, *entry;
+    int i;
+
+    ECDSA_CACHE_LOCK( cache );
+    cache->clock++;
+    for( i = 0; i < ECDSA_CACHE_SIZE; i++ ) {
+        entry = &cache->keys[i];
+        if( entry->valid == 1 && ecdsa_cache_key_matches( entry, public_key, param ) ) {
+            key = entry;
+            break;
+        }
+        // empty entries are replaced first, the others by their last use
+        if( entry->users == 0
+            && ( victim == NULL || ( victim->valid == 1 && ( entry->valid == 0 || entry->last_use < victim->last_use ) ) ) ) {
+            victim = entry;
+        }
+    }
+
+    *hit = key != NULL;
+    if( key != NULL ) {
+        cache->hits++;
+    } else {
+        cache->misses++;
+        key = victim;
+        if( key != NULL ) {
+            key->valid = 0;
+        }
+    }
+    if( key != NULL ) {
+        key->users++;
+        key->last_use = cache->clock;
+    }
+    ECDSA_CACHE_UNLOCK( cache );
+    return key;
+}
+
+/**
+ * Returns an entry reserved by ecdsa_cache_acquire.
+ * @param cache the cache
+ * @param key the reserved entry
+ * @param valid 1 if the entry holds a prepared key, 0 if it is empty
+ */
+static void ecdsa_cache_release( ecdsa_cache_t *cache, ecdsa_prepared_key_t *key, const int valid ) {
+    ECDSA_CACHE_LOCK( cache );
+    key->valid = (uint8_t)valid;
+    key->users--;
+    ECDSA_CACHE_UNLOCK( cache );
+}
+
+/**
+ * Validates the public key and computes its comb table.
+ * @param key the entry to fill
+ * @param public_key the public key (not in Montgomery domain)
+ * @param param elliptic curve parameters
+ * @return 1 if the public key is valid, 0 otherwise
+ */
+static int ecdsa_cache_prepare( ecdsa_prepared_key_t *key,
+                                const eccp_point_affine_t *public_key,
+                                const eccp_parameters_t *param ) {
+    eccp_point_affine_t P;
+
+    eccp_affine_point_copy( &P, public_key, param );
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_normal_to_montgomery( P.x, public_key->x, &param->prime_data );
+        gfp_normal_to_montgomery( P.y, public_key->y, &param->prime_data );
+    }
+    if( eccp_affine_point_is_valid( &P, param ) == 0 || P.identity == 1 ) {
+        return 0;
+    }
+
+    eccp_affine_point_copy( &key->public_key, public_key, param );
+    eccp_jacobian_comb_table_precompute( key->table, &P, ECDSA_CACHE_COMB_WIDTH, param );
+    return 1;
+}
+
+/**
+ * Verifies the signature with the comb tables of the base point and the public key.
+ * @param cache the cache (for the table of the base point)
+ * @param key the prepared public key
+ * @param signature the signature to verify (r and s are already checked to be in [1,n-1])
+ * @param hash_of_message the hash of the message
+ * @param param elliptic curve parameters
+ * @return 1 if signature is valid, 0 if signature is invalid
+ */
+static int ecdsa_cache_verify( const ecdsa_cache_t *cache,
+                               const ecdsa_prepared_key_t *key,
+                               const ecdsa_signature_t *signature,
+                               const gfp_t hash_of_message,
+                               const eccp_parameters_t *param ) {
+    gfp_t w, u1;
+    eccp_point_affine_t P;
+
+    gfp_normal_to_montgomery( w, signature->s, &param->order_n_data ); // s*R
+    gfp_mont_inverse( w, w, &param->order_n_data );                    // s^-1*R
+    gfp_mont_multiply( u1, hash_of_message, w, &param->order_n_data ); // u1 = e*s^-1*R*R^-1
+    gfp_mont_multiply( w, signature->r, w, &param->order_n_data );     // u2 = r*s^-1*R*R^-1
+
+    eccp_jacobian_double_scalar_multiply_COMB(
+        &P, u1, cache->base_point_table, w, key->table, ECDSA_CACHE_COMB_WIDTH, param );
+    if( P.identity == 1 ) {
+        return 0;
+    }
+
+    // in case order n and prime have a different length
+    w[param->order_n_data.words - 1] = 0;
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_montgomery_to_normal( w, P.x, &param->prime_data );
+    } else {
+        bigint_copy_var( w, P.x, param->prime_data.words );
+    }
+    gfp_reduce( w, &param->order_n_data );
+
+    return bigint_compare_var( w, signature->r, param->order_n_data.words ) == 0;
+}
+
+/**
+ * Returns 1 if the given ECDSA signature is valid, like ecdsa_is_valid. The public
+ * key is validated and prepared (comb table of its point) once and kept in the
+ * cache, so repeated verifications with the same key get fixed-base speed.
+ * Thread-safe on POSIX systems: the lookups are serialized, the multiplications
+ * run in parallel. Concurrent misses of the same key may prepare it twice.
+ * @param cache the cache, initialized with the same parameters
+ * @param signature the signature to verify
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param public_key the public key used for the verification (assumed to be not in montgomery domain)
+ * @param param elliptic curve parameters
+ * @return 1 if signature is valid, 0 if signature is invalid
+ */
+int ecdsa_is_valid_cached( ecdsa_cache_t *cache,
+                           const ecdsa_signature_t *signature,
+                           const gfp_t hash_of_message,
+                           const eccp_point_affine_t *public_key,
+                           const eccp_parameters_t *param ) {
+    ecdsa_prepared_key_t *key;
+    int hit, valid;
+
+    /* Verify that r and s are integers in the interval [1,n-1]. If any
+     * verification fails then reject the signature */
+    if( bigint_is_zero_var( signature->r, param->order_n_data.words ) == 1
+        || bigint_is_zero_var( signature->s, param->order_n_data.words ) == 1
+        || bigint_compare_var( signature->r, param->order_n_data.prime, param->order_n_data.words ) >= 0
+        || bigint_compare_var( signature->s, param->order_n_data.prime, param->order_n_data.words ) >= 0 ) {
+        return 0;
+    }
+
+    key = ecdsa_cache_acquire( cache, &hit, public_key, param );
+    if( key == NULL ) {
+        // all entries are in use by other threads
+        return ecdsa_is_valid( signature, hash_of_message, public_key, param );
+    }
+    if( hit == 0 && ecdsa_cache_prepare( key, public_key, param ) == 0 ) {
+        ecdsa_cache_release( cache, key, 0 );
+        return 0;
+    }
+
+    valid = ecdsa_cache_verify( cache, key, signature, hash_of_message, param );
+    ecdsa_cache_release( cache, key, 1 );
+    return valid;
+}
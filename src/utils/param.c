@@ -41,58 +41,126 @@
 #include "flecc_in_c/gfp/gfp.h"
 #include <string.h>
 
+// Curve constants are listed as pairs of 32-bit halves so that the same tables serve 32-bit and 64-bit words.
+// a, b and the base point are stored in Montgomery domain; whenever R = 2^(words*BITS_PER_WORD) differs between
+// both word sizes (secp224r1 and secp521r1), a dedicated set of constants is provided.
 // clang-format off
 const uint_t SECP192R1_COFACTOR = 1;
-const uint_t SECP192R1_BASE_X[6] = {0x332FA108, 0x0D8CB30C, 0x76D12909, 0x8A4BD3F7, 0xF3D218F7, 0x954CC8F9};
-const uint_t SECP192R1_BASE_Y[6] = {0x1E422289, 0x7B12A337, 0x8966F05E, 0xDE22B524, 0x6AEDA84D, 0x6A293D83};
-const uint_t SECP192R1_A[6] = {0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
-const uint_t SECP192R1_B[6] = {0xA6E33A98, 0x62D9E406, 0x19076AE2, 0x7281CDB2, 0x57C0B131, 0x73C8EEC5};
+const uint_t SECP192R1_BASE_X[] = {UINT_T_FROM_U32( 0x332FA108, 0x0D8CB30C ), UINT_T_FROM_U32( 0x76D12909, 0x8A4BD3F7 ), UINT_T_FROM_U32( 0xF3D218F7, 0x954CC8F9 )};
+const uint_t SECP192R1_BASE_Y[] = {UINT_T_FROM_U32( 0x1E422289, 0x7B12A337 ), UINT_T_FROM_U32( 0x8966F05E, 0xDE22B524 ), UINT_T_FROM_U32( 0x6AEDA84D, 0x6A293D83 )};
+const uint_t SECP192R1_A[] = {UINT_T_FROM_U32( 0xFFFFFFFC, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFB, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF )};
+const uint_t SECP192R1_B[] = {UINT_T_FROM_U32( 0xA6E33A98, 0x62D9E406 ), UINT_T_FROM_U32( 0x19076AE2, 0x7281CDB2 ), UINT_T_FROM_U32( 0x57C0B131, 0x73C8EEC5 )};
 const uint_t SECP192R1_ORDER_N_BITS = 192;
 const uint_t SECP192R1_PRIME_BITS = 192;
-const uint_t SECP192R1_ORDER_N[6] = {0xB4D22831, 0x146BC9B1, 0x99DEF836, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
-const uint_t SECP192R1_PRIME[6] = {0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
+const uint_t SECP192R1_ORDER_N[] = {UINT_T_FROM_U32( 0xB4D22831, 0x146BC9B1 ), UINT_T_FROM_U32( 0x99DEF836, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF )};
+const uint_t SECP192R1_PRIME[] = {UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFE, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF )};
 
 const uint_t SECP224R1_COFACTOR = 1;
-const uint_t SECP224R1_BASE_X[7] = {0xBC905227, 0x6018BFAA, 0xF22FE220, 0xF96BEC04, 0x6DD3AF9B, 0xA21B5E60, 0x92F5B516};
-const uint_t SECP224R1_BASE_Y[7] = {0x2EDCA1E6, 0x05335A6B, 0xE8C15513, 0x03DFE878, 0xAEA9C5AE, 0x614786F1, 0x100C1218};
-const uint_t SECP224R1_A[7] = {0x00000004, 0x00000000, 0x00000000, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
-const uint_t SECP224R1_B[7] = {0xE768CDF7, 0xCCF01310, 0x743B1CC0, 0xC8528150, 0x3DCEBA98, 0x7FC02F93, 0x9C3FA633};
+#if BYTES_PER_WORD == 4
+const uint_t SECP224R1_BASE_X[] = {UINT_T_FROM_U32( 0xBC905227, 0x6018BFAA ), UINT_T_FROM_U32( 0xF22FE220, 0xF96BEC04 ), UINT_T_FROM_U32( 0x6DD3AF9B, 0xA21B5E60 ), UINT_T_FROM_U32( 0x92F5B516, 0x00000000 )};
+#else
+const uint_t SECP224R1_BASE_X[] = {UINT_T_FROM_U32( 0x6D0A4AEA, 0xBC905226 ), UINT_T_FROM_U32( 0x6018BFAA, 0x85259736 ), UINT_T_FROM_U32( 0xF96BEC05, 0x6DD3AF9B ), UINT_T_FROM_U32( 0xA21B5E60, 0x00000000 )};
+#endif
+#if BYTES_PER_WORD == 4
+const uint_t SECP224R1_BASE_Y[] = {UINT_T_FROM_U32( 0x2EDCA1E6, 0x05335A6B ), UINT_T_FROM_U32( 0xE8C15513, 0x03DFE878 ), UINT_T_FROM_U32( 0xAEA9C5AE, 0x614786F1 ), UINT_T_FROM_U32( 0x100C1218, 0x00000000 )};
+#else
+const uint_t SECP224R1_BASE_Y[] = {UINT_T_FROM_U32( 0xEFF3EDE8, 0x2EDCA1E5 ), UINT_T_FROM_U32( 0x05335A6B, 0xF8CD672B ), UINT_T_FROM_U32( 0x03DFE878, 0xAEA9C5AE ), UINT_T_FROM_U32( 0x614786F1, 0x00000000 )};
+#endif
+#if BYTES_PER_WORD == 4
+const uint_t SECP224R1_A[] = {UINT_T_FROM_U32( 0x00000004, 0x00000000 ), UINT_T_FROM_U32( 0x00000000, 0xFFFFFFFC ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0x00000000 )};
+#else
+const uint_t SECP224R1_A[] = {UINT_T_FROM_U32( 0x00000001, 0x00000003 ), UINT_T_FROM_U32( 0x00000000, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFC, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0x00000000 )};
+#endif
+#if BYTES_PER_WORD == 4
+const uint_t SECP224R1_B[] = {UINT_T_FROM_U32( 0xE768CDF7, 0xCCF01310 ), UINT_T_FROM_U32( 0x743B1CC0, 0xC8528150 ), UINT_T_FROM_U32( 0x3DCEBA98, 0x7FC02F93 ), UINT_T_FROM_U32( 0x9C3FA633, 0x00000000 )};
+#else
+const uint_t SECP224R1_B[] = {UINT_T_FROM_U32( 0x63C059CD, 0xE768CDF6 ), UINT_T_FROM_U32( 0xCCF01310, 0x107AC2F3 ), UINT_T_FROM_U32( 0xC8528151, 0x3DCEBA98 ), UINT_T_FROM_U32( 0x7FC02F93, 0x00000000 )};
+#endif
 const uint_t SECP224R1_ORDER_N_BITS = 224;
 const uint_t SECP224R1_PRIME_BITS = 224;
-const uint_t SECP224R1_ORDER_N[7] = {0x5C5C2A3D, 0x13DD2945, 0xE0B8F03E, 0xFFFF16A2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
-const uint_t SECP224R1_PRIME[7] = {0x00000001, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
+const uint_t SECP224R1_ORDER_N[] = {UINT_T_FROM_U32( 0x5C5C2A3D, 0x13DD2945 ), UINT_T_FROM_U32( 0xE0B8F03E, 0xFFFF16A2 ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0x00000000 )};
+const uint_t SECP224R1_PRIME[] = {UINT_T_FROM_U32( 0x00000001, 0x00000000 ), UINT_T_FROM_U32( 0x00000000, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0x00000000 )};
 
 const uint_t SECP256R1_COFACTOR = 1;
-const uint_t SECP256R1_BASE_X[8] = {0x18A9143C, 0x79E730D4, 0x5FEDB601, 0x75BA95FC, 0x77622510, 0x79FB732B, 0xA53755C6, 0x18905F76};
-const uint_t SECP256R1_BASE_Y[8] = {0xCE95560A, 0xDDF25357, 0xBA19E45C, 0x8B4AB8E4, 0xDD21F325, 0xD2E88688, 0x25885D85, 0x8571FF18};
-const uint_t SECP256R1_A[8] = {0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000003, 0x00000000, 0x00000000, 0x00000004, 0xFFFFFFFC};
-const uint_t SECP256R1_B[8] = {0x29C4BDDF, 0xD89CDF62, 0x78843090, 0xACF005CD, 0xF7212ED6, 0xE5A220AB, 0x04874834, 0xDC30061D};
+const uint_t SECP256R1_BASE_X[] = {UINT_T_FROM_U32( 0x18A9143C, 0x79E730D4 ), UINT_T_FROM_U32( 0x5FEDB601, 0x75BA95FC ), UINT_T_FROM_U32( 0x77622510, 0x79FB732B ), UINT_T_FROM_U32( 0xA53755C6, 0x18905F76 )};
+const uint_t SECP256R1_BASE_Y[] = {UINT_T_FROM_U32( 0xCE95560A, 0xDDF25357 ), UINT_T_FROM_U32( 0xBA19E45C, 0x8B4AB8E4 ), UINT_T_FROM_U32( 0xDD21F325, 0xD2E88688 ), UINT_T_FROM_U32( 0x25885D85, 0x8571FF18 )};
+const uint_t SECP256R1_A[] = {UINT_T_FROM_U32( 0xFFFFFFFC, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0x00000003 ), UINT_T_FROM_U32( 0x00000000, 0x00000000 ), UINT_T_FROM_U32( 0x00000004, 0xFFFFFFFC )};
+const uint_t SECP256R1_B[] = {UINT_T_FROM_U32( 0x29C4BDDF, 0xD89CDF62 ), UINT_T_FROM_U32( 0x78843090, 0xACF005CD ), UINT_T_FROM_U32( 0xF7212ED6, 0xE5A220AB ), UINT_T_FROM_U32( 0x04874834, 0xDC30061D )};
 const uint_t SECP256R1_ORDER_N_BITS = 256;
 const uint_t SECP256R1_PRIME_BITS = 256;
-const uint_t SECP256R1_ORDER_N[8] = {0xFC632551, 0xF3B9CAC2, 0xA7179E84, 0xBCE6FAAD, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF};
-const uint_t SECP256R1_PRIME[8] = {0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF};
+const uint_t SECP256R1_ORDER_N[] = {UINT_T_FROM_U32( 0xFC632551, 0xF3B9CAC2 ), UINT_T_FROM_U32( 0xA7179E84, 0xBCE6FAAD ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0x00000000, 0xFFFFFFFF )};
+const uint_t SECP256R1_PRIME[] = {UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0x00000000 ), UINT_T_FROM_U32( 0x00000000, 0x00000000 ), UINT_T_FROM_U32( 0x00000001, 0xFFFFFFFF )};
 
 const uint_t SECP384R1_COFACTOR = 1;
-const uint_t SECP384R1_BASE_X[12] = {0x49C0B528, 0x3DD07566, 0xA0D6CE38, 0x20E378E2, 0x541B4D6E, 0x879C3AFC, 0x59A30EFF, 0x64548684, 0x614EDE2B, 0x812FF723, 0x299E1513, 0x4D3AADC2};
-const uint_t SECP384R1_BASE_Y[12] = {0x4B03A4FE, 0x23043DAD, 0x7BB4A9AC, 0xA1BFA8BF, 0x2E83B050, 0x8BADE756, 0x68F4FFD9, 0xC6C35219, 0x3969A840, 0xDD800226, 0x5A15C5E9, 0x2B78ABC2};
-const uint_t SECP384R1_A[12] = {0xFFFFFFFC, 0x00000003, 0x00000000, 0xFFFFFFFC, 0xFFFFFFFB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
-const uint_t SECP384R1_B[12] = {0x9D412DCC, 0x08118871, 0x7A4C32EC, 0xF729ADD8, 0x1920022E, 0x77F2209B, 0x94938AE2, 0xE3374BEE, 0x1F022094, 0xB62B21F4, 0x604FBFF9, 0xCD08114B};
+const uint_t SECP384R1_BASE_X[] = {UINT_T_FROM_U32( 0x49C0B528, 0x3DD07566 ), UINT_T_FROM_U32( 0xA0D6CE38, 0x20E378E2 ), UINT_T_FROM_U32( 0x541B4D6E, 0x879C3AFC ), UINT_T_FROM_U32( 0x59A30EFF, 0x64548684 ), UINT_T_FROM_U32( 0x614EDE2B, 0x812FF723 ), UINT_T_FROM_U32( 0x299E1513, 0x4D3AADC2 )};
+const uint_t SECP384R1_BASE_Y[] = {UINT_T_FROM_U32( 0x4B03A4FE, 0x23043DAD ), UINT_T_FROM_U32( 0x7BB4A9AC, 0xA1BFA8BF ), UINT_T_FROM_U32( 0x2E83B050, 0x8BADE756 ), UINT_T_FROM_U32( 0x68F4FFD9, 0xC6C35219 ), UINT_T_FROM_U32( 0x3969A840, 0xDD800226 ), UINT_T_FROM_U32( 0x5A15C5E9, 0x2B78ABC2 )};
+const uint_t SECP384R1_A[] = {UINT_T_FROM_U32( 0xFFFFFFFC, 0x00000003 ), UINT_T_FROM_U32( 0x00000000, 0xFFFFFFFC ), UINT_T_FROM_U32( 0xFFFFFFFB, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF )};
+const uint_t SECP384R1_B[] = {UINT_T_FROM_U32( 0x9D412DCC, 0x08118871 ), UINT_T_FROM_U32( 0x7A4C32EC, 0xF729ADD8 ), UINT_T_FROM_U32( 0x1920022E, 0x77F2209B ), UINT_T_FROM_U32( 0x94938AE2, 0xE3374BEE ), UINT_T_FROM_U32( 0x1F022094, 0xB62B21F4 ), UINT_T_FROM_U32( 0x604FBFF9, 0xCD08114B )};
 const uint_t SECP384R1_ORDER_N_BITS = 384;
 const uint_t SECP384R1_PRIME_BITS = 384;
-const uint_t SECP384R1_ORDER_N[12] = {0xCCC52973, 0xECEC196A, 0x48B0A77A, 0x581A0DB2, 0xF4372DDF, 0xC7634D81, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
-const uint_t SECP384R1_PRIME[12] = {0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
+const uint_t SECP384R1_ORDER_N[] = {UINT_T_FROM_U32( 0xCCC52973, 0xECEC196A ), UINT_T_FROM_U32( 0x48B0A77A, 0x581A0DB2 ), UINT_T_FROM_U32( 0xF4372DDF, 0xC7634D81 ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF )};
+const uint_t SECP384R1_PRIME[] = {UINT_T_FROM_U32( 0xFFFFFFFF, 0x00000000 ), UINT_T_FROM_U32( 0x00000000, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFE, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF )};
 
 const uint_t SECP521R1_COFACTOR = 1;
-const uint_t SECP521R1_BASE_X[17] = {0xB331A163, 0x18E172DE, 0x4DFCBF3F, 0xE0C2B521, 0x6F19A459, 0x93D17FD4, 0x947F0EE0, 0x3BF7F3AC, 0xDD50A5AF, 0xB035A69E, 0x90FC1457, 0x9C829FDA, 0x214E3240, 0xB311CADA, 0xE6CF1F65, 0x5B820274, 0x00000103};
-const uint_t SECP521R1_BASE_Y[17] = {0x28460E4A, 0x3B4FE8B3, 0x20445F4A, 0x43513961, 0xB09A9E38, 0x809FD683, 0x2062A85C, 0x4CAF7A13, 0x164BF739, 0x8B939F33, 0x340BD7DE, 0x24ABCDA2, 0xECCC7AA2, 0xDA163E8D, 0x022E452F, 0x3C4D1DE0, 0x000000B5};
-const uint_t SECP521R1_A[17] = {0xFE7FFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000001FF};
-const uint_t SECP521R1_B[17] = {0x8014654F, 0xEA35A81F, 0x78F7A28F, 0xC41E961A, 0x839AB9EF, 0x5E9DD8DF, 0xBD8B2960, 0xA8F63F49, 0xF0AB0C9C, 0xC8C77884, 0xF9DC5A44, 0x2DCCD98A, 0x77516D39, 0xD05B42A0, 0x0FC94D10, 0xB0C70E4D, 0x0000015C};
+#if BYTES_PER_WORD == 4
+const uint_t SECP521R1_BASE_X[] = {UINT_T_FROM_U32( 0xB331A163, 0x18E172DE ), UINT_T_FROM_U32( 0x4DFCBF3F, 0xE0C2B521 ), UINT_T_FROM_U32( 0x6F19A459, 0x93D17FD4 ), UINT_T_FROM_U32( 0x947F0EE0, 0x3BF7F3AC ), UINT_T_FROM_U32( 0xDD50A5AF, 0xB035A69E ), UINT_T_FROM_U32( 0x90FC1457, 0x9C829FDA ), UINT_T_FROM_U32( 0x214E3240, 0xB311CADA ), UINT_T_FROM_U32( 0xE6CF1F65, 0x5B820274 ), UINT_T_FROM_U32( 0x00000103, 0x00000000 )};
+#else
+const uint_t SECP521R1_BASE_X[] = {UINT_T_FROM_U32( 0x81ADC101, 0xB331A163 ), UINT_T_FROM_U32( 0x18E172DE, 0x4DFCBF3F ), UINT_T_FROM_U32( 0xE0C2B521, 0x6F19A459 ), UINT_T_FROM_U32( 0x93D17FD4, 0x947F0EE0 ), UINT_T_FROM_U32( 0x3BF7F3AC, 0xDD50A5AF ), UINT_T_FROM_U32( 0xB035A69E, 0x90FC1457 ), UINT_T_FROM_U32( 0x9C829FDA, 0x214E3240 ), UINT_T_FROM_U32( 0xB311CADA, 0xE6CF1F65 ), UINT_T_FROM_U32( 0x00000074, 0x00000000 )};
+#endif
+#if BYTES_PER_WORD == 4
+const uint_t SECP521R1_BASE_Y[] = {UINT_T_FROM_U32( 0x28460E4A, 0x3B4FE8B3 ), UINT_T_FROM_U32( 0x20445F4A, 0x43513961 ), UINT_T_FROM_U32( 0xB09A9E38, 0x809FD683 ), UINT_T_FROM_U32( 0x2062A85C, 0x4CAF7A13 ), UINT_T_FROM_U32( 0x164BF739, 0x8B939F33 ), UINT_T_FROM_U32( 0x340BD7DE, 0x24ABCDA2 ), UINT_T_FROM_U32( 0xECCC7AA2, 0xDA163E8D ), UINT_T_FROM_U32( 0x022E452F, 0x3C4D1DE0 ), UINT_T_FROM_U32( 0x000000B5, 0x00000000 )};
+#else
+const uint_t SECP521R1_BASE_Y[] = {UINT_T_FROM_U32( 0x5A9E268E, 0x28460E4A ), UINT_T_FROM_U32( 0x3B4FE8B3, 0x20445F4A ), UINT_T_FROM_U32( 0x43513961, 0xB09A9E38 ), UINT_T_FROM_U32( 0x809FD683, 0x2062A85C ), UINT_T_FROM_U32( 0x4CAF7A13, 0x164BF739 ), UINT_T_FROM_U32( 0x8B939F33, 0x340BD7DE ), UINT_T_FROM_U32( 0x24ABCDA2, 0xECCC7AA2 ), UINT_T_FROM_U32( 0xDA163E8D, 0x022E452F ), UINT_T_FROM_U32( 0x000001E0, 0x00000000 )};
+#endif
+#if BYTES_PER_WORD == 4
+const uint_t SECP521R1_A[] = {UINT_T_FROM_U32( 0xFE7FFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0x000001FF, 0x00000000 )};
+#else
+const uint_t SECP521R1_A[] = {UINT_T_FROM_U32( 0xFFFFFFFF, 0xFE7FFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0x000001FF, 0x00000000 )};
+#endif
+#if BYTES_PER_WORD == 4
+const uint_t SECP521R1_B[] = {UINT_T_FROM_U32( 0x8014654F, 0xEA35A81F ), UINT_T_FROM_U32( 0x78F7A28F, 0xC41E961A ), UINT_T_FROM_U32( 0x839AB9EF, 0x5E9DD8DF ), UINT_T_FROM_U32( 0xBD8B2960, 0xA8F63F49 ), UINT_T_FROM_U32( 0xF0AB0C9C, 0xC8C77884 ), UINT_T_FROM_U32( 0xF9DC5A44, 0x2DCCD98A ), UINT_T_FROM_U32( 0x77516D39, 0xD05B42A0 ), UINT_T_FROM_U32( 0x0FC94D10, 0xB0C70E4D ), UINT_T_FROM_U32( 0x0000015C, 0x00000000 )};
+#else
+const uint_t SECP521R1_B[] = {UINT_T_FROM_U32( 0xAE586387, 0x8014654F ), UINT_T_FROM_U32( 0xEA35A81F, 0x78F7A28F ), UINT_T_FROM_U32( 0xC41E961A, 0x839AB9EF ), UINT_T_FROM_U32( 0x5E9DD8DF, 0xBD8B2960 ), UINT_T_FROM_U32( 0xA8F63F49, 0xF0AB0C9C ), UINT_T_FROM_U32( 0xC8C77884, 0xF9DC5A44 ), UINT_T_FROM_U32( 0x2DCCD98A, 0x77516D39 ), UINT_T_FROM_U32( 0xD05B42A0, 0x0FC94D10 ), UINT_T_FROM_U32( 0x0000004D, 0x00000000 )};
+#endif
 const uint_t SECP521R1_ORDER_N_BITS = 521;
 const uint_t SECP521R1_PRIME_BITS = 521;
-const uint_t SECP521R1_ORDER_N[17] = {0x91386409, 0xBB6FB71E, 0x899C47AE, 0x3BB5C9B8, 0xF709A5D0, 0x7FCC0148, 0xBF2F966B, 0x51868783, 0xFFFFFFFA, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000001FF};
-const uint_t SECP521R1_PRIME[17] = {0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000001FF};
+const uint_t SECP521R1_ORDER_N[] = {UINT_T_FROM_U32( 0x91386409, 0xBB6FB71E ), UINT_T_FROM_U32( 0x899C47AE, 0x3BB5C9B8 ), UINT_T_FROM_U32( 0xF709A5D0, 0x7FCC0148 ), UINT_T_FROM_U32( 0xBF2F966B, 0x51868783 ), UINT_T_FROM_U32( 0xFFFFFFFA, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0x000001FF, 0x00000000 )};
+const uint_t SECP521R1_PRIME[] = {UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0xFFFFFFFF, 0xFFFFFFFF ), UINT_T_FROM_U32( 0x000001FF, 0x00000000 )};
 // clang-format on
 
+#ifdef BASE_POINT_TABLES
+// Lim-Lee comb tables of the base points (for eccp_std_projective_point_multiply_COMB_LL),
+// generated at build time by tools/gen_base_point_tables.c (of width BASE_POINT_TABLE_WIDTH,
+// defined by the build system)
+extern const eccp_point_affine_t param_secp192r1_base_point_table[];
+extern const eccp_point_affine_t param_secp224r1_base_point_table[];
+extern const eccp_point_affine_t param_secp256r1_base_point_table[];
+extern const eccp_point_affine_t param_secp384r1_base_point_table[];
+extern const eccp_point_affine_t param_secp521r1_base_point_table[];
+
+/**
+ * Returns the comb table of the base point generated at build time.
+ * @param type the type of curve
+ * @return the table or NULL if there is none for this type of curve
+ */
+static const eccp_point_affine_t *param_get_base_point_table( const curve_type_t type ) {
+    switch( type ) {
+    case SECP192R1:
+        return param_secp192r1_base_point_table;
+    case SECP224R1:
+        return param_secp224r1_base_point_table;
+    case SECP256R1:
+        return param_secp256r1_base_point_table;
+    case SECP384R1:
+        return param_secp384r1_base_point_table;
+    case SECP521R1:
+        return param_secp521r1_base_point_table;
+    default:
+        return NULL;
+    }
+}
+#endif
+
 /**
  * Compare two buffers which both have length limitations.
  * @param buffer1
@@ -333,9 +401,53 @@ void param_load( eccp_parameters_t *param, const curve_type_t type ) {
         return;
     }
 
+    param->prime_data.reduction = NULL;
+    param->order_n_data.reduction = NULL;
+    param->prime_data.inverse_chain = gfp_chain_get_inverse( type );
+    param->prime_data.sqrt_chain = gfp_chain_get_sqrt( type );
+    param->order_n_data.inverse_chain = gfp_chain_get_order_inverse( type );
+    param->order_n_data.sqrt_chain = NULL;
+#ifdef GFP_FAST_REDUCTION
+    // generalized Mersenne primes are reduced directly, the elements are kept in normal basis
+    param->prime_data.reduction = gfp_nist_get_reduction( type );
+#endif
+    if( param->prime_data.reduction != NULL ) {
+        gfp_montgomery_to_normal( param->param_a, param->param_a, &param->prime_data );
+        gfp_montgomery_to_normal( param->param_b, param->param_b, &param->prime_data );
+        gfp_montgomery_to_normal( param->base_point.x, param->base_point.x, &param->prime_data );
+        gfp_montgomery_to_normal( param->base_point.y, param->base_point.y, &param->prime_data );
+        bigint_clear_var( param->prime_data.gfp_one, param->prime_data.words );
+        param->prime_data.gfp_one[0] = 1;
+        param->prime_data.montgomery_domain = 0;
+    }
+
+    param->param_a_is_minus_three = param_is_a_minus_three( param );
     param->curve_type = type;
     param->eccp_mul = &eccp_protected_point_multiply;
     param->eccp_mul_base_point = NULL;
     param->base_point_precomputed_table = NULL;
     param->base_point_precomputed_table_width = 0;
+#ifdef BASE_POINT_TABLES
+    // the tables were generated at build time, no pre-computation is needed
+    param->base_point_precomputed_table = param_get_base_point_table( type );
+    if( param->base_point_precomputed_table != NULL ) {
+        param->base_point_precomputed_table_width = BASE_POINT_TABLE_WIDTH;
+        param->eccp_mul_base_point = &eccp_std_projective_point_multiply_COMB_LL;
+    }
+#endif
+}
+
+/**
+ * Checks whether the curve parameter a equals -3 (mod prime), which allows
+ * cheaper point doublings (see eccp_parameters_t.param_a_is_minus_three).
+ * @param param elliptic curve parameters (param_a and prime_data have to be set)
+ * @return 1 if a = -3, 0 otherwise
+ */
+int param_is_a_minus_three( const eccp_parameters_t *param ) {
+    gfp_t temp;
+
+    gfp_add( temp, param->param_a, param->prime_data.gfp_one );
+    gfp_add( temp, temp, param->prime_data.gfp_one );
+    gfp_add( temp, temp, param->prime_data.gfp_one );
+    return gfp_is_zero( temp );
 }
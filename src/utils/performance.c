@@ -38,6 +38,10 @@
 #include "flecc_in_c/bi/bi_gen.h"
 #include "flecc_in_c/eccp/eccp.h"
 #include "flecc_in_c/gfp/gfp.h"
+#include "flecc_in_c/protocols/ecdh.h"
+#include "flecc_in_c/protocols/ecdsa.h"
+#include "flecc_in_c/protocols/ecdsa_cache.h"
+#include "flecc_in_c/protocols/eckeygen.h"
 #include "flecc_in_c/utils/rand.h"
 #include <math.h>
 #include <stdio.h>
@@ -100,6 +104,161 @@ void performance_test_eccp_mul( eccp_parameters_t *param ) {
     performance_print_statistics( runtime );
 }
 
+/**
+ * checks the performance of the fixed-base scalar multiplication param->eccp_mul_base_point
+ * @param param the curve parameters including the pre-computation table
+ */
+void performance_test_eccp_mul_base_point( eccp_parameters_t *param ) {
+    eccp_point_affine_t point;
+    gfp_t scalar;
+    clock_t runtime[NUM_ITERATIONS];
+    int run_number;
+    clock_t start_time, stop_time;
+
+    for( run_number = 0; run_number < NUM_ITERATIONS; run_number++ ) {
+        gfp_rand( scalar, &param->order_n_data );
+        start_time = clock();
+        param->eccp_mul_base_point( &point, scalar, param );
+        stop_time = clock();
+        runtime[run_number] = stop_time - start_time;
+    }
+    performance_print_statistics( runtime );
+}
+
+/**
+ * checks the performance of selecting entries of a table of affine points, either
+ * in constant time with eccp_affine_table_select_ct or by direct indexing
+ * (the runtime of 100 selections is measured at once)
+ * @param param the curve parameters
+ * @param size the number of entries of the table (at most 256)
+ * @param constant_time 1 to use eccp_affine_table_select_ct, 0 to use direct indexing
+ */
+void performance_test_eccp_table_select( eccp_parameters_t *param, const int size, const int constant_time ) {
+    eccp_point_affine_t table[256];
+    eccp_point_affine_t point;
+    uint_t index[100];
+    clock_t runtime[NUM_ITERATIONS];
+    int run_number, i;
+    clock_t start_time, stop_time;
+
+    for( i = 0; i < size; i++ ) {
+        eccp_affine_point_copy( &table[i], &param->base_point, param );
+    }
+
+    for( run_number = 0; run_number < NUM_ITERATIONS; run_number++ ) {
+        bigint_rand_insecure_var( index, 100 );
+        for( i = 0; i < 100; i++ ) {
+            index[i] %= size;
+        }
+        start_time = clock();
+        for( i = 0; i < 100; i++ ) {
+            if( constant_time == 1 ) {
+                eccp_affine_table_select_ct( &point, table, size, index[i], param );
+            } else {
+                eccp_affine_point_copy( &point, &table[index[i]], param );
+            }
+        }
+        stop_time = clock();
+        runtime[run_number] = stop_time - start_time;
+    }
+    performance_print_statistics( runtime );
+}
+
+/**
+ * checks the performance of the second phase of a diffie-hellman key exchange
+ * @param param the curve parameters to use
+ * @param x_only 1 to use ecdh_compute_shared_x, 0 to use ecdh_phase_two
+ */
+void performance_test_ecdh( eccp_parameters_t *param, const int x_only ) {
+    eccp_point_affine_t other_party_point, point, result;
+    uint8_t shared_x[BYTES_PER_GFP];
+    gfp_t private_key, scalar;
+    clock_t runtime[NUM_ITERATIONS];
+    int run_number;
+    clock_t start_time, stop_time;
+
+    eckeygen( private_key, &other_party_point, param );
+
+    for( run_number = 0; run_number < NUM_ITERATIONS; run_number++ ) {
+        gfp_rand( scalar, &param->order_n_data );
+        // ecdh_phase_two converts the point of the other party in place
+        eccp_affine_point_copy( &point, &other_party_point, param );
+        start_time = clock();
+        if( x_only == 1 ) {
+            if( ecdh_compute_shared_x( shared_x, scalar, &point, param ) == 0 ) {
+                printf( "ERROR: key exchange failed\n" );
+            }
+        } else {
+            ecdh_phase_two( &result, scalar, &point, param );
+        }
+        stop_time = clock();
+        runtime[run_number] = stop_time - start_time;
+    }
+    performance_print_statistics( runtime );
+}
+
+/**
+ * checks the performance of the ECDSA signature verification
+ * @param param the curve parameters to sign and verify with
+ */
+void performance_test_ecdsa_verify( eccp_parameters_t *param ) {
+    ecdsa_signature_t signature;
+    eccp_point_affine_t public_key;
+    gfp_t private_key, hash;
+    clock_t runtime[NUM_ITERATIONS];
+    int run_number;
+    clock_t start_time, stop_time;
+
+    eckeygen( private_key, &public_key, param );
+
+    for( run_number = 0; run_number < NUM_ITERATIONS; run_number++ ) {
+        gfp_rand( hash, &param->order_n_data );
+        ecdsa_sign( &signature, hash, private_key, param );
+        start_time = clock();
+        if( ecdsa_is_valid( &signature, hash, &public_key, param ) == 0 ) {
+            printf( "ERROR: signature verification failed\n" );
+        }
+        stop_time = clock();
+        runtime[run_number] = stop_time - start_time;
+    }
+    performance_print_statistics( runtime );
+}
+
+/**
+ * checks the performance of the ECDSA signature verification with a public key
+ * that is already in the cache of ecdsa_is_valid_cached
+ * @param param the curve parameters to sign and verify with
+ */
+void performance_test_ecdsa_verify_cached( eccp_parameters_t *param ) {
+    static ecdsa_cache_t cache;
+    ecdsa_signature_t signature;
+    eccp_point_affine_t public_key;
+    gfp_t private_key, hash;
+    clock_t runtime[NUM_ITERATIONS];
+    int run_number;
+    clock_t start_time, stop_time;
+
+    eckeygen( private_key, &public_key, param );
+    ecdsa_cache_init( &cache, param );
+
+    for( run_number = 0; run_number < NUM_ITERATIONS; run_number++ ) {
+        gfp_rand( hash, &param->order_n_data );
+        ecdsa_sign( &signature, hash, private_key, param );
+        if( run_number == 0 ) {
+            // the first verification prepares the public key
+            ecdsa_is_valid_cached( &cache, &signature, hash, &public_key, param );
+        }
+        start_time = clock();
+        if( ecdsa_is_valid_cached( &cache, &signature, hash, &public_key, param ) == 0 ) {
+            printf( "ERROR: signature verification failed\n" );
+        }
+        stop_time = clock();
+        runtime[run_number] = stop_time - start_time;
+    }
+    ecdsa_cache_destroy( &cache );
+    performance_print_statistics( runtime );
+}
+
 /**
  * checks certain operations for their performance
  */
@@ -123,3 +282,29 @@ void performance_test_gfp_mul( eccp_parameters_t *param ) {
     }
     performance_print_statistics( runtime );
 }
+
+/**
+ * checks the performance of a given gfp operation (e.g. a Montgomery multiplication variant)
+ * @param param the curve parameters providing the prime data
+ * @param operation the gfp operation to measure
+ */
+void performance_test_gfp_operation( eccp_parameters_t *param, gfp_operation_t operation ) {
+    gfp_t var1, var2;
+    clock_t runtime[NUM_ITERATIONS];
+    int run_number;
+    clock_t start_time, stop_time;
+
+    gfp_rand( var1, &param->prime_data );
+    gfp_rand( var2, &param->prime_data );
+
+    bigint_set_bit_var( var1, param->prime_data.bits - 2, 1, param->prime_data.words );
+    bigint_set_bit_var( var2, param->prime_data.bits - 2, 1, param->prime_data.words );
+
+    for( run_number = 0; run_number < NUM_ITERATIONS; run_number++ ) {
+        start_time = clock();
+        operation( var2, var2, var1, &param->prime_data );
+        stop_time = clock();
+        runtime[run_number] = stop_time - start_time;
+    }
+    performance_print_statistics( runtime );
+}
@@ -47,7 +47,11 @@
 void bigint_rand_insecure_var( uint_t *dest, const int length ) {
     int word;
     for( word = 0; word < length; word++ ) {
+#if( BYTES_PER_WORD == 8 )
+        *dest++ = ( ( (uint_t)rand() ) << 32 ) ^ (uint_t)rand();
+#else
         *dest++ = rand();
+#endif
     }
 }
 
@@ -64,7 +68,7 @@ void gfp_rand( gfp_t dest, const gfp_prime_data_t *prime_data ) {
     if( msb == 0 ) {
         mask = UINT_T_MAX;
     } else {
-        mask = ( 1 << msb ) - 1;
+        mask = ( ( (uint_t)1 ) << msb ) - 1;
     }
 
     do {
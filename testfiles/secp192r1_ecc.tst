@@ -5282,4 +5282,8 @@ eccp_jacobian_point_equals 704
 274C2E4A7990BA819CB396C3C4DAFFABEE708A486CCA591E
 0
 0
+eccp_multi_scalar_multiply 1
+3
+eccp_multi_scalar_multiply 2
+200
 exit
@@ -1973,4 +1973,814 @@ gfp_mont_parameters_order_n 546
 000000000000000000000000662107C9EB94364E4B2DD7CF
 28BE5677EA0581A24696EA5BBB3A6BEECE66BACCDEB35961
 8F63C841CC4CC3F79E9E1A9CB79D948E882672070DDBCF2F
+gfp_mont_square 547
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+gfp_mont_square 548
+000000000000000000000000000000010000000000000001
+000000000000000000000000000000010000000000000001
+gfp_mont_square 549
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFDFFFFFFFFFFFFFFFE
+000000000000000000000000000000010000000000000001
+gfp_mont_square 550
+940D0C2F9A1FB32E410E29F20174D565DCDA98D4FC4040CA
+30FE560302132D811BDB4814A7FF245E3FD4342371B5C58A
+gfp_mont_square 551
+35E97165F3B47F63C05945DBD72CADF2BE016B6FBE614800
+C69127E698429EE0C45725A5F3C21836AECDEC9F80D14E4F
+gfp_mont_square 552
+FE52D36CE4ED2EA9984DDE5BA428D8A7161AE1D269AA853A
+318DC001F69D53CA53ABA7D045ADAE1CAA601662BD8CAEDA
+gfp_mont_square 553
+D225E2A79F624290D33F1B3128AACF301A2DF30AEB4FB3FE
+B8CF3A816E0FE7A0C85CBDAAB13F1B2F923B2DDEE09E1B8C
+gfp_mont_square 554
+C9BF71D44081A86FB6CF3C11284DFF3201D121D6165A4C57
+C58BA2EC45865858322ACA6E4BEF63F2EC95BA3136E20186
+gfp_mont_square 555
+D2BFD259B9844F556303224D4108F9605BB96715D47508F3
+D3985B54B826BEB4CEB154E23A38FD4346B06AA8050FCCE0
+gfp_mont_square 556
+2985CDEF5B7B1E6C265C87F4C1CAD74E5552FC4378AC3E27
+F3906B4F119E96D872A80D719B116A278681C6D59E78407D
+gfp_mont_square 557
+63F1B4B7298DE386BA3449B7366F1BEC4E2DF315E936A9AA
+09E1F2DBBA8B90E7FB31150B6E383762B616A14EEB4AD469
+gfp_mont_square 558
+B41EB1B09AA6D34603BBFA1C640F155D3EB7DD9F3590005A
+BAD0685DA17C12961CC041DF7ABED04511F68D7251EA76C0
+gfp_mont_square 559
+4284F5F616D0A2A13181F56E35A41A5860B6662E82F479F4
+50D685D44A26AEF023040EAEFFFF41E3C833EC74A770F706
+gfp_mont_square 560
+EC297C66C0C2F126F03BEB0890C5375F6144C8ABAD9E992C
+CEF11E327F297102225D142404FDFBC611D48FFF6C532954
+gfp_mont_square 561
+9A9F1020D3B85D708829176234E4D536E3DDEDEEB1580721
+C1CA3AE068F9BD15069E2EC52DCECB2A283BB53676FC3EE4
+gfp_mont_square 562
+5D5A5772336ED168C4C13CF10C5775214D283ED41C935C2B
+DF94F634B52F9626320BFF14957FC919069350796BE66C98
+gfp_mont_square 563
+5FD5B97E621B4BF6FF8C48FB88C893A9C2257F679FB20A87
+02C0E8EBD465BACE9BF2548AA949EF0BE22CEC9344302662
+gfp_mont_square 564
+2FE7E847AAAB1A87FF0215B33454D06F6B43A92F29866891
+41D7E6DDD360D914538A90CE8E8F5864A6003946926C025A
+gfp_mont_square 565
+1DFE8AF66759A3F61CC17DDD1F126507AE5959DC5FF606FD
+C6338F2EA4965BE1F7E8C38CCC0275B20E0FFEAB0D068AF3
+gfp_mont_square 566
+4B4177FB71F4EF6D07357DC0337DCBF38A2A72C40AD43792
+AF3B4C974532323A305F43BD28DD603F3B050AD19588DAE0
+gfp_mont_square 567
+5509485E9F7008F54819573D8207B48BE351D9534B7103FD
+5A9C208AB674CB0A48DE0D32EE9A6D1A61A001427DF26170
+gfp_mont_square 568
+E46A90EF1A6A0AFD12453687DAF71827C41C6B9413E8FC10
+69BDBB0121894F91F578023B48E696C2C15C170E0DA32D0D
+gfp_mont_square 569
+552F6005D9BF28C725AE6F059EB4E6785ED92FE6D6CA0F10
+B3A730D1BA5308D704BEB76EE5FAD48D489CC47687B8BD88
+gfp_mont_square 570
+98C8CA34B0ED9CE2DF57992145E760460025F06ECFE0C55C
+2D7CC323DD7CC318F2FEC1E8373839A635A6C0FE8E532FBB
+gfp_mont_square 571
+8EE3744671D0E7EE9C8887CB4A536D888F5A3AF7EB70B237
+6DA0AD86C694F4CC76C97C569CACA060D441D33B9921FB1C
+gfp_mont_square 572
+04E13A8C7BC5465F276CC0F8447687E5E63C448A9D4830A4
+C573D5290F8BFD260489835064B46B18FE8F273A88DA2F64
+gfp_mont_square 573
+73D417AC43B2E727B70BEDC0849D938D953D02E5BF0F51D6
+EB41A6069AA242E838116858D48CDA3151F8BE63BBDC27A6
+gfp_mont_square 574
+E09C76752DAD8939D711140A7618B91A5C5C08AFBEDE6FA7
+14AEE119D4EA1E2C1730EA26222D1D915E34901CAFE03C5C
+gfp_mont_square 575
+C5487611293C7DCA2C9105547BC19077F670E7AA2D0824CF
+818537A82E1045C43AA16F9186FA58BBF986F9098B683282
+gfp_mont_square 576
+90B378739FD7477AFA96250838790C3E7896D458FDA5D7A0
+47FD4B8CD55D1969D336872C209686AFE1EA1E7C3F431049
+gfp_mont_square 577
+755C3184EBE241A2BD87DCB6525BB31DD81B06DB8CBB67F5
+98996F3419FC5FA30361ED563CE89ADABF5893DC6E79EF30
+gfp_mont_square 578
+44DECB470CC32F1A7554F47C446A1056F91B1F6EB82608F1
+BBC515314453AEC94DCA5ABEFC8A272B135E74801EACBA74
+gfp_mont_square 579
+F72859B7BF58CAEB4248F67B9E8461D3B3D68C7109715CC4
+326B0A2A8DB645E6D109C829B3980864D7E064D5B4E369D2
+gfp_mont_square 580
+8D46A30EC181DDDB7ACC3A710ED612B74214233D792EA064
+BA5DAF0E17DA3058EB461789D677BADD92760B7D4A6BE759
+gfp_mont_square 581
+1B8643F13DC8F64980ABEA92B7014924938E17FE7CCECD29
+EE0F8601C1C94AA58F8F0C0928C4B302D495861A59C9E393
+gfp_mont_square 582
+7400154F5C36BC86BDCA66A4F86B96E3D37CD1181BFAFF9D
+9F807C043881CF1832DC7662014C06C5EEF6C48B2614D3D2
+gfp_mont_square 583
+6A7CC167D5B0F8A0C402BFFEA806E589C862C25BC0A0EC6F
+C76D75EA8D17CEB4F6522EA9C85BD73005E2ACC07C23DE61
+gfp_mont_square 584
+10E8B5AA80799AE861BD7D152596D4B73CAC245356058289
+63D0EF73A35B99753700D70178E3206B023CA10DFC601604
+gfp_mont_square 585
+F2E45F88CC4E5B6226E6B769082337F21E895AC48FCBA1B3
+5C81F922B088B30F2992F8CB5FD4A9796DADE35243DD293F
+gfp_mont_square 586
+A4C2246B10691898B207117F2B0551A095D3C7FFD96C7229
+AE39EAEDB4F7AD3B9C973E96438ED58E8183D5E660B29B62
+gfp_multiply 587
+000000000000000000000000000000000000000000000000
+2F0733C846BBE9E870EF55B1A1F65507A2909CB633E238B4
+000000000000000000000000000000000000000000000000
+gfp_multiply 588
+000000000000000000000000000000000000000000000001
+E9DD38B869ACE91311021C9E32111AC1AC7CC4A4FF4DAB10
+E9DD38B869ACE91311021C9E32111AC1AC7CC4A4FF4DAB10
+gfp_multiply 589
+000000000000000000000000000000000000000000000002
+2522D53857C49391B36CC9AA78A330A1A5E333CB88DCF943
+4A45AA70AF89272366D99354F14661434BC6679711B9F286
+gfp_multiply 590
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFE
+84D4CD1F47CA7883FF5A52F1A05885AC7671863C0BDBC23A
+7B2B32E0B835877C00A5AD0E5FA77A52898E79C3F4243DC5
+gfp_multiply 591
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFD
+14C15C910B11AD28CC21CE88D0060CC54278C2614E1BCB38
+D67D46DDE9DCA5AE67BC62EE5FF3E6747B0E7B3D63C8698F
+gfp_multiply 592
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFFFFFFFFFF
+3BB4A570294C4EA3738D243A6E58D5CA49C7B59B995253FD
+6225AD47EB59D8AE46396DE2C8D3951A5B1C25323356D601
+gfp_multiply 593
+800000000000000000000000000000000000000000000000
+6C79A3DE69F85E3131F3B9238224B122C3E4A892D9196ADA
+CF36AE80F60E87AA312902CA629B3D16982F2638A188E485
+gfp_multiply 594
+800000000000000000000000000000000000000000000000
+4FCFA583E1DF8AF9B474C7E89286A1754ABCB06AE8ABB93F
+822236B63A331637A7808EEBAE88F2D6CD462AF76545A21C
+gfp_multiply 595
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFEFFFFFFFF
+01D89A024CDCE7A6D7288FF68C320F89F1347E0CDD905ECF
+B323185928D7700973CDF0760CF2E7F0226FA130FE2765FD
+gfp_multiply 596
+000000000000000000000001000000000000000000000000
+D160C5D0EF412ED6F1CFD99216DF648647ADEC26793D0E45
+16DF6487190EB1F7687E3D1CC3309F62EF412ED6F1CFD992
+gfp_multiply 597
+7A97C643656412A9B8A1ABCD1A6916C74DA4F9FC3C6DA5D7
+C79D679346D4AC7A5C3902B38963DC6E8534F45738D048EC
+B33FC4303091C120317DD9FEC82BC8C74DC33429723071F1
+gfp_multiply 598
+8CA5996666CEAB360512BD13110722311710CF5327AC435A
+D160C5D0EF412ED6F1CFD99216DF648647ADEC26793D0E45
+25918F1D1D7C8A44DBFEC1DC6EFEDFEF19244BB931161F8D
+gfp_multiply 599
+0F1099C6C3E1B258FD724452CCEA71FF4A14876AEAFF1A09
+2522D53857C49391B36CC9AA78A330A1A5E333CB88DCF943
+45DF74C6FB46AF85FD82436B4FCDA52F9843724CC96C03C2
+gfp_multiply 600
+C79D679346D4AC7A5C3902B38963DC6E8534F45738D048EC
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFD
+70C530D97256A70B478DFA98ED384720F59617518E5F6E26
+gfp_multiply 601
+F165C8CE36E2F24B43000DE01B2ED40ED3ADDCCB2C33BE0A
+8CA5996666CEAB360512BD13110722311710CF5327AC435A
+D990ECFF7FADB22CD9C47866E30BB2DC09829122898029B5
+gfp_multiply 602
+42A00403CE80C4B0A4042BB3D4341AAD06905269ED6F0B09
+566002249B191BF4D8441B5616332ACA5F552773E14B0190
+97D13CB615BB66CAF2B84B117021ADBBC00D44DAF29E7E5A
+gfp_multiply 603
+4A25E4664F5253A02A3187853184FF27459142DECCEA2645
+14C15C910B11AD28CC21CE88D0060CC54278C2614E1BCB38
+C0661E5247059F491F3463888AB9442C6D6FE5B140CAE6B4
+gfp_multiply 604
+D93936E1DACA3C06F5FF0C03BB5D7385DE08CAA1A0817910
+000000000000000000000000000000000000000000000002
+B2726DC3B594780DEBFE180776BAE70CBC1195434102F221
+gfp_multiply 605
+566002249B191BF4D8441B5616332ACA5F552773E14B0190
+000000000000000000000001000000000000000000000000
+16332ACAB5B529987C641D852EA41D7A9B191BF4D8441B56
+gfp_multiply 606
+3F5082492D83A8233FB62D2C81862FC9634F806FABF4A07C
+4A25E4664F5253A02A3187853184FF27459142DECCEA2645
+A41E7D3B137EB783FF4846142DBA8B6DFE3572464CEFA94C
+gfp_multiply 607
+D160C5D0EF412ED6F1CFD99216DF648647ADEC26793D0E45
+6C79A3DE69F85E3131F3B9238224B122C3E4A892D9196ADA
+FF8090FA1EA4974FF1D9F1512F0CDF99C3949B7375330A3E
+gfp_multiply 608
+01D89A024CDCE7A6D7288FF68C320F89F1347E0CDD905ECF
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+gfp_multiply 609
+4FCFA583E1DF8AF9B474C7E89286A1754ABCB06AE8ABB93F
+800000000000000000000000000000000000000000000000
+822236B63A331637A7808EEBAE88F2D6CD462AF76545A21C
+gfp_multiply 610
+6C79A3DE69F85E3131F3B9238224B122C3E4A892D9196ADA
+F165C8CE36E2F24B43000DE01B2ED40ED3ADDCCB2C33BE0A
+65D9DE01C255F984D022DE9AE9F0AFE78FD59BF5BDB121FE
+gfp_multiply 611
+3BB4A570294C4EA3738D243A6E58D5CA49C7B59B995253FD
+01D89A024CDCE7A6D7288FF68C320F89F1347E0CDD905ECF
+6BC867E02DD26210A328E3669CB6EAA9EF7A75812CCAF465
+gfp_multiply 612
+14C15C910B11AD28CC21CE88D0060CC54278C2614E1BCB38
+E9DD38B869ACE91311021C9E32111AC1AC7CC4A4FF4DAB10
+693D0513E3F7EAD6C77B8872323F92658147F0B737A6897B
+gfp_multiply 613
+84D4CD1F47CA7883FF5A52F1A05885AC7671863C0BDBC23A
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFFFFFFFFFF
+BD9599705C1AC3BE0052D6872FD3BD28C4C73CE1FA121EE2
+gfp_multiply 614
+2522D53857C49391B36CC9AA78A330A1A5E333CB88DCF943
+0F1099C6C3E1B258FD724452CCEA71FF4A14876AEAFF1A09
+45DF74C6FB46AF85FD82436B4FCDA52F9843724CC96C03C2
+gfp_multiply 615
+E9DD38B869ACE91311021C9E32111AC1AC7CC4A4FF4DAB10
+3F5082492D83A8233FB62D2C81862FC9634F806FABF4A07C
+555A5EC5B8F84C773BD487EC6CFE1342356ABA75FB76A54F
+gfp_multiply 616
+2F0733C846BBE9E870EF55B1A1F65507A2909CB633E238B4
+84D4CD1F47CA7883FF5A52F1A05885AC7671863C0BDBC23A
+02EC7E11393148043DC25B88A717CD66018E5ED4B78137D3
+gfp_multiply 617
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFE
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFE
+000000000000000000000000000000000000000000000001
+gfp_square 618
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+gfp_square 619
+000000000000000000000000000000000000000000000001
+000000000000000000000000000000000000000000000001
+gfp_square 620
+000000000000000000000000000000000000000000000002
+000000000000000000000000000000000000000000000004
+gfp_square 621
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFE
+000000000000000000000000000000000000000000000001
+gfp_square 622
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFD
+000000000000000000000000000000000000000000000004
+gfp_square 623
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFFFFFFFFFF
+3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC000000000000000
+gfp_square 624
+800000000000000000000000000000000000000000000000
+400000000000000040000000000000004000000000000000
+gfp_square 625
+800000000000000000000000000000000000000000000000
+400000000000000040000000000000004000000000000000
+gfp_square 626
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFEFFFFFFFF
+000000000000000000000000000000010000000000000000
+gfp_square 627
+000000000000000000000001000000000000000000000000
+000000000000000000000000000000010000000000000001
+gfp_square 628
+7A97C643656412A9B8A1ABCD1A6916C74DA4F9FC3C6DA5D7
+BD590BD97C822C2BB94DC1E0DA3274EAAC226BE76495DCA6
+gfp_square 629
+8CA5996666CEAB360512BD13110722311710CF5327AC435A
+E4DD418033AABC67A6127218AD095A04BF34CF1883E2E142
+gfp_square 630
+0F1099C6C3E1B258FD724452CCEA71FF4A14876AEAFF1A09
+D3B21A35DD7C551BA2C340483E70B2D686730BF395995DCC
+gfp_square 631
+C79D679346D4AC7A5C3902B38963DC6E8534F45738D048EC
+3D3687C17037D1147CB2B18DDAB8338DCB1C22D7CFB1B5A8
+gfp_square 632
+F165C8CE36E2F24B43000DE01B2ED40ED3ADDCCB2C33BE0A
+EAB7327D888BF3223C985F3720E20268EB60A3D08FC9D32D
+gfp_square 633
+42A00403CE80C4B0A4042BB3D4341AAD06905269ED6F0B09
+5EE0C7B7463FE17172C803794F573A6D44A40487056B75EF
+gfp_square 634
+4A25E4664F5253A02A3187853184FF27459142DECCEA2645
+F2E2DFABF24D25A49AA530C83EBB0D12222D1FABEF9333F7
+gfp_square 635
+D93936E1DACA3C06F5FF0C03BB5D7385DE08CAA1A0817910
+53B42F6F023B1E0ECC353EB9F95C57E721DC5082D439D759
+gfp_square 636
+566002249B191BF4D8441B5616332ACA5F552773E14B0190
+18797E62BE62557D2D5FDC62127D4D3317C8552B2A8DE700
+gfp_square 637
+3F5082492D83A8233FB62D2C81862FC9634F806FABF4A07C
+47BCA9C9BADBBE6D6E66B2F2D9944986D22B45EDB51349FA
+gfp_square 638
+D160C5D0EF412ED6F1CFD99216DF648647ADEC26793D0E45
+66C608ADDC2A75FB514B84738C1769F4C6D320AC28A65B1E
+gfp_square 639
+01D89A024CDCE7A6D7288FF68C320F89F1347E0CDD905ECF
+19EF1F5F3AE26E77B680699A6FDD4018611BC72A65CB6EAB
+gfp_square 640
+4FCFA583E1DF8AF9B474C7E89286A1754ABCB06AE8ABB93F
+9686EB6C5CE598552586CEC23BD01E3AC62F4B45298B3303
+gfp_square 641
+6C79A3DE69F85E3131F3B9238224B122C3E4A892D9196ADA
+448F96E4774787C8F1E493FCE7082F90878AF900DE47EE62
+gfp_square 642
+3BB4A570294C4EA3738D243A6E58D5CA49C7B59B995253FD
+417965AC1F1AA0E5EAA33832750A7362E55932DE016B3DDC
+gfp_square 643
+14C15C910B11AD28CC21CE88D0060CC54278C2614E1BCB38
+9AF1CDC0C0EA4D7E6448593B26FE1A91317572EF26F5AE2A
+gfp_square 644
+84D4CD1F47CA7883FF5A52F1A05885AC7671863C0BDBC23A
+6CBD562BA7AE52C76B708421029D2C009D7EFB6FC0F0DFDB
+gfp_square 645
+2522D53857C49391B36CC9AA78A330A1A5E333CB88DCF943
+6CBEA8E94B60E104201173DEA7963D7327F9D124FF643DCB
+gfp_square 646
+E9DD38B869ACE91311021C9E32111AC1AC7CC4A4FF4DAB10
+2C18E45CC2C1D6E5DAFE122ED92C4D3BE10CDBE22990837B
+gfp_square 647
+2F0733C846BBE9E870EF55B1A1F65507A2909CB633E238B4
+E91520E2ED006AD73AF4634D8B184E68B6FDBDB34C92E008
+gfp_inverse 648
+000000000000000000000000000000000000000000000001
+000000000000000000000000000000000000000000000001
+gfp_inverse 649
+000000000000000000000000000000000000000000000002
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF8000000000000000
+gfp_inverse 650
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFE
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFE
+gfp_inverse 651
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFD
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFFFFFFFFFF
+gfp_inverse 652
+C320A4737C2B3ABE14A03569D26B949692E5DFE8CB1855FF
+57BEC91719463B0B27A8CACA430F5056E4B823223B2BC63D
+gfp_inverse 653
+9623D7CFA9AE7A34254499C7001D9A88096D373742F9A03A
+4A10C0C0C650B34D0451810B34D182132C01FDB390E07E11
+gfp_inverse 654
+51C342505F877031BC1E3AC1C27DB4ECF72C2C2678629523
+21795BE328D51E6316CDF7F579E6042971C73A2D7A017113
+gfp_inverse 655
+32B7228FCD4A55577D24B39645CF8AA4059A91E1C527E27A
+CEAABA78A13A95E79CD206BC8D3EFEB1B241823D69286519
+gfp_inverse 656
+8A0C510089CE5EF7E91B4AD169FC5360DF5CA32EBAD5CCC3
+93ABB31C9F952BA26AB09C7B174C14F0740FF042C149A965
+gfp_inverse 657
+B313FC7E8DB9B92C903C2AC9316774FE181E290AAE9AF16A
+D98AD015B286AD2F226C30E4AFAE3DEA36FE2CBEC354190A
+gfp_inverse 658
+9C2C0AC2CDA95957A9B3D1A243F9300CBA98666ACE1C9C18
+0DDA45EAAB618699A09EEF0D8AD1F2C69DEA720A9F4E1921
+gfp_inverse 659
+FD80206055E8B3EB6CB9185ED822E2F9168E5087AF895F5C
+6993A18F6BE7A1DAA7CB0269AB98955D1A08519B6835D8B8
+gfp_inverse 660
+401FE4FCCE06294D68F22599CCDF540B5CB53EC017D7AB27
+A8CF0BAA5132B5D92DFE7EE36288FE870C484B5085481DB3
+gfp_inverse 661
+B3642B1932793637C16CF5C51801FD9AB31A5BF371F970D0
+237CD417EC8904B62CB49CA08CC5ACFF2589FDC57202D504
+gfp_inverse 662
+0BB1E330F38D2E6418F918E24A8B0188CBE19514A28A0AAB
+0B6DCBB7BA4CD9D3F77BCBBF5C578F98F49C718B9DCA305B
+gfp_inverse 663
+E9A51FB2A7C88E4BD3F18766336C7FCDE71B870396AC8290
+0D0799C3771C35577EBDE00D3F346478CCBF3A525C57C5C1
+gfp_inverse 664
+3197D4E2E8D5B9E3D52D5759EEC7DDB57C9881B15C41D5C6
+EBE6D9A64C0667AE52AD2ED1604DF9A449F643F4528C3FEC
+gfp_inverse 665
+E474E007B2AA40B4F8540D95A502A86A936D0E1E83C02DA9
+2C3F305E741A1D09875AA2DC135C332F781EE411E8997C1A
+gfp_inverse 666
+A22BA4D70746A9BAEA9238EBF9F3B65B80F1DE02CE359205
+530C6D4F8853B7F2E82AF33C14F4798E3460FA8976611C25
+gfp_inverse 667
+5B7D3B0F4DE8344E6E0012819A0C1B763EB17C275C832A52
+B40BAC3A8250013D0122064EDE5AE2BC70A8BEE5639682DE
+gfp_inverse 668
+ADB9CE1BE14CD8DF800A4C9416F5C1EE1E9D19E796D2F9E1
+D24A9046E6D870D3E7C774B60D0FE138EC1786AC33DC9C2D
+gfp_inverse 669
+44941663A9A967C19BB38B9C1DE8340532F9E2B08677A5F3
+C2314A1D1C7AB285536081A13D0579E7A2596AAFF8B97565
+gfp_inverse 670
+390567C27BD6AA42613B030A323BBEAFB8109A544FF1A002
+A7AD6757D4EEE050E0862D6C9675AF26E2165994C6A33113
+gfp_inverse 671
+E0408802DD93FA0CD581460B35BB0A8598EB7BCE235AE281
+52DD1CFC6608F87C15DAA559C04C49C4B67438BC5B491081
+gfp_inverse 672
+2B4CF14CC72EC6F03051B3900334B01B85AB0090B2BECA82
+FCD2FFFE18D8301236991C0742B57522922A9334191434D5
+gfp_inverse 673
+ABDDFCD9E7893D2B8EC86D6C5539B994A5E27D6E045DF64B
+A0D08CF212FA856FECD63C17474E8CEED30EF4BD357BFB4B
+gfp_inverse 674
+8701F8AD609D99CC5FE7E49D4E5E2D419E5DC5989EC9B430
+52C4D3096AA354D17705F9062A380C493EDF253B3791DF18
+gfp_inverse 675
+7D1F3B5CFFF80B3BADC1383D20783D884A05AE8763A05B06
+2042AC08F57960321FC97BD394E314B2A5F9CDFE8BD58800
+gfp_inverse 676
+FF9264FFBF0E5EEE980BCB4C6C426E402F7307300DC749B1
+38590A0436D3EF6425C7CCA4D1BBA271BD8445AABD965CC0
+gfp_inverse 677
+CE400E5A3ECCB44D70F5FAFEFB2114C018923F6565D3E199
+1EB392DF4A9C9B4853970B0079910DF96C1A7D4EE80AF884
+gfp_sqrt 678
+000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000
+gfp_sqrt 679
+000000000000000000000000000000000000000000000001
+1
+000000000000000000000000000000000000000000000001
+gfp_sqrt 680
+000000000000000000000000000000000000000000000004
+1
+000000000000000000000000000000000000000000000002
+gfp_sqrt 681
+0FD630F1F29D0DA9953F48F1A09F76B5A170B3383926305B
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 682
+8F87365AF4B374C5505439C6373B8ED9630605E69CE616E0
+1
+3898D190F9EBDACC0CB1E29C658CDA1495E60AF593BD04D0
+gfp_sqrt 683
+CAC6E72955F358878C79DD3AEA3EC9289E65491E4A7BEA32
+1
+6B4CB2424A23D5962217BEADDBC496CB8E81973E0BECD7B1
+gfp_sqrt 684
+8F6D05584EF8AA38922766581E27A1C08A6A63EC24EDE6A6
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 685
+A73E74B564638C52992DC9DF7311F4062BCABA6BA1705DDE
+1
+923A736994E3BF911A61DBE22E44158BAE97BA94D0EDA830
+gfp_sqrt 686
+8D52B68869C8E8A39CA3C45F3CC0FCB2EC174A475FCA8F0F
+1
+B64CE4228C38FB2918F135D25F557203301850C5A38FD548
+gfp_sqrt 687
+7F15052434B9B5DF9E7769B10F4205B4907A70C31012F039
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 688
+439D56D9ABE349A59116BC40AEB75B4D00EEA2E69C2780EB
+1
+7731AF10506BF2EFC6F877186D76B07E881ED162AE2EB155
+gfp_sqrt 689
+A151A6385110065D70C2619617B8B542B0A2C718AF9C5D77
+1
+3F98E2774CBD87AD5C90A9587403E430EC66A78795E761D2
+gfp_sqrt 690
+5790F82EC1D3FCFF2A3AF4D46B0A18E8830E07BC1E398F12
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 691
+13CDAE892D84BC06EECDA121018FB305AF22F2009E82B945
+1
+F646E1F40A097C976BF46C697D2CAF82EEEACBE226E87556
+gfp_sqrt 692
+1AD6203335100B232D5C44231980CB518EDF01DF77C45815
+1
+CA02135E92B1D3F28EDE0D7AC3BAEA9E13DEEF86AB1031D1
+gfp_sqrt 693
+59A54A7BB1FEE08F571242425051C1CCD17F9ACAE01F5059
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 694
+D29904194F3147215BE935B0195063A0740187205406ED59
+1
+119A72D174C9DF6ACC011CDD9474031B7F26144B98289FCE
+gfp_sqrt 695
+64EE8DDD393681BAED09672C8668138F3693079F0EC427A6
+1
+B2715945795E8229451ABD81F1D69ED617F5E837D70820FF
+gfp_sqrt 696
+4F426DCBB394FB36BB2D420F0F88080B10A3D6B2AA05E11C
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 697
+B43066BA2C022B4DFECD8BDB7AB89985008715936E2D81DC
+1
+72158370D269A9A5AE658F33FE3B890B93F448B3A5AA3C82
+gfp_sqrt 698
+83EC7FA5328737D367128E3772AD4B210D054FF754E741BE
+1
+58D5563DAB2CD31EE315128862C33A4FB774EB5248DB40B0
+gfp_sqrt 699
+9C6539382B0537E65AFFB2297631A992F0CE583505C6AF09
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 700
+3A19CDBBAAA84DBAC3C3A00F99937798ED9EEF4830DDCE05
+1
+49952399C4AAEAC137DC76FB0F17A3007E62AA0A1DF9FD79
+gfp_sqrt 701
+9412427F303CF610D091A06FC5BC80BA462FF4F31F5748DB
+1
+EAB477D26415479C65DC9F503F63AF83BD0561E6211C70D0
+gfp_sqrt 702
+6E36AAB0D1BC52D9230D977EE22571594720771F8CA81813
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 703
+9EE1EE7FCCA46D44BFC4AE22CDF3F1F938B7736C5C7D67DA
+1
+FC891B4A6A50DF4DB4D66A3A47469A4D8CDB305FDD2E160A
+gfp_sqrt 704
+449DC448799D5888BD3AC8FA268750D36534B2169C21A09A
+1
+3B1287FFF52DDF5D616499C9E25A7605AEC6F0245BD86D41
+gfp_sqrt 705
+88DAF4016B4013EF254B0C4E010C4759482C9CBC43435CC7
+0
+000000000000000000000000000000000000000000000000
+gfp_sqrt 706
+80EA3BBC51ABC3660248ED1846B2A8BCAB3B70B8CD1A06DD
+1
+20203626F3FE39C0519088F590FBBD119C1CAAF75E8766EE
+gfp_sqrt 707
+E42B3C7B80E6FE426E84333910295FDCED9FA1490EFB6C5D
+1
+A7ABE1C29E1A8EF4F341E07A83F73F16DBF4A8B2B0C4312E
+gfp_exponent 708
+000000000000000000000000000000000000000000000002
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000001
+gfp_exponent 709
+C3A8DB5628865529228DC5196D16328FE0C99F3EDAE3DF9C
+000000000000000000000000000000000000000000000001
+C3A8DB5628865529228DC5196D16328FE0C99F3EDAE3DF9C
+gfp_exponent 710
+B3BFCD5D50545214B0AFB81E8824918818FD64F799EF936A
+000000000000000000000000000000000000000000000002
+4401FA45B2D87C28CA79BCA64A5E4892D9EB44C940EAED5C
+gfp_exponent 711
+80ED55037EA03260D7EF27BBA4D70DFCF3332EB05B6659EA
+000000000000000000000000000000000000000000000003
+74E12D62EA2892861E0C611184055A4A2D24587D9583B75B
+gfp_exponent 712
+875A34F25B11B76F2670E0984F0CF267329911DA9FBD8735
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFE
+000000000000000000000000000000000000000000000001
+gfp_exponent 713
+E7397785CEE116191248A2A4A834D5808281A6BF48CB74A9
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFD
+43F6F7929899DE7DBA55415FB76D698CBA48006C105A980B
+gfp_exponent 714
+384EF90A8B80EB31B3880DE0E9BE9F8881E6187FDB522231
+800000000000000000000000000000000000000000000000
+68BF37A96041CC77A669568B968C420F54F55B5AC8854052
+gfp_exponent 715
+000000000000000000000000000000000000000000000002
+00000000000000000000000000000000000000000000005F
+000000000000000000000000800000000000000000000000
+gfp_exponent 716
+38443E4F57DE014C4BB36EC8030CF05DE86C68CD3E6F54D4
+0000000000000000000000000000000000000000205738D2
+6767A8C555BE966EA11F7CCA43BDE529130E2706B3494EDD
+gfp_exponent 717
+4C60DED1607E39D14138CAD26C64107F089D8567444FC6F9
+000000000000000000000003230824D215CEB3A10B3510B1
+4A5AA183E6FCA3D1F4AF6B381F011D01017DD0AF09902D49
+gfp_exponent 718
+A84E090A2CDD3FBE6ABB3E13E4373A7DB494D2A8D595BF23
+07C15471A4517D6C6694F229359B154881A0D5B3FFC6E35D
+8713B1947A90CFB6F2F5704687CC432E585C890CFACDCCF4
+gfp_exponent 719
+DA23CEA1A9C59A2DEEBB31672A8AE1661DC35C7F65718DDC
+00000000000000000000000000000000000000007CC661EA
+1E5EA10DC84050BF9B99252D0FD3BD415B86A705C425756F
+gfp_exponent 720
+2922071DC437B057F91B60E533A9B4BB068FE849F98F7A0D
+00000000000000000000000000000000000000017EB72F83
+80B9CA811EC7F6EFC2885BCF3DCEC0115E0C05A6AF6F64BE
+gfp_exponent 721
+6165598CC3A90B68CBE20B1103623AE41DD1D6164CCFBBBF
+0000000000000000000000000000000000000000000000E6
+8662EAA30086EBC88B2449F175FB2EC8299E9065E87EA282
+gfp_exponent 722
+000000000000000000000000000000000000000000000002
+051E2670C24F6AA83BF36A147C2F7AD016EDC5D467164891
+29E0E4A2896A095CB76E0B9310318F356E669D583AAB115D
+gfp_exponent 723
+3B51F400E7B6C5586F83F5BE91B23A192B8F6916D61E17ED
+000000000000000000000007685CA8AF852A5FBA444ADF43
+9B62270C41EE636619B0A8239A886DCE18DA19D4D3418EC1
+gfp_exponent 724
+6AFF8737683B4EB172308DA69062206B68FC60BF23980554
+0000000000000000000000000000000000000000B9DB434C
+4E260B4885A6A8DAED3CB2CBB5966EA2CF88F10549EDDD56
+gfp_exponent 725
+18593DFBB783171249EB257711E9E99196A881FE148405DF
+00000000000000000000000DFDD9A78D18DFF3934223AA57
+2406C1C5C40A1C76ADAC2B42D60453DF8156E222AA7ECE8C
+gfp_exponent 726
+855C9EE6C3A7DB151B451E20A9C8510115D3542D08B664E5
+000000000000000000000000000000000000000000000007
+85AE6E4DE5260441F2ADC0162BB8769503E49CFD3A508B82
+gfp_exponent 727
+8142A736EFBBF85FCEC56A512756064E5C33B37C86FC1635
+0000000000000000000000000000000060908405D45C39A4
+65EC726D574C71DFB2A51A55B4AD744756455D19E9C591AF
+gfp_exponent 728
+101F0ED69ABCCB10FAE5F845260642C1B54B1C5A7CFD3FCC
+00000000000000000000000000000000000000000000000B
+0E7F8C0D691B1305FA81F0C7CD98230133F1758AA1B63C3C
+gfp_exponent 729
+000000000000000000000000000000000000000000000001
+000000000000000000000000000000000000000000000006
+000000000000000000000000000000000000000000000001
+gfp_exponent 730
+A88045E062E6B76C573E304F23F0A53EE9A12142045652AC
+0000000000000000000000000000000000000000000000B1
+D7F63F306CCAB7E1B30A6EB672DBCCD7B291243C57E70B8C
+gfp_exponent 731
+534FAC5659F840584CA632B1BE6686FA1EE966AA92DC1B6A
+000000000000000000000000000000000000000000000008
+121C99C1EF86124DBA26B7BB6E2CE997DA055D51C4A87CB3
+gfp_exponent 732
+7FBFBF6CD5EF05DEA55631EB00C0B01B5DB51125F707C19E
+000000000000000000000009353A0106E6C08269844DBC0D
+9DEB7143C2CCF06D6480D208E4F740BE92BDFA0AC44D7D0A
+gfp_exponent 733
+E2061071087AA5E69E04C484E00BBE3F0F87CE0635C7EE33
+09974B85F2306D4A8A2AD16E107AC8069B51C6322463278F
+230912D6E98E1422767D705351FF6AFF26018C1A21A691E1
+gfp_exponent 734
+D1021ADFFD8EC734CEFA6D8CC266970ADE7075CDF714E901
+0000000000000000000000000000000000000000B3AA75AC
+1DBA9EFBF6ABAC5B321B7E5CCA25D410137ED8C76CA27144
+gfp_exponent 735
+6E58190DF84951FD5667DE8A2D842C192C066807947B65BF
+0000000000000000000000000000000000000000000000F3
+1834343D3FA41DBD38D6FDC27E05CDD54B2DBC9D19F9EA4B
+gfp_exponent 736
+000000000000000000000000000000000000000000000003
+71F47E49E18692E295990881BA9BE85A74CDA9C49436D6F7
+A0BDE73E476068CF843F946BE68D118163A1182EE5CF2BA7
+gfp_exponent 737
+7F4906CC3956F6809AFB9C5133514FC31556BD9F1EF6A975
+000000000000000000000000000000000000000000011D5A
+DEC1DB89F14164AD8E2DEB034E3CB2A1C11F9E982A47D00F
+gfp_batch_inverse 738
+1
+2FA73207237751AA4462EBFC5F915EF09CFBAC6E7687A66F
+235109D13F34BC2A9185C9AC4E8A9D02662D2E5A9D2E801E
+gfp_batch_inverse 739
+2
+000000000000000000000000000000000000000000000000
+EFB6FBFE8DE4AB47558298E214B044D79ACD8ACDE5F6DB1E
+000000000000000000000000000000000000000000000000
+FB7D8E4F843D3FD9E89ADD36B8B2138762F78D17AF5F7E29
+gfp_batch_inverse 740
+8
+73B7A490F23B2CC4B4174A672B5EBAA061076DC3BA6ACE6D
+3CEE5E2C2B1E1885283B73A66C2EA417B99DE255F3868255
+EC801BDFDF2965B3819AD93B21E6A46F1C670EA90D243A17
+6237DBE6B03DA701C632976A10363C5F972651DAFDB119AA
+4A8AA593EB40A9B81A070205E323BB2ABF00188DCA22E4C8
+6BF82959CB01C357B9C7E435396BCB8FAC9ABB0C3478442C
+35BB5C11E95027004448A6A1C5C7D1861674518DE3BB41B4
+331155190B0ECF26CF3C17E55777039E47FBB3B46583D615
+82807002A5D7487077C433663C012E8C3FD93D3627EAB88E
+9A4105D39831AD592CE7C8FD018967E4AE48C9C59AFD7B28
+D0E374FB8AB7552FAF2ADA6D8774AE32ED7BD82EF3EEA1B9
+5EEC7D4438555FAC2A240F7E08809EE9B7B6EA7DCD259C7E
+19BD0D23AD9A142C7BD1C245DD82C3B48F5D61682A9B446F
+CDAC015BA9C158440B7D7C2924DE3BE365C5804A6AC1A091
+42E32FCE84A47EEFFA2BD1EAD865DA17B4CD980162D4D2AC
+61A4BBE3457DFD8612B7B47BF04C6C09BFC1493EECA8413C
+gfp_batch_inverse 741
+8
+0E06ACD4694398C5E11E99FB01597AC1E2EB17C8B573F6C6
+0602FE0C239EDD3A7DE0D208D886C5D060FA1C95E553FB52
+1CAF107AD9C98C23E80A86CFBC79CE036CBACCF13C9A8DF6
+9425B3E2C3AD4D991F0916CB00FDED6598CAE043F6C986F3
+021CD6FF548914EF33FB4B4FDA298ADEE5329B4E329A8614
+04789365EAEB999B8A2E547E22184E8215607DF9E4794196
+EBC1D3D2899F57F77F2A75EC92AEB20C15B7D95F8034A6A8
+A382FE103131B13D65EC29F8119E333A6B8C290D32BBA065
+3C7D4B8EADD3210BB78FFE63933F3FA62B81C61A52FB2DB0
+6F9C5AEB639AD7416D82B7F0689B33690A491EED176B7E9E
+543040ADE386F7CADA7DE8F0B8872CA75E70CABAA1EC568D
+A56BA81A36A158BDAE9198BF64DBCC62F77662DEC9934336
+A61D9CC0B97DF1EEB0AFC84403DEC495BCB2E8F6141BF689
+3E3C37A5B38F0263366A31B2E2E2063C07A57737503B9D09
+6C2CEE106FDEFABEDE728ED1EE4B481487CEF120F4EA33E3
+853A5441745599DC8435DF3B1DFD62D1F3F6D51334FDEFFF
+gfp_batch_inverse 742
+5
+2C2C93AB25362104946DC860B36AC08417EA3A98C3D0560E
+000000000000000000000000000000000000000000000000
+2638D17FDA1BDDC69B3BC5EFAEE7D5168E187590451E5C34
+FF7A96319345A915FEB0B634BCA4537F44B00011BEC2223C
+F36FACE167019017B4999178DE6081741F0FD9E908C3D506
+B3CB22F0FA4C7D395C128FEC31B7E89E4EB5DD82F21769C3
+000000000000000000000000000000000000000000000000
+6B053CEDD8F21CDA209E4AAF958F45F46CE5405E5CF1703C
+44B22E4DC713DF122699C6FE579A8E178F4D07CF22F342C2
+1F9FDCB44DD35B589C3F167DA09132A6BBB8231EB3B186A9
+gfp_batch_inverse 743
+3
+5DAEB168BC6A37110B0410008141DF319C72D92C2967C63E
+C64DD2E190B301FF971B377685A5A77AAC937076D87D8E19
+DD3177811C26B9C058E1FA75DE0C057F163488CBB00E0068
+31FC222FE0756587F869CCF950BF65FA6F1AFF3EBF5F61F7
+B0E4D227228E2CDB70B8B4013F3F48EE17A1FD22BF432FA5
+18287738E3D1CF6ED63AA47623DF88901197177DCBCCA24E
+gfp_batch_inverse 744
+8
+66F4A21535C490FA738865AD5D95E3EB958A3010E1B7A663
+04B3ACBABEE62671930E3B99F268403AFC6F313E32E2BBBE
+6EFE9B6400284CFA54267ACE9B954AE4CCA380AA61027D4E
+000000000000000000000000000000000000000000000000
+1A62C23748EE59B5A127941D4EA19D1816BCAEA5D0901BC7
+C7DD5A6E61A23D2F068007CA0E1F35A9C8BAB293847B27E3
+B59E60CE58989C777F510EF56DBB3C3ACEBB95C28F78A4CE
+6CCD428D10F7BC33BCD473B290E71C233F8E05AEC71CC9B6
+BC0784CE05AECAA861A2DFB0524A5320B52B43CFFC24A173
+B7929637FACCB73C22FF39A37F8E72048F02BA1392CD55DF
+96DAAF23CE5D2569ACD4ED1061E7C6C065CFEFC6B60EA569
+000000000000000000000000000000000000000000000000
+5BF105A065EB3350EC85B1B5024A244BED35665EC7E0B9BC
+BA8169BCD3DD3291B34F92450BF5C40C518A42BB557C3657
+6F54C6627B0B2E2B04187E45E3012D2D4345153E657647C3
+A6A352D840561C20724ED31E5DA73A6760B95CB1D6164A9D
+gfp_batch_inverse 745
+1
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+gfp_batch_inverse 746
+4
+AAE1A1D5239E666A5E8E60308F7A8C30DC228135F4B2021E
+000000000000000000000000000000000000000000000000
+2C39BF42CF410A81F9AA920FF0812E130CEDD05A07851327
+9B475CB61EC98244FC7561AA2A09F663F24F152743516558
+D393B6F6DA19AA8A3634F801852F81F1F9A350A1F54B6DFC
+000000000000000000000000000000000000000000000000
+DFE623CFAFE8C8BEDD288339292582D163D0EC60E5FF059D
+EC76BA14B160CF8F5102BF6F60AB597C95D187D6E4DE49BE
+gfp_batch_inverse 747
+7
+C95D3D6A3566EE58734FE4D10F97D8260C7FE292030A3905
+CC76B117F7682C1E03C988CD9C8E744C4B533D78638D8D12
+471918AD8FDAC9077B1D59222401474348F670B05AC28CFB
+4BC7556D8E53609FBF5C166F162AA5E7F636AA932326111B
+247C3A58738EFACD6B805AD010CAF5361E30B9E1B22C4800
+969287DC620C5871CB7DEE30C3A0A9568FDA5929B42F1CFE
+462F09DFB728CFC0A9C6B5C42B48D173CD80B868E31E0281
+47860567690EFC3DCB2E9320A2D3B092DE3C7793A6CE315E
+4A3659F44465647D22F378D714A8B38BD59541A9CB4E456F
+DC332BA7C41AD919879BF781DF154953E5CA486532DB6F97
+279F90F0DA73F4A709F95AFF15879FA56EED8FB07EF24ABF
+0D7E00B295103DC7A2316587DE92D25339C7326DC32D6BF1
+47B7ED10087EB0439E911F7BDCB102BEAB7480110CE5E865
+D169195991EFDCC384A00BA029E1325355804F8AA544B138
+gfp_batch_inverse 748
+8
+000000000000000000000000000000000000000000000000
+20DB29C48761E88346DFBA810C67D997EC5621101966E7B5
+298791551592DE82D20477ACA132F3F0CC64ADB82C5F44D8
+33F0DE1E0354E640DBEE95D538EFB8D1CA26689BC7B7D939
+8BA64BC38F2AB367976E108774EA20B7794032F52D048A89
+97CA5E0E7B6864928C7254612C4CFD20154C5EB5636694BB
+A6AC1EDEF0F835A3110B98E88911ED91432F304EF249B5CF
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+D9C60A117834266F4CF88AAE53AFFF02EDD4ED19D5494B7D
+3EB8537620E77E79C42232C0247AC4D010395FC5C3E55EAD
+EC1452F88CDA98216C9AF4D24142DCD9B7454E5DEBC128CA
+D372395CE89E8D3A63BE2A39E87F12461E5C24529BA2759A
+FEFA36AF0BF5464BC69F06E11D2FFE55F1A16F9921F80F3D
+6EB0536944387369365DA2C3D5378D51C9A3B07E2A3C59D9
+000000000000000000000000000000000000000000000000
+gfp_batch_inverse 749
+6
+A440EA658980F4E086E8E4808603CBD14F0AFB9C8B5AC3E7
+92E97FCDA48F39F5E09ED5D210C9CB68CBCE8180E8D73F94
+396B36E6B994D45B10773C7E4CE1A6A4F49772258ACA6DA6
+7DDDE0A5B313C81D19809C2D1A6BF9A023301C4FB87E3C4A
+BA3D7AB4A302CEA7E38EB9627D7EC6CC0F7971C5741AA7E5
+3E5F48BC5F8648750779E38A9A58D3BBADC55FF70D8E010D
+507B72BF406EB21C67B8556ADD3684D5EF3EFEC0C12A9F78
+D7B6D37BAF966A9F404DAD8CE88BDC2223B5A4A2B593D41A
+6D01A7AF9ABF1D0A553C48C09A7B99D89FD3FADF900CBB01
+8405853EEC7DAE8832E941619D9AE2234C6DD36F3A1D5D98
+9308E08FE1CDA8B29B9EA1A4C980755C8BC00F9C31BF35F6
+9A1654A671BE80B135454415C00FAB8027D67351CB4142D5
 exit
@@ -5282,4 +5282,8 @@ CE34E4879337300772FB0D0CD2CBB57402B43126AD3DF34A15B21993
 F8F8FA5EED1F1EF3FB6BD9CB61FF7782A6AC40FD7FFE756C3294BD15
 0
 0
+eccp_multi_scalar_multiply 1
+3
+eccp_multi_scalar_multiply 2
+200
 exit
@@ -1973,4 +1973,814 @@ gfp_mont_parameters_order_n 546
 0000000000000000000000000000E95D1F470FC1EC22D6BAA3A3D5C3
 D4BAA4CF1822BC47B1E979616AD09D9197A545526BDAAE6C3AD01289
 F861AC50D8EA6CEC3825448529DEB3366D62587FD6E242706A1FC2EB
+gfp_mont_square 547
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+gfp_mont_square 548
+00000000000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+00000000000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+gfp_mont_square 549
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE000000000000000000000002
+00000000000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+gfp_mont_square 550
+D03BD88EB4F5BE7184722D91FC0D41B879541E539A4A4094E73BFF46
+53CE6CD1F5F02A417ADB7176FF43B55254F511D27187E40D7181C4C2
+gfp_mont_square 551
+E0575E19DC4EC35EBB3DECFC62B1DFB47EDFF530CA654AB3A8E18836
+96FC7DEB5B4F91F754119DD42848CE998CCADF351CB9C4BBB30323C4
+gfp_mont_square 552
+3E1930E77F0FD8CD1FAE4C14B7C500AF095C3CA0015892BA6280F07C
+527C3DC31A673571A1D150B7EDC9D8B7BB443FC0D1B889E0DD0F5749
+gfp_mont_square 553
+5E7978FB9D58BDAE3CFE8BF90EF0D6BC784D2FA8C9B9C3C98EC006D0
+A29A543A02A04BA6B4F972B09893917C7E456F7CACE6A412E5CFED9B
+gfp_mont_square 554
+86CAD94641DF101A38739F9148E53E66414B76ED976ACA183C339A16
+80459A5C604D1CC54A4E59AA37B5DD1C7A7B1D3AEAA06618AA973F9F
+gfp_mont_square 555
+2FD74B78185C74551F8B570E36BEC9C30F034A30C0C6165188A29C9B
+1B1CD987DEDFF6315BEFBE925D9B42DA1FAEE896179CB5B2BD7D623E
+gfp_mont_square 556
+02155AEE30153331FCB49E530FAA8A2664E1D343009420C246D5520D
+A00D76BD8A499FDA220FD97D38DE8F477AA9B77E38D82494328CF009
+gfp_mont_square 557
+5A6CF4D601E68B8EB1D1D69DE6383E86A2AB1436ECC86DE59B24C134
+208ECE52762320687F6E57C40BD5F65BAE5315CFA3583A3DF4111484
+gfp_mont_square 558
+1E808CA7EB584673D3F3AA0D4FD1BC3FBE014B49D64A11DD9CD258DE
+33E26EA31D4AF600FFB6E3983BDD6BA77F54DEFF939FCA58EACD7AA1
+gfp_mont_square 559
+737AB55FFAAEC8705A103C295F0A67EB7D36FB3194CF3B330EB15D37
+79D9C1AC4CFBB16C321DEB397AC61CC7327BDC8C4A0E6B4F7D5979E8
+gfp_mont_square 560
+170176C71194B979C19224CD1BA349E813CFB5E2AC8F6AD0C3253390
+ED558336DB40011050BDF784073212377B246BF18E3AF268BEA4EDE6
+gfp_mont_square 561
+B712741E45D777D48F2A54C38C799905E00F4924BF2DB1CC0FA5F7E1
+B0B51CA6EFD304F859F35B24E986D1D618B9D4F10774405316B7DC88
+gfp_mont_square 562
+A29592FF9A20AA9348069217322E0CA47E6FC27D7E13ACC9AD00F28F
+5E330D80EAFF174F77C549F52FD27368434E6A8A842EEBFDEE861ADF
+gfp_mont_square 563
+1374D93ADC564483B855735978839436F36C36A22296EA168F578AFF
+5DC273D569878BFDEC5DA50D3DE6E5F8C218C24C51AB46258D600DA8
+gfp_mont_square 564
+1849201467DA1CD4253A0647F47B89B23BEEB32DD76CDEDEAD7CA3EB
+E209EF69A0F20004C730EF6185965914E5BBAB2E4E6F88F40859922D
+gfp_mont_square 565
+5141E02445B45DB270379E9F43C48C90B05C7296B1BE59A789AD41FC
+5DBD755CE7EED4EF6182A313E819027ED148BADE625B2C8AC874AA09
+gfp_mont_square 566
+59ADCBEE99463D5596D6A756CD47AD028C2B0DCF8EAFA024CD43B4BB
+9A86EDF15C87AFA8083125E35326F597549420E0318618C0F7C63347
+gfp_mont_square 567
+E7B7F7768ECE389CA9298174509D595BB7575F2BFF8D8C60AF777BDD
+3898AED403F30299C06DD4C107341478A2EFEEF83AFE9A144AA4FA59
+gfp_mont_square 568
+C564A0A89293F3FA3DFCD0CDA1D0323B104E7BF05FD6BD8BBD325A54
+788BD57BB90A304E58561F7699FC8E0A7E120B554AAB410C3F73FB3F
+gfp_mont_square 569
+A697CB513B79AA228EF0090A9A5A5B0E40F410C9F3815FC39EEBE788
+DBEF698E2A643FC0C7507DA2A65028F1868D05DCCFFE492D3C92BD10
+gfp_mont_square 570
+D05BFFFCA080ED29BD6DE40628DCD0C2E7CE42B227A1060EC673F6FB
+C765C5B3DBC2C226509471EF5A3B7358711B5CD35F6F006AC25C9EB5
+gfp_mont_square 571
+DD1EA7B8F00F89D751299E4C68FA805B2D9F800BE16790949AFBD7FA
+0263DFDE28D9013C78164F579E5F58598D5329B3D72950369490F48D
+gfp_mont_square 572
+68CFE83ACBC77A9F92F47BBC2E2CFFB2F2D115C735B4B528F8F8E201
+BA4D2D82E4D26F43E25CBFB58315432C805D8129BDB63C2776DBD4FD
+gfp_mont_square 573
+093F1BD9618400F308F580DFF18B71BA36D5015B972F7527EBD440CF
+183B0436808C05B22F72F2DAAC78ECD9B00806C5AB337EE365E7AF89
+gfp_mont_square 574
+B1E95E923BFAC349EB8E6F3E35A2FDB0625A0798500586B3F8F52B56
+CBE990B7F0102AA70D0E7793FBD96D2B0136489B99977B36FF9636ED
+gfp_mont_square 575
+BA8FA83CA2C5C2AE76EBB15B87B7C9406E2153B57B3B83E8DCEFCFA0
+75F982097077689BEB9BFA57130E25C27CC5949E61891DCA2F156726
+gfp_mont_square 576
+509BCB8728993E2861DE444B001B9F521DEF46CBE8FDAAAEA04F82A2
+86CCF4D6882531084F1DB7BD8B7841678AA055676169105070604DA8
+gfp_mont_square 577
+D274FF2BE0B8D5485E265CCC4E6F6E0DF80C5EFD31B3C90E950F107D
+FF703DF0D24F7484D0660099DD71847FC07D6CD7919D8B311BE7AD78
+gfp_mont_square 578
+CA4D91BB60E0E6E7E3A9BE43CDD5DDB30C6CC3E63A797552F6662FAB
+F0260A2F8AF29E45AEF9DEE961A13C5AAFFA42B3FE51C0ECEC950DB9
+gfp_mont_square 579
+B7FFC13C2E42BD8391E2A3D3BFFFB5743EE30BC3F18ED31698EACEC1
+235415DB65F5A7E8E029B56300E83AB3C83FF8030F8E1E0A93A29755
+gfp_mont_square 580
+3DF6860AC7E9DCA9309E8FA27FB00397D1582CB7A62652FB8A1274FF
+702BF26ED4E0360FD632BD9F0DACE4B07717EF513F43C8F7878C60D5
+gfp_mont_square 581
+8F2D07FB006DC43221C46F3F6336BE406F072ACC1015A97F5383FD0B
+2D40A8DEC317834D50FA20F6174BF657553D1904F0710B742A8DE81E
+gfp_mont_square 582
+EA2BD38D507725CBAD790A21E99A61FC19AAD8C617306589BA9FD996
+FC2360EFE1D52F31B27CF9E0D0D5391BF21D35944ABAA905A4AC2FEA
+gfp_mont_square 583
+40F4C9264556560023D3D6F486F79DE9A2BB9946C3E1BB4C5F08D801
+FF54393E13736713959420A4CDFFB9EAE74E680232DE090674E918DA
+gfp_mont_square 584
+D131332D5E133747901FA575E9E46908F48AECB4CD32EDEE16C2814C
+69864C23E379E5E25198AC408F8C824650E77CA379BFAD0B5E72DB88
+gfp_mont_square 585
+32D949D28A7E7BDD028DF29CD92A5B415B5BE414D62879E5FCF2426E
+9049B8093E5227026470C7448ABA8FE895699BD1B10C3D6A50C4891F
+gfp_mont_square 586
+DDF21861AB5E17257DD18BCD238336135058BE4452002317440D2C07
+50238B7960A746C37AC3EADBD6F202A53F256D3C7086428722F15BB5
+gfp_multiply 587
+00000000000000000000000000000000000000000000000000000000
+40DDFED8411FF179096C1DBB081A3CFE300DC4C27FA2EBBC37396957
+00000000000000000000000000000000000000000000000000000000
+gfp_multiply 588
+00000000000000000000000000000000000000000000000000000001
+D4BF81156D86B88DE3A9312CA5BE57D93FA3549B71895AA36BD5231F
+D4BF81156D86B88DE3A9312CA5BE57D93FA3549B71895AA36BD5231F
+gfp_multiply 589
+00000000000000000000000000000000000000000000000000000002
+38146A2F0970425B7DEFB12B691E8E3B705620733DEAADDD33A760E1
+7028D45E12E084B6FBDF6256D23D1C76E0AC40E67BD55BBA674EC1C2
+gfp_multiply 590
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000000
+7A4E9BA333445533FCD71D42A6D00E3468C946B0FF353728C6173D94
+85B1645CCCBBAACC0328E2BD592FF1CA9736B94F00CAC8D739E8C26D
+gfp_multiply 591
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF
+4AFBFAE4877C606FD5B8C2551F4D4CC5091B5FFBFF651B9052496E1E
+6A080A36F1073F20548E7B55C1656674EDC940080135C8DF5B6D23C5
+gfp_multiply 592
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF800000000000000000000000
+3FC24EC0952989C17D9C649A8BD5BB710A77EC0C9B44BAF5264ED787
+601ED89FB56B3B1F4131CDB2BA152246FAC409F9B25DA2856CD8943D
+gfp_multiply 593
+80000000000000000000000000000000000000000000000000000000
+F87A7976AD448ABD9874F8822B2DF98DBCB3FD500E2637300FECF10E
+9959C00C03F4F604917AE4B5BE99F7FFA568C49CA24A9F092BCF0B39
+gfp_multiply 594
+80000000000000000000000000000000000000000000000000000000
+0F30E0051D1615AD353A09CFEAA1B2956C8826EC350D775DFB53E13D
+6DB869482F5178A20E74C19DA2F61C3B42237C8756EE397A67B90A7A
+gfp_multiply 595
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF00000001
+7077B81D18DBB0C1924AECBE4A53583BFF4788955CDB7F4CCDE9D231
+E7244F3E6DB51341B5ACA7C39040BF4CA32480B332162DCF7077B81E
+gfp_multiply 596
+00000000000000000000000000010000000000000000000000000000
+C8A38E7B5D7D255F2B68BEEF746CCFCD0B77D43A5D02DB430267CE8C
+CFCDD41B62B5BA8000A22DD08D7AABC87184A282DAA0D49741108B94
+gfp_multiply 597
+8EFBC170A26A25C852175B7A96B98B5FBF37A2BE6F98BCA35B17B966
+0692B534758240DF4A7A03052D733DCDEF40AF2E54C0CE681F44EBD1
+8252FF41B4B0661E49F1AF085FC511C28C23AF00F36A5C88B9F3D62A
+gfp_multiply 598
+B54A23020FC5B043D6E4A51519D9C9CC52D32377E78131C132DECD6B
+C8A38E7B5D7D255F2B68BEEF746CCFCD0B77D43A5D02DB430267CE8C
+D6C3E96EE6CDDB37742347EE93DD8807F109739D7FA22C0A42377217
+gfp_multiply 599
+3CC75F3EDCB285F89D8CF4D4950B16FFC3E1AC3B4708D9893A973000
+38146A2F0970425B7DEFB12B691E8E3B705620733DEAADDD33A760E1
+39B72706AD353548BC816EE218209D24D68CCDF05B36BAE64929A427
+gfp_multiply 600
+0692B534758240DF4A7A03052D733DCDEF40AF2E54C0CE681F44EBD1
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF
+F2DA959714FB7E416B0BF9F5A5198463217EA1A3567E632FC176285F
+gfp_multiply 601
+F469AEF8F6E7D078E55B85DD1525F363B281B8885B69DC230AF5AC87
+B54A23020FC5B043D6E4A51519D9C9CC52D32377E78131C132DECD6B
+DE38E18060A751ED1B107ABAE2857BA720FED9C0173B04A4438E0E6C
+gfp_multiply 602
+52A3B18104A7F00753BE4721F5B9E1F5ACDAC615BC20F6264922B9CC
+22ED93874AC034CF71B34E47E4E2AAFD310096249E2387A54B1CEF39
+60B703D6F185BCCFF2014426B3E2CA2B14BDB9FA88E2C9CF80863AA9
+gfp_multiply 603
+6911C9DDA6E46653C676176A272515CDF74C381652595DAF49FBAC36
+4AFBFAE4877C606FD5B8C2551F4D4CC5091B5FFBFF651B9052496E1E
+BE1680ABA0448A4ACE93DF53956F918DF39BE6B5A6E868BD6044A5C2
+gfp_multiply 604
+13E7D611D163B764AE17584A9ED9C621DE97FAF0F17CA82CDC82F252
+00000000000000000000000000000000000000000000000000000002
+27CFAC23A2C76EC95C2EB0953DB38C43BD2FF5E1E2F95059B905E4A4
+gfp_multiply 605
+22ED93874AC034CF71B34E47E4E2AAFD310096249E2387A54B1CEF39
+00000000000000000000000000010000000000000000000000000000
+AAFD53EE29ABE8E3BC74BCD03D80C1F46C78B53FCB308E4CB1B81B1E
+gfp_multiply 606
+92B607D554D08CE628ADF9C6F6396AE3994B971761B2CEBA40031AD6
+6911C9DDA6E46653C676176A272515CDF74C381652595DAF49FBAC36
+BCC861460AE9A448349828311EEAC4AD1A90771FD3AB0F9AD68F9A2D
+gfp_multiply 607
+C8A38E7B5D7D255F2B68BEEF746CCFCD0B77D43A5D02DB430267CE8C
+F87A7976AD448ABD9874F8822B2DF98DBCB3FD500E2637300FECF10E
+78DFF3D3165D99D9EEE9D073623C94A2AEAF96309C2B66C11B010E81
+gfp_multiply 608
+7077B81D18DBB0C1924AECBE4A53583BFF4788955CDB7F4CCDE9D231
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+gfp_multiply 609
+0F30E0051D1615AD353A09CFEAA1B2956C8826EC350D775DFB53E13D
+80000000000000000000000000000000000000000000000000000000
+6DB869482F5178A20E74C19DA2F61C3B42237C8756EE397A67B90A7A
+gfp_multiply 610
+F87A7976AD448ABD9874F8822B2DF98DBCB3FD500E2637300FECF10E
+F469AEF8F6E7D078E55B85DD1525F363B281B8885B69DC230AF5AC87
+7541FA04F6851BFF3C605C34894F9379C21BEE45649A150E65124547
+gfp_multiply 611
+3FC24EC0952989C17D9C649A8BD5BB710A77EC0C9B44BAF5264ED787
+7077B81D18DBB0C1924AECBE4A53583BFF4788955CDB7F4CCDE9D231
+3253F10F9862FB9F4E66AF14916378A6F005AAFB4792C07A9DAC2277
+gfp_multiply 612
+4AFBFAE4877C606FD5B8C2551F4D4CC5091B5FFBFF651B9052496E1E
+D4BF81156D86B88DE3A9312CA5BE57D93FA3549B71895AA36BD5231F
+676E9660FC3C81D79BE9FDA04B3A0D9FAF59F3952461452C51A2B43C
+gfp_multiply 613
+7A4E9BA333445533FCD71D42A6D00E3468C946B0FF353728C6173D94
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF800000000000000000000000
+C2D8B22E665DD5660194715EAC97F8E4CB9B5CA78065646B9CF46137
+gfp_multiply 614
+38146A2F0970425B7DEFB12B691E8E3B705620733DEAADDD33A760E1
+3CC75F3EDCB285F89D8CF4D4950B16FFC3E1AC3B4708D9893A973000
+39B72706AD353548BC816EE218209D24D68CCDF05B36BAE64929A427
+gfp_multiply 615
+D4BF81156D86B88DE3A9312CA5BE57D93FA3549B71895AA36BD5231F
+92B607D554D08CE628ADF9C6F6396AE3994B971761B2CEBA40031AD6
+965769D965CFA549C6650B9499904674CDA897743154ECF4A3386FC4
+gfp_multiply 616
+40DDFED8411FF179096C1DBB081A3CFE300DC4C27FA2EBBC37396957
+7A4E9BA333445533FCD71D42A6D00E3468C946B0FF353728C6173D94
+0DE4138E883816CE3C41703647E2E47F3CFBE81DACCF3C7FD131A834
+gfp_multiply 617
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000000
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000000
+00000000000000000000000000000000000000000000000000000001
+gfp_square 618
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+gfp_square 619
+00000000000000000000000000000000000000000000000000000001
+00000000000000000000000000000000000000000000000000000001
+gfp_square 620
+00000000000000000000000000000000000000000000000000000002
+00000000000000000000000000000000000000000000000000000004
+gfp_square 621
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000000
+00000000000000000000000000000000000000000000000000000001
+gfp_square 622
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF
+00000000000000000000000000000000000000000000000000000004
+gfp_square 623
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF800000000000000000000000
+BFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF400000000000000000000001
+gfp_square 624
+80000000000000000000000000000000000000000000000000000000
+C00000003FFFFFFFFFFFFFFFFFFFFFFEC00000000000000000000001
+gfp_square 625
+80000000000000000000000000000000000000000000000000000000
+C00000003FFFFFFFFFFFFFFFFFFFFFFEC00000000000000000000001
+gfp_square 626
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF00000001
+00000000000000000000000000000000000000010000000000000000
+gfp_square 627
+00000000000000000000000000010000000000000000000000000000
+00000000000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+gfp_square 628
+8EFBC170A26A25C852175B7A96B98B5FBF37A2BE6F98BCA35B17B966
+9E539F4141F797730222A45E76CAE167CDE11E914CC2264C710FD3AC
+gfp_square 629
+B54A23020FC5B043D6E4A51519D9C9CC52D32377E78131C132DECD6B
+3785AB89063E629DF1D61726C93933A40F19EF57A3A93B124FF4B1A3
+gfp_square 630
+3CC75F3EDCB285F89D8CF4D4950B16FFC3E1AC3B4708D9893A973000
+DE3CCA55ECE64B9CAF157117F5D96CFBE98A78972630946298332F47
+gfp_square 631
+0692B534758240DF4A7A03052D733DCDEF40AF2E54C0CE681F44EBD1
+EE2192975B7819F40CD3DF8E69FC01CBFDC2CC333DA625B9DBA13BC6
+gfp_square 632
+F469AEF8F6E7D078E55B85DD1525F363B281B8885B69DC230AF5AC87
+8899776B79A44DCA0B82603083ACC0D770AE1BFE590DCA4A57F9F71D
+gfp_square 633
+52A3B18104A7F00753BE4721F5B9E1F5ACDAC615BC20F6264922B9CC
+1C85822FB9BC36F95F03CA7C44B6E379B8FD0919650C0006EC1B7A5D
+gfp_square 634
+6911C9DDA6E46653C676176A272515CDF74C381652595DAF49FBAC36
+E810287BF2392A230ED09FE4EF13E4163BAC32680EDB6488E4E4DB66
+gfp_square 635
+13E7D611D163B764AE17584A9ED9C621DE97FAF0F17CA82CDC82F252
+4F7B39957AB9AD7D3F7365F77E1BEFA658D44ABA2AF1CE14EB0F4E07
+gfp_square 636
+22ED93874AC034CF71B34E47E4E2AAFD310096249E2387A54B1CEF39
+F3D6E85D0CAB83044B940EBB192AA5A5C5D0286E905064F70311E7DE
+gfp_square 637
+92B607D554D08CE628ADF9C6F6396AE3994B971761B2CEBA40031AD6
+61A655114119A22C10CA57E6744507284EF339C45C2A753B4C5A1585
+gfp_square 638
+C8A38E7B5D7D255F2B68BEEF746CCFCD0B77D43A5D02DB430267CE8C
+4F5F2FF99051A36F798E70BAD1BC25BFBFC7A615FDBEEE72D776B184
+gfp_square 639
+7077B81D18DBB0C1924AECBE4A53583BFF4788955CDB7F4CCDE9D231
+B25B6F172BD7DD1B6A0EECDF766E16D08F844FA19BBD5BCA02C4F2BA
+gfp_square 640
+0F30E0051D1615AD353A09CFEAA1B2956C8826EC350D775DFB53E13D
+69B7CCB7E57DD8A470455B62A85E61C76918DA75CBD637FE218DF28B
+gfp_square 641
+F87A7976AD448ABD9874F8822B2DF98DBCB3FD500E2637300FECF10E
+B756C6903917B4FFD310F839F91279096CEB0AFC1A44F6C0A27B36DB
+gfp_square 642
+3FC24EC0952989C17D9C649A8BD5BB710A77EC0C9B44BAF5264ED787
+E0DE0811B98983B3C8E33230F1F48968A6DB24B2FB0A098121D56C71
+gfp_square 643
+4AFBFAE4877C606FD5B8C2551F4D4CC5091B5FFBFF651B9052496E1E
+9A1698BC424A4A9E2197636CC886C61E8FB813FE48836320A2621FE8
+gfp_square 644
+7A4E9BA333445533FCD71D42A6D00E3468C946B0FF353728C6173D94
+216AC243E45D73B5B89CE380696E9A5D46508F62AEB2811081B01799
+gfp_square 645
+38146A2F0970425B7DEFB12B691E8E3B705620733DEAADDD33A760E1
+2866C30D86A2D8708BCB61D27E06A199520A296B9344ECA9370A5AEB
+gfp_square 646
+D4BF81156D86B88DE3A9312CA5BE57D93FA3549B71895AA36BD5231F
+34013501E708A4E9802ABE6C59C13020EF45BF96E6467A3DBB4E5C75
+gfp_square 647
+40DDFED8411FF179096C1DBB081A3CFE300DC4C27FA2EBBC37396957
+FA668B0934CCEF6E5E85332C6055114106A59349895C9E8AFBCE31F3
+gfp_inverse 648
+00000000000000000000000000000000000000000000000000000001
+00000000000000000000000000000000000000000000000000000001
+gfp_inverse 649
+00000000000000000000000000000000000000000000000000000002
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF800000000000000000000001
+gfp_inverse 650
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000000
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000000
+gfp_inverse 651
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF800000000000000000000000
+gfp_inverse 652
+E3B71827DED773C7AB9359239A6A1942E46AF45916CC725CFAB0861D
+1F89678AC876D582155920A520F95FABE176DD7E6B8953F3E438B7ED
+gfp_inverse 653
+13939704CBCD22316148E544D4CD6C70C8AE360C727B510972346C39
+C33EA70076F3590358A3C830164049815749BA720A906F9DCC09B8E0
+gfp_inverse 654
+68B86705D10844C1B4A6FBE14DAFAB5E788EDB0F6D29E99B844593CA
+643B7C33B9328B1582BD1B8D51F9BBE27323E8636D9019B672D2C217
+gfp_inverse 655
+738C3585440CC2D6AE2041FABF1BAA5E3130708515FF90EEF0D35D23
+1CBEDEAF78CC3FE4BA1D6B90D70834BC330D4AF15EBD36F4ED633EAA
+gfp_inverse 656
+05997E1804BF193F2C10966FF70F14C2C8B62470B8FE1AC77CD78C3D
+6395C2CDAF6612C00DFB74E8C775A52E443F1BB6B6C439E791961C69
+gfp_inverse 657
+3003DF0B5C6DB724CD4153E496E3F022404A8CE91F9D639689B695FF
+67EAF10365BB1819A84EF01D85CDEB5398CDBE444D96606D73BE76C3
+gfp_inverse 658
+41382C8A8451C28DED77010D5456305A7397AED480B35782419DAD4F
+180EBA27AFFFB8CB3DFEA8C1B41674799C50E380AE1D0AB7CC20DEF9
+gfp_inverse 659
+7C43799C9CB7A4716BF7578EE119671FED4B4741691B3874FB4798CC
+642E97E737CC056231E35FAA6DC3D95D2F38CE1E6A27CBFE3B83748A
+gfp_inverse 660
+24663CBD7DF5294E7A8187F7A8027601798686239A3C796744978D4A
+E127B192EF1C9E22FD5519BF337E5211C5571E2223126DB3A07581A2
+gfp_inverse 661
+779E6E65CE038150A26C89324E409ECE7F2479DB60A267D1B8A578BD
+476E23769FFCBD9421CB91F61EF894D1E32D3DE4B4F267E55A5059C6
+gfp_inverse 662
+EC4EDD58E9C0CEF4F884203F29BC6792A8C428DF5DD1702A52C9B40E
+DC5993A15F633676CE7175C810BDE998BDAC606223E0D7E497CF9B5E
+gfp_inverse 663
+A566BE8151F2ED16440BBBAB9A604476B1C7A0976044572D9E93CD34
+CD6CDDDD3089B8026EAC5DEA3A628566B5C9826D41675677D8340AC3
+gfp_inverse 664
+EFC5D3FA287EF499CB1ED1BDBAB3C63E7CED7C4CF99A8EE465F5C7F9
+9585955A3F824A8329B1E928EA286D11E64A2AB223D0D6EBD21DE111
+gfp_inverse 665
+F6F3B2277309143F9FB04EB00195D1AC8F52F3584A7132BED3E38010
+07FC1DB4B20B7B0DCEE6F0E241B228D945BB007BBC198FAC4BD82071
+gfp_inverse 666
+1CB550C191DC720FC608DF619C2670EC07B576982EBD722E0E9E6FB5
+D1368C37AD89008D5DFA19603B6907AB0A4B98E8DCC3EFFD0835637D
+gfp_inverse 667
+7F58463CF03DA257FB8BF2CB5CACC63F5EF38747B7F01652AE9DD97C
+F21B0492D0D07B1C8DD750FD228A8231E35E1A5EC5AFAC816A02AF03
+gfp_inverse 668
+F2883E0B2785FE3331504EB7EB55846D0FF13E8396F9D06EDA7E6D7F
+454CDA3FAE5ADE046B107903BAE21F5F44DC1875244499CDD09C8255
+gfp_inverse 669
+CCD71056C8443F08CE6415A36C0F819E03CB7B779D09E88B44EDC7B9
+F600675FA792E556FAD0014BC0E619178BD0EA22A83E23611BDBC88F
+gfp_inverse 670
+19A3C26C3B68B7307809C5E01368E4A97DDFA8EF865D2258D042713C
+EDD7A5D418C1A87B10D4BDB141C63DFFFB97A4B7990ED4E08B6DD94E
+gfp_inverse 671
+3E4CD845A026E64AAE50328C251C022FF6432CB95CAA327D5EF42F26
+43B18B94756C2F5A84401C05C4BB89D4FE23E4886B5A4311A397C8B6
+gfp_inverse 672
+18EA1BE6AB0C6793A0C517E909A56B0124EF4A73517DCA2C9B48D67C
+2DF2E3866E4609F43A5B7BD136030C1B65D7280A3E97594EC3E96053
+gfp_inverse 673
+B95E481E767460E57A560FB6A544161E0B967FE21AFD8E86B6C4787B
+E930929C4DCE2E6544FF3D7DB58DB0560D36CB9193E0E8C433AC8B48
+gfp_inverse 674
+2083817D8D2A5349B38D03CC07E58951A113147211A9DBE8E64B3AB7
+4E31B5330B0698B7C38233F75C4CFE9234249E0564B056333F124115
+gfp_inverse 675
+A194E4B09E3D39B2293B228E15631CB4EC97480BD5296C989DDAA1C6
+EAE0392834A5E6ECBB386207958E2129843BDB206EC7DE1474F8AE12
+gfp_inverse 676
+73B536A3A77ED5FCE4AEF511D6A1FD17E860F44843E32D2CE95166EA
+8129469142EF2F6A35B56CF070240E5348714F179B1091412A70AEF9
+gfp_inverse 677
+D178C525231726B7A32FDF8BCA94C3E605314446B19CE70A7FEBD820
+D64D353A811DF1C6F5D0D9E2D8F7195BCC4C39C3EA28A0B4B36D7D04
+gfp_sqrt 678
+00000000000000000000000000000000000000000000000000000000
+1
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 679
+00000000000000000000000000000000000000000000000000000001
+1
+00000000000000000000000000000000000000000000000000000001
+gfp_sqrt 680
+00000000000000000000000000000000000000000000000000000004
+1
+00000000000000000000000000000000000000000000000000000002
+gfp_sqrt 681
+65E7E4236472F1A38F2C6EC8CC4169A3AE3A2B7FDFE01893F3AED0B8
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 682
+F73CD679AEA6CADBE24227A12ED8E9B065334C71DD903AABFC694949
+1
+0FEF792866836886A260CD0B7B45145C1A81682C64E50CAD66237A05
+gfp_sqrt 683
+057F54C59E39E3D1F99246D7476F2174CBABA8A36FAEA3A96293F1C4
+1
+1C2442F9298CB3A570CCEC313571810AFC132D0D113DB17D30CBC97E
+gfp_sqrt 684
+1200339D068739FA9D1DE2A05D158A2FF2EE4E4519F9919C895FD7B5
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 685
+929BECEEBBE9D74A8F660D152C0F055043F7343D7B674926AB6FD292
+1
+4093F6DEA268AA872607679D6050914A9D33A01C353C631CDFD43F38
+gfp_sqrt 686
+A03D616A556B50C4DC02649AC39847604C0F20AB7034BAB1C81CE554
+1
+1D87CEC31F7296AB7961FD925D39D0A89A2EF80F58EE8571F4998D7D
+gfp_sqrt 687
+7BDC968B7AFB2C68774B15D7FA529BA3FE3BFADA7CF20724D953EE28
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 688
+A5D699EAF5E0C4DFB75B8250CE407CE60E3E35EF4BC5DAA22FCCFC22
+1
+BD87A86557B6FB7EBFEAA1551A28F7B324E4E25A15FC899E4FD58DBF
+gfp_sqrt 689
+0DABCB21AA3AF54029FF91D4EB8830E0C4544ED2BBD65A6C8F4B61E3
+1
+05E999F3842E7FC229540A6EB12AA1F6D42FDDBB7A86F7A243C71B9B
+gfp_sqrt 690
+FA7F0EAB4C4F9B0687322E25C215A82A06EC41ADEA0575438B0D590D
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 691
+A68E6C9EEC5DB643E688C1CEA05DB0DA2C7E47267760A5C5EA125474
+1
+84B5A81842D87208D86F40F6B239F3C7174C77A2DD02DE92A49636A3
+gfp_sqrt 692
+28084FBB2BDEB7A3D6A5D80AF805065AE592ECB161BCE52DEA682D49
+1
+8857F9A43908F227C59DB9165B0EE76F2AC34446E883A1D45DE00998
+gfp_sqrt 693
+332DD3313A0B9965CDA6C6FDBD68516766934036D17E44973D4882A7
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 694
+0CFAB794F32AD06494ECBA99357D82F8CD2B253DE8CF0780C729321F
+1
+0726E25CFD56A926076B3E36BB2313F55B06258E7E26F36A8483F8B9
+gfp_sqrt 695
+58B7E17F1D53744DCCDDA7A793A6CFA0B3F63362FD6397C2CC54FF0E
+1
+9AEA6429B1491E243192B7044259405278E4B98D4787F93BCA44EB87
+gfp_sqrt 696
+1A26F88938703800149E259B5D58C705F979D04AF47AEBDD597A1ED1
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 697
+49CF58F7D9186283554E2D0E83CDB80C25BB3AA2F7EA5F49952CB665
+1
+9FC2D0A17B8F2AB53451D0135675F6AD325B55DD785729763A12917D
+gfp_sqrt 698
+EE8D980AE31DF47B4E31116ED194F8982D61EE81BCB9AAFD94D28910
+1
+E8C147437ABEC539007D1034D726C86B9C3A23CDE67A9B75FC394725
+gfp_sqrt 699
+77216E9EE7A46309973F798626B1CFFC070D710920859634FE3C9C91
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 700
+15DDFAA6284BBA53C9F1A9891686285EF57A9A46BA9ED89A19B60761
+1
+FAF55496988AF3FBD39630D69C9011EF256BADF9A7E6529BCE76E9F5
+gfp_sqrt 701
+992189AED2F95DD18CB1B5B9D928C6F4889A8CE9B6A7D488069C6A79
+1
+8C5C715F8C74FC1E27E9E06F59B44E92EFFDDEEAA842BC19796F74AE
+gfp_sqrt 702
+537409029620BF0DC38084A03D93FD4C804C25D64AFFDCD13678BC8F
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 703
+FD33CC0F44610338E23C87BD4F0A0574E7F8AE6474846D4E73305173
+1
+E8F6E0BD0F977044218E0B7BD58DCDB46B4468068B5AB3EE4265BB32
+gfp_sqrt 704
+D797B8BC606D7DFAE6C2525D57A66E12C8325FF99FB3DCCF0513B97E
+1
+D0A6EC179556585EA997F351754A09CDE5CFEDFA5A9196F0BD6B881B
+gfp_sqrt 705
+CC966F46C6AA7D550101B8119BCA3CB72EE0289DC6C91B9270AC06AE
+0
+00000000000000000000000000000000000000000000000000000000
+gfp_sqrt 706
+84C68216E24F39CB7146873502E9FA473333338B508FBD0C6545D4F4
+1
+1ECE615DB9A6442E9E7D6B377936D536243D35702C1EEA1F265974A8
+gfp_sqrt 707
+3B01122738DF8F61D59637042EBFB58936B13E1FD74800D7971E4B1C
+1
+8E31704187DDAEB784B28054AEAD44B0537390E50FCF31CA8E752FE0
+gfp_exponent 708
+00000000000000000000000000000000000000000000000000000004
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000001
+gfp_exponent 709
+BDA2C3C0F1011970CE8920055E8769E5BE85A881FA0FCADB6B633FC2
+00000000000000000000000000000000000000000000000000000001
+BDA2C3C0F1011970CE8920055E8769E5BE85A881FA0FCADB6B633FC2
+gfp_exponent 710
+F5015E1DD4CD1BF2A00759924D5B153B842A8B345221CCF7D9B93936
+00000000000000000000000000000000000000000000000000000002
+AE5CC57E4A110E23166F15012B66152DA32BE1B013208D9709C68EA2
+gfp_exponent 711
+1BFAFBA8D880E283A6C10EE34BBB51A3E5307FEBC8849B0B5B5BC065
+00000000000000000000000000000000000000000000000000000003
+99ED07A49C7F433229461C21AEB971BF01A471731A8FE1F9BA11C367
+gfp_exponent 712
+D8D89FB195C08E66F565BB5360EBB07E5EB67FFE7C36D388321C1631
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000000
+00000000000000000000000000000000000000000000000000000001
+gfp_exponent 713
+622B59419CEFC26265A345614A5DE675348B3E1C4FDEA642EB2D0109
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF
+E1718F00DC91BD0E1840A418FEA1A09A5E0E65381E5F7E13542C1BAF
+gfp_exponent 714
+BA605D46B0CD59BBEFA0E7FC860E6317AF30D726EB416632D7B71A7D
+80000000000000000000000000000000000000000000000000000000
+1D65ED8CD44C158DE651E056E0E9F94D80B62FB957EA863DC588D853
+gfp_exponent 715
+00000000000000000000000000000000000000000000000000000002
+94AB25891BC4078E1F3CD5CC618EF7C4278E96B5CA4B3BC77922D4E1
+6FAB8E7D10480B46F4A343EF22A096834800949BB9504DBF4CB17C0E
+gfp_exponent 716
+6D70BCECAC4FC8795CB808B195CB42389ADD28AAAD0F8FDDD227F468
+0000000000000000000000000000000B205F263CA5DDC16773E3705E
+A8B4FDDEC346CF70A6529E1DB528573B8FBF8087B92501C13B089ADD
+gfp_exponent 717
+14FC9A3DD693CFE381DFB570876833E9D29BD15E7D6CDB3432252B85
+00000000000000000000000000000000000000000000000183B52204
+F63B71480C72440570060347E3F3234F0CA814DFA05F4FD1AECC3A48
+gfp_exponent 718
+45589D75DDCCACE3BBAE56CA7F8CC6F1119190A029D7AE8644D31236
+0000000000000000000000000000000000000000000000000000000C
+CCB35F9A2E1263DFE3E75045DC613D924E636F20B6E621A317667E19
+gfp_exponent 719
+D330B270D44F30249FE2C78E1DF67F0DC7B239036B73C72BFD1EA52B
+00000000000000000000000000000000000000000000000090591FC8
+657D4E23B4F005277144E07BDEBB6872AE336FC231B2EC4AFF155E77
+gfp_exponent 720
+8115A52ED3483669CDE1A562462B4AD64AA95415FC9A7EC346212C10
+723B90B60C867715328FCF670D09801039BBA7F27490EAC95C5DE9BC
+03FBA46AF9F1776CB57B5D14A4E7010A056C3D6E559318530B4F4EBF
+gfp_exponent 721
+3E9A0356696BEA49A1D61D8FE36E051EFECA05AA46FF0A6C44C35D3D
+00000000000000000000000000000000000000000000000000000002
+3F0E5A471D56EE6B13230279B38F9072A1BBDD3A68DBFB6674C302DA
+gfp_exponent 722
+00000000000000000000000000000000000000000000000000000002
+000000000000000000000000000000000000000000000000000000BA
+00000000040000000000000000000000000000000000000000000000
+gfp_exponent 723
+753B3CEBBF54B97881350133CA4819423F7DF7E8F72771983EEB6C73
+0000000000000000000000000000000000000000000000000000000C
+7C4D806C33D50CA249391118B0460BC66FAFC827AD02FFA4FAFA20CE
+gfp_exponent 724
+D468D957867682C398BAB656CF992031D032A9D83BF68BE63FF96140
+0000000000000000000000000000000000000000E813ED029C8C775E
+CD284A9DF957DAD833659577E5331A12D94E4ACC23EDED4815AF865A
+gfp_exponent 725
+1C938ABBCB1EBDAB1B1246DEC7E04D157F2459B05E3158433204A25B
+0000000000000000000000000000000000000000000000000000000B
+EC537C80CFC10F551C243FF076C84660FE0A09785338E811A99ABD71
+gfp_exponent 726
+FE3AAECF9116255BC7BDD1572BB38014A799DEA1158FB20463501249
+0000000000000000000000000000000000000000000000000001A896
+CAFC1F2DF73D2E5D208FA08666375EDC07C59390440A593FA32DE219
+gfp_exponent 727
+05A7A1C82305A9B0E8FD3EC0C947A5AF0B8E29B9EBA2AE9F6D758FA7
+0000000000000000000000000000000000000000000000008723160E
+9219C0E582BE1836FD8C16276D66431387BB8D6DD9EF27C6E442D7F5
+gfp_exponent 728
+7672EA69186E7AD0164891DF43BF0C71AF5EBC6930F551E29C3BB180
+0000000000000000000000000000000D80A940D599A6DB54C1710BA7
+7E506ED3D172161C255CE9197B61485C462295762CA384F6F0F0528C
+gfp_exponent 729
+00000000000000000000000000000000000000000000000000000003
+000000000000000000000000000000038064365B335F860991A84345
+34079805FBE3916860067BAB8B1666E9B7839072635257F382416856
+gfp_exponent 730
+17BB00F790ECECBAECE16F5D484099B2E7CA2F63AB51BB7CDE63E8FF
+00000000000000000000000000000000000000000000000000010D2E
+79A9E2255FF6DD007182B3728195EA75E3FAB70B0278EF67727395F3
+gfp_exponent 731
+10E3A699A717EF84FB10569FDD7152845B89C0C89B6A05472057CC6B
+000000000000000000000000000000000000000000000001BE739365
+6AD24F67BD0C843F278F631B79AAB43DF87D6EE9F6586F5D5A2C1D84
+gfp_exponent 732
+DBEBE8E0157E0E0AEB7786A8D5EA221009E8F939CA65572051E63E62
+000000000000000000000000000000094A207A5F01B61F9932388D29
+DFEDBBFE274570B257A51841DBE03B360D79BC18A2FB93F4C2972960
+gfp_exponent 733
+1331968AD414F25EFEB4911E5DC28A71CDFA99AFA755180C23268603
+0000000000000000000000000000000000000000000000000001D155
+59C1E93A9E091DFF6AD9DF81C9612357390731521666134DCE834105
+gfp_exponent 734
+51BD47BCCA4F12BF99886455097CDA70B986EA793B114848D0970480
+0000000000000000000000000000000000000000000000000000000C
+9CAD9AE52663996F4972DF7AA85BFC5BABBEA7CCFECC5D30EF010127
+gfp_exponent 735
+10EC8C9453A89717F79B37B55B848E7CBE7A5A424BEDA57938EA97B4
+0000000000000000000000000000000000000000000000000001DAEC
+57BF3FFF98231CFF5E7E534564F3D9A031F18DDBE3F0B449ACE07CCE
+gfp_exponent 736
+00000000000000000000000000000000000000000000000000000004
+000000000000000000000000000000000000000000000001394250F3
+9F972B50BBC2D4461837922A30D9CFC64F6408A3385F17BEF72062C3
+gfp_exponent 737
+6F3F3915591995909C0A43A5B8AC961DEA9FC1051D2EB7F8E66E3389
+000000000000000000000000000000000000000000000000000028C5
+48EEF49A282FD0841701090CA3F65BE4AF31B67270D9475DED3F77D5
+gfp_batch_inverse 738
+1
+BAC661D9F6682F99D2B817F65F08F4CE3B29B74C75698F1FE0F4B690
+550E0BEB90E247FEC740D9170534B8FC90B3FE9FF056838359E4808D
+gfp_batch_inverse 739
+2
+00000000000000000000000000000000000000000000000000000000
+681BF31868E6304CAD95132C0C0255E79CFF85B715AA6DC398D251D4
+00000000000000000000000000000000000000000000000000000000
+12240DFD4A4DDCE80296A24006F43E8E2DFD29623E48C3C072970ECF
+gfp_batch_inverse 740
+8
+159C15F42E6A8726C0ADC89A9BAD7CEA08BB7E8C306834D214AB365A
+891B0F4E8C094EDB7861C2F49FE5C4DF5AD3CB5807A51942109BBFF2
+15A85DD55575D7181347CF7FC68C0605B41B7E5B06A6141C7981029D
+971A4FC972FBF5DDF43BEE8A76BED46D0231ACA7524C4B1AC866F1AA
+234DE559D5315B907A6D9040FC7F20BD62D6CC63F9F30F3626095367
+C7AD11DA73946A023B378E73ABD62DAC59488FE9E4873F001B323C8B
+0D7FC2EC1C50B2A11BD8ADBE389D947EF7FBAADB313194052120130E
+5F576F4C15220A04F9E7CE47A533A8F2F0295827131B2EEF1EBE49EA
+86C35FA456D7C177B638435D64558E5EAE70635BB0BCB916FE28124E
+374B5BC12A2D06E80594CA44BB00315EDD1718335A6747FC0982FCA9
+FEEA73BDEE07B668090B8C194CA6D07C8784DF591B4FF589E862DDFF
+91D913FDD34EE3E9EB5EA9F91C73E80087B2B534F7487FEBB761AD75
+150DF919E00A9980AF3281976980819BBAB84AE521E7C0970E27DBDC
+05B6FD5E229753A871D40AA8D36CE91E5FF6EECA3F85934E28AA2CFB
+DC45F643158415512A7D088DA11D8CCDD6AD48C3629EB3B05F0CD484
+694B4470F177368CD0C33202BDAA53F8509107EE0E0A17A6ABD6A81E
+gfp_batch_inverse 741
+8
+335FBF7E85A2AD77A065DFF277AEB03006011581BDB5DC011A86D933
+41A11D010166957F3C7488B614C54C80A27C98A1DFD3E85D5E96C9FF
+40D5F3D8707311D203F691DA328606F9AECAD29484905178C36B472D
+CCCADA3584FA520B1A6ED6CEF5F089AF05B11FCB9C5A7890F1A38EBE
+50AA0831DA050E7F79BF79DD405103F4E61EB23E0ECC32016ACA8F53
+46726ED9AE62A6650F0104C7A391C4BA387FDC5BDFF5EE9C9AF1DEBA
+5A7B26A0F9BDEBC92FCA91A9CCDF1A3409F4CC1A4CD68C0D21D9D376
+E0673FCB01DB5B7FEE4119C867390AF6E6D91336FB4A19C4C94A3799
+E5E5BBBB95CB700190AEB743D9D366CF0ADB50E42A092A82349D27C2
+FD735164E981136497452F1D1EF659221A9CB55298DBDBA969E31E9A
+E59AB02005ED8CE99033D8C10BE07AFE385D3161C579F52184D7B735
+C8C8AC6330F256188DC6F4A347CEC7E63158EFEE3177B203048F882C
+53EB8F127BEAF41C195C43AFDA684E2655E86C7A0CE89C3D7F28288F
+261DED79EECB2DC1FE8E3577F4B42387AF1E03CE0647891CA0395CF2
+1499CADD1C7917DD0B62D6D2FCB19380ADE90C9A93A0A5044C4A9A4E
+B11777BF10988A1515DD6BFDD8A0A6FB7CE5E3ABFD263AF54125DA2D
+gfp_batch_inverse 742
+5
+078B2AB7182B97B1DBF0ED0CF7B098A94D7FDC90EB83797AFA37FE7B
+7DE06252525E20D99AAAEA476AA4D4EE3F4764ED70774ACB51535F1B
+6E19FC49662AE0E5E478A2EED64C7424E17DE40858D12B5F903A577E
+00000000000000000000000000000000000000000000000000000000
+545889432FB3A1F86290DCEB709F773874B67F2C91852CEAECB2FB81
+DC6410D8701C736582DDC5EF4A951564EDD0A1EFEE34F80C2E5E9F56
+89B23F5D07CC0A14648696770DC6C6146C1732B328D8DED376F0DE24
+F6CCF6AA7D9A413B7BBA33894A29C56602326A7BF65D9476F5519773
+00000000000000000000000000000000000000000000000000000000
+136C8FEC158C7CE238BC602DAA8A823BF1E47D4EE1E26DF6F6D52C7E
+gfp_batch_inverse 743
+3
+06E080848B3BD32051489EC62BAA52BD1781E2D45334C6C90F12A831
+233FE09BE58A3D92A8A4AA8B5D56B7CDB62B9453360A725B30459B56
+F65AB21F7273997FF993C495567D1BB315FE878FA0185386F197B591
+785CF796B4C67B755ADAFC59AA2D722616727F82FE635FFE87B48ABF
+4757D3B59751C5837D4EB6E4C3C19E133FD13C959AF828AA12364CE2
+098589E818631A9D25FDAE18D771AADD6B1CF56B79A1C727ADF696EC
+gfp_batch_inverse 744
+8
+BBC9F590AB94D3A1E231F1C7F0C6E386C2F876B499798DA59B473B87
+136BCEF255DACEFEC5791C698ABC864CB26F164B3613635A62865581
+DDEDA1843A3382B678790CE46BFC9FA58D6E1070AB7640B004E5289A
+8099E842839EF083CC96ED2BD564DC5DC392280352DD368BBA2C04D6
+88938A68EAEC394048DF5B6B00D1875AB787F5AB7696A3F6195E4119
+508CDD98EBC5E085FBB529C502C3FDFF394706441248E90234828F55
+00000000000000000000000000000000000000000000000000000000
+D6FA3691A630EF91675D9576FEC79672CA2F07F2D2F60C3482761570
+B8F72C28E2CA868B1B2FC072F036609DC48FF7DBAB0232BE4A0CF149
+B6B2A36C2A1869DCAA88236D772B630AD45267B7F5753BA8CEB50411
+3C9EF47EA47EE069D4FD710D52E6516D44253BC6E3C8BA9E29149E79
+86B0C8987BE819436C8A59B8B17F87FE4D5293FC015E30BE1EFBD260
+AD25D06FA9BA86BA73D45C6447A450E9E585C32E0617477EFD45EDB9
+F09E89AA1D7E7BEFB974392A46AC9C15466163B23D59DF76E310896A
+00000000000000000000000000000000000000000000000000000000
+825821131D0C424A778C07A2320A59926183EC7FB78768E302B62859
+gfp_batch_inverse 745
+1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 746
+4
+5208B2E433B56C784519BB9EF27890675BE700DA5B7F5C54B0B1B9FF
+C6F271389CCD04C1CCACE0C32EB3C971913B786462922219EA3F6BBB
+AF2845FA4E57216F026B51FD2BEA4DE0921E1EF52D9AC7DEDE5022D1
+00000000000000000000000000000000000000000000000000000000
+D19531E48055BD3EE77C2E7BFEF3099FAC6EB99FE787B06DD0BB2532
+41D23B078820BFD3DDC1B0276519F1F760C44E24AE15034034E4A516
+88FDCEABFCEB34EE5F90799D31808C8FB49BAB028078BFD4B1202615
+00000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 747
+7
+24CA433948F28DB745D6BA7217FF4EC1C12FB530FA65AA9DE8807C35
+2DD8A7A13B680B94FE75FC23AE06ECF17A933B527394046E8455F561
+99D43008BE5DD25458FFA478ADB72F71BF84CCBC258C2DDB54BFA396
+941CEFB006B6DDF758259A20EDCA973347517E5F8BA00E1B0D040B6D
+18B8C953C312F694AB491678F35C979BC74E929989AA88C12FB86FA7
+226580F48B0AE497BF71FDCE35F65C18573A3D7C2271E0F9741585CF
+AF8F8222D6D346DC33EBEA0183EECE813771ECA66C3B1B6FE70059E9
+B63D6B127267ED53D844D617C9A5440FFA28ED82D42C636C433302FE
+7EC28F02BA971606AB7E13D22ECF2A3F95D2059F86B2A611BAFF0F98
+46C2378EF0CB310B3739D6CB3CD057E720CC8DB0A7EA3CC2EA855504
+592AAAC71A8BBEC438177498C997B1EE0BD5ADC36C3B731D1899E0DE
+34BD0F5E31DCF6F707E89F9963487F92BBDED2894168489A929B5603
+A488F24CBA82E0D8080E1C9FA94E8467D02235A942688331F70ACE57
+C17327F074DC354B984A25AC1322EEC3106C4A79FDBDB3A19DDBDCED
+gfp_batch_inverse 748
+8
+00000000000000000000000000000000000000000000000000000000
+0F9764635F401FA97F07439A5AD72B63B735DFF0C606B244EFA87FD9
+6FF829E476AE9309E2FD98E466073A0ACC753C24CEE1DFDD5F54BCFE
+EAFA41EE1947B4BD8E549E7930D3927DF6CD250ABA00EDDAA1D44DF1
+429C04DD5AC95E48E414EF8F15BB24EB966202ECF6D150832A8284F3
+2FB387138688BECAF817C395783581FBC474F1AD3F4300BCE3764A70
+55E12A868A31B5AAA9889F94EED056D303156FF987FA535AC2CC316A
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1BEACDC80C0F0B297A8D7B301AAEF3A4AC34AFF5B9BB91406070F3F9
+0BA417D0D32C5201FC0990BDCB20A3659D2FE5534B57E64B0F03EC78
+9B417E65C2F15C7DC67A9D15FE40253FCE71AA5DF3C4D5EB06F6D5E4
+89F89AD349011E67A9CC2663444ACDFEF7FE40158A0D2A922B6EAF36
+ED8B9CD24E68CFFAA37F1109166166B91AC02218C780F6414BB06B36
+9A77D3811DCEBAB8B2E41862B4366B109D7FF3EEAE1ECF71EC1BE9D3
+00000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 749
+6
+A8404B6E334A76FDF87F85DF94C0A51D962B5073DA9736D2B767178F
+4C32BABA548B424421387B56B5086C354894A7A856BBB4B2D5126183
+3ED1258AC791EF6FD269CC4867E37F49138DCD2B093B4F176545A276
+2C4E8A14507AC7C40ABB1698B1D4937FF6F0252176DC7418743B65CD
+A3177DC3331D369AB6029FD0930EC1B6E20F9E1424D1ACCAD6C06581
+D851E64461A5708B94B19E5BECAAF3C185F09D23CB9DEF72AAD0C639
+EB4A68456CD767F767B6671EC2B6A866704E3CD42C9E7ACF056B7697
+5C1757B0CB079B676BEFC3F24B99765F19B2E13735EE71ADD4B1E4EE
+65C0F9299A3D27A83431F20774C0A97F6977D06A841ABC7C7B26613D
+754DC5960302879F9E4FEC0EE905E320E61C00343B6389DB208165E2
+9E2038A70DF4C13630912DA9B9A384EA430CCAD7F0FEE4F8DAC436A2
+156B4234590B7C88262395E410DEB29C4B8D8F8C1693BAA4A2C662D1
 exit
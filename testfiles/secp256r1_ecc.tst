@@ -5282,4 +5282,8 @@ B92875A642C7A979DAC2A2EA4357E5858248B951D69C56DEFAE1A5BCF3640F93
 68BD237F91ECD9342CD6E28E6A5F3A97A68F859BC485D2AAE9B3CB8F32395446
 0
 0
+eccp_multi_scalar_multiply 1
+3
+eccp_multi_scalar_multiply 2
+200
 exit
@@ -1973,4 +1973,814 @@ gfp_mont_parameters_order_n 546
 00000000FFFFFFFF00000000000000004319055258E8617B0C46353D039CDAAF
 66E12D94F3D956202845B2392B6BEC594699799C49BD6FA683244C95BE79EEA2
 60D06633A9D6281C50FE77ECC588C6F648C944087D74D2E4CCD1C8AAEE00BC4F
+gfp_mont_square 547
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_mont_square 548
+00000000FFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001
+00000000FFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001
+gfp_mont_square 549
+FFFFFFFE00000002000000000000000000000001FFFFFFFFFFFFFFFFFFFFFFFE
+00000000FFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001
+gfp_mont_square 550
+F993D12EF3A1549EE6540B7AFB0856CCF0CD91D36A89342B626DF25C4E015620
+01CD954B840AB252C4DFAA2ECF0D815A9379671926D7D4793C21B4E6848D5036
+gfp_mont_square 551
+C7FCBA405CCE73A1247EC3179BF48C5364601D2D9EA5D45AE8A97B7556B237E9
+492A0A9B0994D250027ECE93733FC5F8A07895EFFC29A765533A5745E8AD6E3D
+gfp_mont_square 552
+23DF5B27971ECE57C2693EC2BA8B1AB3E68A85EC875CBCFC8F64DA2FD262577E
+3DAD86271754862FEE78EECF29CE87982E5842390EC512DA7201A767280966C4
+gfp_mont_square 553
+9B6D84606D01BF8B2CCD9539A2A4842980AE28C3A1C17C915C3ED18CAA4B868D
+D0F668CB4A584657F89C26554EAC705C8DBC18AD1571D6E360EEE1951D78AEEE
+gfp_mont_square 554
+25639CB186658115120EA8A1341F2154A401D01F04864C0B75EBA89CC26233C0
+AA4AA8BCCE0405CF9F599D20D2FEBDDCFD932C6F0C1C094DDFEB51D664E7E615
+gfp_mont_square 555
+20A9B3D94ECC4C46D79F97FD4F8594380B50437AE6D7420637D0B490119DFD98
+2431D917406C6C4F1D3C8AF347920EEA62EC5D6693A051E8825824F2810F4EAC
+gfp_mont_square 556
+72F2EEAA14D2889C2A6DF4C57218BDCBD227B13912963CD41208BC7F8E4D27B8
+4E5D4CA1332A30239F2A7B224922E11474EA85505C832D539BE16BEFF7B8E6F4
+gfp_mont_square 557
+55CC1BFFE0C58F6D6418742212F3A6666A8C86BA79262F2FB12E9D1E3B8077A5
+15E3DD78A017716EA4F7412CEFD3FB9691063448FDDB65AA9DA6770D20899203
+gfp_mont_square 558
+86C379A19792BBA8223EA2AB3F6005969BD1C195A17EF54FDDB1BD9124B3BD48
+E03B24F57804A324707479AAC0B36DFF0F0A0407BAE4ACD5B8762C8C75BA748D
+gfp_mont_square 559
+301095B5E5EE783BBC980C6810518FC885F055CF2ED4B56589DE90225E8377B6
+59FD06936D900714DA5D06671B0504D0B40685229863BC6BCA29A8FBEC535A0B
+gfp_mont_square 560
+E31B4E555BBFDC08CD21B57328280D07A439B89760938D6AD171CCFFFC85ECE9
+7EB0F873AC914FF6F72119E76E60BCA605D6C4695E1CD3A4AA048BDE4AF5D0E8
+gfp_mont_square 561
+B0B5CD4742D87EC0A423C9063695B0EDC07AECFB8FDB1E81F6D1CC532837413C
+A18D4EF3EC2473FF6109BB9BC8ACCEA78345FE4537EA81CDA3795D9184628601
+gfp_mont_square 562
+051AC231C1C470F3CA273F2A77A39BA30D5052A6BA69E89165FD49DA052BADCB
+D92EC2D35D1144C24D2A5F563D2BF59D39CCFD64336357D6EA21D290806EFC8D
+gfp_mont_square 563
+CEAB5679C1027CB888E550482F0848860316BFF3F0F1F2AAB4F9407CCD337E6E
+1DBF9E86A283D173AF86F776ACB064DA1691A44F660DC3FD7D16F1F0777560D8
+gfp_mont_square 564
+627567490E75C7B1662B3561349F2132810DC5CEE4D7FCB69AEA3760B3BB1447
+5ABEB9A50C3404321943F68B83441EBFDFE4314B17A080A94150A84250A1C865
+gfp_mont_square 565
+8F5B59CF39F8603EA690CA4265F9C818B0F2D57F5D802295FAE675C4FF465A47
+C5D6E836837B1678E3F30F9C11646EF44323F99ED6B523AAB7DBDF6B52477CD7
+gfp_mont_square 566
+80354E6BA46E5523C350D1402F4CD90521EB45E3C6D9B966E3366F4BF70206F3
+31E6FBBE68232E643BB0783F36278CB0BF7E4D1C9A42432605749E5DDD7C12C5
+gfp_mont_square 567
+DE69A9AF7DB4C723F3D3A7D40662C3B2B3E2CAA3A5921281876E4500EE8931EC
+919E52768BB458AB5A8B0032454A323044D8C7FF7CEAB13C9702BA8071CE25E0
+gfp_mont_square 568
+CB7EE88BCF404249B06853A6F2E06E2B9F364BBA168806AD3CF644DA3EB162D9
+F47E149336B7AEA85654D44EDC55F2201D4CD97660A325797F28715186266A6B
+gfp_mont_square 569
+C866162262B2276323C2C2F8FB9DBC4870C0DB7E59C896CE8F4F3D8E4E8ECA68
+B8688ED28C3F950A810658F094B81B9776DDF2E7EC633DE0F3C854CAEF841DCB
+gfp_mont_square 570
+CD530E3CE0C59C4DC4748FFBC44AC5891369AF4640FE4BD623ED03B0847BB926
+3946781E3FB8FE4C8CF0FB94ABF2345EFF682BD69609A264FAABC23196CB866C
+gfp_mont_square 571
+41A289E6BC6C0817B45A1B5DEE1FC972C8D1A7B3C53FAE01D0BB87C2526C0DFC
+49E6F06FF1AA6639A76A8AE1CD2BA2BEC694D728E005A8CEB9DCCD9A6D9E697D
+gfp_mont_square 572
+003AD3B236504D2B5BFF61A6B1E909B026A6A1C972594F6D8E3000A3352B9A16
+237857E8D124E35FE3C1B66FCB4FE5140B06F180B7ED0AF1B7C154F9FDDB1961
+gfp_mont_square 573
+4ADF436A605EEE4FD9D605D64C11EBCB2319D334F78B2B658216A22AABF25134
+2DC09FCA2543960CD15172819A309D6507EAED27FD92B888F6A0E992A4D2A61E
+gfp_mont_square 574
+D7276B821BE418C38A9564928B22328807ED80A09C9E54E9F6D04C0940DD49E3
+3C9132E27FDCF53D86F36BEBD0823FEC92AE771A343EA4792C2D81C9FE787484
+gfp_mont_square 575
+D524B3141F761EDA8837D6DD441446DF72BC7E6BC39A32BE5D7BA4ED86C22404
+4C53F44AA1698EFC4B8D0A71A0DA0FAFEF67CE170E2FC30D86E22CD6E45E3EA9
+gfp_mont_square 576
+D90CD8FCEB941EC1284059C4D837B18657AB7B196CAAB90D5566122E1AF9262E
+4FAAE0D28D5ABACC995AE2C089B458CBECE77DE1A9FFAD692499CED8BFA48266
+gfp_mont_square 577
+E959AA53D42C339B78A50E6EB6EA35900C74B86FB5B392C1A06E287E9C65941B
+8E4A5CB3C4F7E0A1E12FAD6DA7DBDC484F7B93E73ABBBCA7680CC821CD4C7331
+gfp_mont_square 578
+7EC6B663F49E6FECC8E2BC5ADDD57A6236F124475427D8B829C5AA15B9796927
+AC2D4A566D79280B80A1DDD62A2667647F87E32E2AA6C1CE69555DE8E76964BC
+gfp_mont_square 579
+7F2C0AF94AE076B223E2E7F4571CE590DCCE84A11B5E092C017705BB1D812272
+26E514E93C86068D2C327455EF503DEB1F3DED30CD5450F2DAD851D4A1D69B87
+gfp_mont_square 580
+41CDD0488ED64AF3CAC4423DB0DB3D8B50E69C6F7D6E4FE16889485C89EEA9EA
+94BE32CEF7BF79E8F903170CDC3D34CE23E6C80BFFCD7019609C4B437341FCC9
+gfp_mont_square 581
+8ABBF720551012A0BBC18FC68CC60FEB4BADEB15085143DDBFB77C07BBDF2189
+DF1E2B468B4BD9D8DAF39077BED7EB0708C85E21BF3D807574F8F0199B5FCBDE
+gfp_mont_square 582
+9BD5BD6F08B03A0E3DDD507017FF2573CD36FB1EDC90A6BE8ECA536B7FACA3F1
+031ECA772B39F90728C40D858051563060932F936A525E282F7BDA4174B20AF0
+gfp_mont_square 583
+156532CCD09114F43E8FADD583215821398BE9F44564E10A8F9D2E18A9A49669
+F2FA019218DAA9A1B3943EDCC54107C7C36518B67EF3C8128608FD79444936D1
+gfp_mont_square 584
+11BC4E35B6ABF9FEF75E7DC49777A6FD4A5A2FCF2035458E98B1659D10E6BE29
+17DE309678C466AE8A5ECF30F0D0ED2E15AF8E28F10FC882F4DA769A0212C183
+gfp_mont_square 585
+0F7146BC8BD143A95C7A7E5D2752642214F40DA5678B3594AD75B8419561BC90
+667000797AB4E97A68972FA7B6C6BBA4772E5E91D795C40487A86E40728DB820
+gfp_mont_square 586
+13432E69F3892A6C9827F92E87BAB51EF8EFEE60B382D784FA1500D826D80220
+C411B62FA78030A697CFCEAEEED425E95BFF87AE405E74A64F74EF0E6BDD10ED
+gfp_multiply 587
+0000000000000000000000000000000000000000000000000000000000000000
+3491FEA161939295742A41BB8B1ADD60F5B9E8E715CBCD0B1321CFD7D3DB11B7
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_multiply 588
+0000000000000000000000000000000000000000000000000000000000000001
+58CF43FED672C8B84C04286902B37CF9E7B06B4385E26DF5E10AD788C48016C8
+58CF43FED672C8B84C04286902B37CF9E7B06B4385E26DF5E10AD788C48016C8
+gfp_multiply 589
+0000000000000000000000000000000000000000000000000000000000000002
+14668EEA5CD15DF00A97A27D2385E347C62C42399BAE16E641C7924ADD5E4758
+28CD1DD4B9A2BBE0152F44FA470BC68F8C588473375C2DCC838F2495BABC8EB0
+gfp_multiply 590
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFE
+8F90FFE97D240B1A1CE8180998304A24B207809308C03A191438A21806C1B8D1
+706F001582DBF4E6E317E7F667CFB5DB4DF87F6DF73FC5E6EBC75DE7F93E472E
+gfp_multiply 591
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFD
+708C666886C2B78AEA4CD4BC78B4E31EC8CA5618C608EFB18FF79CA3E449BAC3
+1EE7332DF27A90EB2B6656870E9639C26E6B53CF73EE209CE010C6B8376C8A79
+gfp_multiply 592
+7FFFFFFF800000008000000000000000000000007FFFFFFFFFFFFFFFFFFFFFFF
+D184933D54A506FE9BB81A4FABE63B142972601033A09BF9F37207E3E0F2F8E9
+173DB660D5AD7C813223F2D82A0CE275EB46CFF8662FB2030646FC0E0F86838B
+gfp_multiply 593
+8000000000000000000000000000000000000000000000000000000000000000
+0DABACD08CF4AC1838EAF8CAE0BC9AA3618EC2D9C870B446C50F9B0FCF53CB25
+5A57E383B35E784037B5BFBB1961C1CF0DB950602B3A12B66C9C317FC61C31EA
+gfp_multiply 594
+8000000000000000000000000000000000000000000000000000000000000000
+65520B8F1DAAF70241E0F8F2E05D4BD09C298CC9035B31E4282046A9EC1FEA7F
+AD2984DE28A2E1F7C27296661B5603FD60AE36B6ED5361944320189C9C16B44D
+gfp_multiply 595
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFEFFFFFFFF
+3610E45100D68048CC4A988537F2555B63F40668ED6F642C675A9879BF1A4478
+C9189B6569C64BCCC80DAAA49C0BF99748A1802598A5678640E5BB87C9EF1BAE
+gfp_multiply 596
+0000000000000000000000000000000100000000000000000000000000000000
+78E100A991B77AF576EE7876A29BCC45B0171DE12AD1EB5DDEBD8E9B0F7BD234
+481A6E871147A6A1D42512FC06D5DEC8D837BC980A987B9F08A5F36BA0A94412
+gfp_multiply 597
+42FDEF77DEA5486A6AC9573D3B416610C5B679993543C7A68692C6F33E0D36B7
+6E1B879317C8DBFC633169077E89A8ED0A5E6BEABEA661C3B7A46957CA75A6C1
+4466E248F7F9A541B36C781BDB3EAB0A6C6F32DABDD6E1BA845384F71C7A91C1
+gfp_multiply 598
+1DEA467190BA65D050842AAAED939512E41A3F3D0D20464953341F5B24469138
+78E100A991B77AF576EE7876A29BCC45B0171DE12AD1EB5DDEBD8E9B0F7BD234
+1199B9E0946BAC48D5CEA0356296D874F4542F866627F7EBA3727EBD20002499
+gfp_multiply 599
+DEF32DAEA76ACE09A728E00EE6A4CCECF67720336728858191D8731EFD960AD6
+14668EEA5CD15DF00A97A27D2385E347C62C42399BAE16E641C7924ADD5E4758
+7F2C26D45DBD4C81A212FA3C2D6E2CD91A5AB9163CBEA979D89508136E9FAF9F
+gfp_multiply 600
+6E1B879317C8DBFC633169077E89A8ED0A5E6BEABEA661C3B7A46957CA75A6C1
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFD
+23C8F0D8D06E4808399D2DF102ECAE25EB43282B82B33C7890B72D506B14B27D
+gfp_multiply 601
+2A5B4BEAECB11A5AF1B31705E656CAE2928291E0DFB1C3CDEE0FBDFD35FEF00D
+1DEA467190BA65D050842AAAED939512E41A3F3D0D20464953341F5B24469138
+EDD1F0FB381AA1E9D3A543326A473AD32CDBE29708D8E66E0806E1B70D419976
+gfp_multiply 602
+50A64652A47A7B5EE6941CDFCCAC565778A277A8A82B302F4BD411E6562ABC30
+6511993D0B673BD830F6418EAB191BE1A0BB7FB6F636CF0047B3626CF8993DDE
+B4B8ACB9EFB8CB1474963E888115FC71038F4B7D32D83D0CD574A277D2BD04BE
+gfp_multiply 603
+CD152D1AAF9B1084CD285F3BA79C875D3719D668872C92EA6B8468C8D09872A7
+708C666886C2B78AEA4CD4BC78B4E31EC8CA5618C608EFB18FF79CA3E449BAC3
+EF13537DF985A50B2A57DE1813261A6AE4ACA2EB01CE8B420B27B01C60B15466
+gfp_multiply 604
+DBCDD557130A9ADB7F1371A9F4CEB45F646607A4EC3C9E4556A9F13444AF3F13
+0000000000000000000000000000000000000000000000000000000000000002
+B79BAAAF261535B5FE26E353E99D68BEC8CC0F48D8793C8AAD53E268895E7E27
+gfp_multiply 605
+6511993D0B673BD830F6418EAB191BE1A0BB7FB6F636CF0047B3626CF8993DDE
+0000000000000000000000000000000100000000000000000000000000000000
+DB5BC6821A277190D73A8D57BC3BC077EE13D50B7078D5153C5D7D6676FDC432
+gfp_multiply 606
+DB37535FAACCF55D44FA1F36F7F1E857C44E554020AC8AD89E9A8DA1E622E12B
+CD152D1AAF9B1084CD285F3BA79C875D3719D668872C92EA6B8468C8D09872A7
+BB66B876DF8A74B77720DE619D7166E6B8826D0D4A3A46D475904AB55EF7335C
+gfp_multiply 607
+78E100A991B77AF576EE7876A29BCC45B0171DE12AD1EB5DDEBD8E9B0F7BD234
+0DABACD08CF4AC1838EAF8CAE0BC9AA3618EC2D9C870B446C50F9B0FCF53CB25
+CD70D0AE8C76372E999FAFA484F2C41534151F8825D2EC3C503006860BC2F8A4
+gfp_multiply 608
+3610E45100D68048CC4A988537F2555B63F40668ED6F642C675A9879BF1A4478
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_multiply 609
+65520B8F1DAAF70241E0F8F2E05D4BD09C298CC9035B31E4282046A9EC1FEA7F
+8000000000000000000000000000000000000000000000000000000000000000
+AD2984DE28A2E1F7C27296661B5603FD60AE36B6ED5361944320189C9C16B44D
+gfp_multiply 610
+0DABACD08CF4AC1838EAF8CAE0BC9AA3618EC2D9C870B446C50F9B0FCF53CB25
+2A5B4BEAECB11A5AF1B31705E656CAE2928291E0DFB1C3CDEE0FBDFD35FEF00D
+9D74F0A271E7DF21117BFA49E93554688235EE02DBF142DC51CDDE346983DA48
+gfp_multiply 611
+D184933D54A506FE9BB81A4FABE63B142972601033A09BF9F37207E3E0F2F8E9
+3610E45100D68048CC4A988537F2555B63F40668ED6F642C675A9879BF1A4478
+CF74379AF6ED0564C2974CDC2A83A19F59C5CF3229411361093C71E767B240FB
+gfp_multiply 612
+708C666886C2B78AEA4CD4BC78B4E31EC8CA5618C608EFB18FF79CA3E449BAC3
+58CF43FED672C8B84C04286902B37CF9E7B06B4385E26DF5E10AD788C48016C8
+9B888C0C83EAB5AA56CAD4FFC466AC983E3D983C6EA263A28426A9BB85D07003
+gfp_multiply 613
+8F90FFE97D240B1A1CE8180998304A24B207809308C03A191438A21806C1B8D1
+7FFFFFFF800000008000000000000000000000007FFFFFFFFFFFFFFFFFFFFFFF
+3837800AC16DFA73718BF3FB33E7DAEDA6FC3FB6FB9FE2F375E3AEF3FC9F2397
+gfp_multiply 614
+14668EEA5CD15DF00A97A27D2385E347C62C42399BAE16E641C7924ADD5E4758
+DEF32DAEA76ACE09A728E00EE6A4CCECF67720336728858191D8731EFD960AD6
+7F2C26D45DBD4C81A212FA3C2D6E2CD91A5AB9163CBEA979D89508136E9FAF9F
+gfp_multiply 615
+58CF43FED672C8B84C04286902B37CF9E7B06B4385E26DF5E10AD788C48016C8
+DB37535FAACCF55D44FA1F36F7F1E857C44E554020AC8AD89E9A8DA1E622E12B
+C532DD402015936971710B44994EB1AEF0CBCBF81D94005EE7AC4B332BDF5F93
+gfp_multiply 616
+3491FEA161939295742A41BB8B1ADD60F5B9E8E715CBCD0B1321CFD7D3DB11B7
+8F90FFE97D240B1A1CE8180998304A24B207809308C03A191438A21806C1B8D1
+C04382EDB486D30B2663CE0A04931D7CBBB12CB220E218A98D130A4533948C22
+gfp_multiply 617
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFE
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFE
+0000000000000000000000000000000000000000000000000000000000000001
+gfp_square 618
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_square 619
+0000000000000000000000000000000000000000000000000000000000000001
+0000000000000000000000000000000000000000000000000000000000000001
+gfp_square 620
+0000000000000000000000000000000000000000000000000000000000000002
+0000000000000000000000000000000000000000000000000000000000000004
+gfp_square 621
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFE
+0000000000000000000000000000000000000000000000000000000000000001
+gfp_square 622
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFD
+0000000000000000000000000000000000000000000000000000000000000004
+gfp_square 623
+7FFFFFFF800000008000000000000000000000007FFFFFFFFFFFFFFFFFFFFFFF
+3FFFFFFFC0000000400000000000000000000000400000000000000000000000
+gfp_square 624
+8000000000000000000000000000000000000000000000000000000000000000
+C0000000800000003FFFFFFFFFFFFFFFBFFFFFFFBFFFFFFFC000000000000000
+gfp_square 625
+8000000000000000000000000000000000000000000000000000000000000000
+C0000000800000003FFFFFFFFFFFFFFFBFFFFFFFBFFFFFFFC000000000000000
+gfp_square 626
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFEFFFFFFFF
+0000000000000000000000000000000000000000000000010000000000000000
+gfp_square 627
+0000000000000000000000000000000100000000000000000000000000000000
+00000000FFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001
+gfp_square 628
+42FDEF77DEA5486A6AC9573D3B416610C5B679993543C7A68692C6F33E0D36B7
+83F0B1E96429F6746ADC4ECA02307B7B8DB9411B7864783923DE9FF8E57AD1D6
+gfp_square 629
+1DEA467190BA65D050842AAAED939512E41A3F3D0D20464953341F5B24469138
+67152BF4C9509D03F4AF857821F438FBF093FB6B5CCF9840C7C222A1B18BE27A
+gfp_square 630
+DEF32DAEA76ACE09A728E00EE6A4CCECF67720336728858191D8731EFD960AD6
+9B418F5CA8EBBF6F4F2CBA9045B14D559B4F560AEEF61E912E0A329ECB89B466
+gfp_square 631
+6E1B879317C8DBFC633169077E89A8ED0A5E6BEABEA661C3B7A46957CA75A6C1
+AA955117EAAB44FEFEE8A6B93A1724D20E164DC8ADEC105E6715D82E6F0979B5
+gfp_square 632
+2A5B4BEAECB11A5AF1B31705E656CAE2928291E0DFB1C3CDEE0FBDFD35FEF00D
+1396EAB22767DEB3E50D4EED8D45BC1C9C5DCDE37E4C1BBAB24093D768F39DEA
+gfp_square 633
+50A64652A47A7B5EE6941CDFCCAC565778A277A8A82B302F4BD411E6562ABC30
+C6B678517970D311EDCD8DEB7A6EF5E60BB4EB66AEF0716B9B2A0ED2715D5526
+gfp_square 634
+CD152D1AAF9B1084CD285F3BA79C875D3719D668872C92EA6B8468C8D09872A7
+C456B0A7D70F16776A71FBB2344050E1FBB71250C8D6C6EA9E87CCAA54910B68
+gfp_square 635
+DBCDD557130A9ADB7F1371A9F4CEB45F646607A4EC3C9E4556A9F13444AF3F13
+DC1FF184E0B07BD212898B09A8A058E52501E282B7BFB83A4432CF6419E984AD
+gfp_square 636
+6511993D0B673BD830F6418EAB191BE1A0BB7FB6F636CF0047B3626CF8993DDE
+A3FCA4854C18A0F709624604E8FFD8C8D19E80DB9D9366402DCB8F600B2203BC
+gfp_square 637
+DB37535FAACCF55D44FA1F36F7F1E857C44E554020AC8AD89E9A8DA1E622E12B
+2C85E0D7A0DA7B5EFB0F44C2574A56304CDECA61FEBAE3F327244101324F98AA
+gfp_square 638
+78E100A991B77AF576EE7876A29BCC45B0171DE12AD1EB5DDEBD8E9B0F7BD234
+BFEF4D6499938CD7A4DC413B982E9E589F7CFB529D6213533E7A5EF09BBB1842
+gfp_square 639
+3610E45100D68048CC4A988537F2555B63F40668ED6F642C675A9879BF1A4478
+80D4AF052FA1E57D1EC4C24EECD375F19C8C6F912B93DB7B3C5185CB65ABD20C
+gfp_square 640
+65520B8F1DAAF70241E0F8F2E05D4BD09C298CC9035B31E4282046A9EC1FEA7F
+62DFF42066C7C99391B5AC34CE1772BD8CDD0E02FCF1237BC5061612B4EA1A1D
+gfp_square 641
+0DABACD08CF4AC1838EAF8CAE0BC9AA3618EC2D9C870B446C50F9B0FCF53CB25
+160ACA869A6C68744EAE516B152056CCE5E6CBC873446F604D48F1B8022C6EF2
+gfp_square 642
+D184933D54A506FE9BB81A4FABE63B142972601033A09BF9F37207E3E0F2F8E9
+D750DDECECA97C72CCD29D1CACFEF3C323AD0412255734BD211BA72C6761B142
+gfp_square 643
+708C666886C2B78AEA4CD4BC78B4E31EC8CA5618C608EFB18FF79CA3E449BAC3
+24B9BC08FEB3D0A05F5277DCA223CD2EB985C278E90ADC91312E0F948B6381FE
+gfp_square 644
+8F90FFE97D240B1A1CE8180998304A24B207809308C03A191438A21806C1B8D1
+7BC966539A80103170CF03E21D1AD9C2BFB63831D7C2348FB3A8FCCBA42488E8
+gfp_square 645
+14668EEA5CD15DF00A97A27D2385E347C62C42399BAE16E641C7924ADD5E4758
+FF524DE930B27B59C6AE3962C1312E6CD3113D1DBB28B581A70BEFED72C58FFF
+gfp_square 646
+58CF43FED672C8B84C04286902B37CF9E7B06B4385E26DF5E10AD788C48016C8
+754A9E7A48DD51B4363E3D69F527E1391C868342EABFE060ABF8B27CE46268CC
+gfp_square 647
+3491FEA161939295742A41BB8B1ADD60F5B9E8E715CBCD0B1321CFD7D3DB11B7
+DA26DB66710418CDBED6B1ABECD52112D233EDF535739B0605FFE60176657527
+gfp_inverse 648
+0000000000000000000000000000000000000000000000000000000000000001
+0000000000000000000000000000000000000000000000000000000000000001
+gfp_inverse 649
+0000000000000000000000000000000000000000000000000000000000000002
+7FFFFFFF80000000800000000000000000000000800000000000000000000000
+gfp_inverse 650
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFE
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFE
+gfp_inverse 651
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFD
+7FFFFFFF800000008000000000000000000000007FFFFFFFFFFFFFFFFFFFFFFF
+gfp_inverse 652
+7081B38EC74BA5747AAA791270DDF265EF227294E8A56F253054CE6AF182C83A
+A199CE78E37B21B36170BA8506B12E963CEF4892D49FF2E5EFADEBB35405C34A
+gfp_inverse 653
+D4D8677A104CAFDF944E43E2B66503047A38F8C646C29D098EFFC0827273BF5D
+E010B9B892102C5A1B469415610391F541F596AAC4F8DCED4162195D189E6FD7
+gfp_inverse 654
+08AB95C1F08E4D865C32415F493BED715D0A9C33FA633FC94AB0D0DFCCD9D36C
+5F493A52A984B9B16570BF35053A1026E4F2129B37CBAABA8E9BC3253F4C012D
+gfp_inverse 655
+791D15A8F75A3B0E462C63D447A17DE44699C5D4DBAB0D36809DA3D2156C2AE8
+DA6298B3415810D24421294161AD6232481A23AC37FFFB5D2128C203CF68E9D5
+gfp_inverse 656
+3FE4336615ECBA5AB6BA8799082B755B5F17AA83EC12DFFF71B93E3A6E4223C2
+1E71F20DEE46745BD87D9F2D4095080C1BDF26D3DAA3D98950A906F576BFD489
+gfp_inverse 657
+BD320937085FDCCEBED70CF5891699F73D0B28D5A3797F289ACBB48FD0FDBAE5
+EAE84CAABD15C6C06AC48288A22CDC2AB6ACD29E0EA0039055118CF1B125C567
+gfp_inverse 658
+BD669CDFFE37E0B7F3AF62F80D54304C082EC3295ED8585D561D10732C5CF0B8
+725B6318FD8D67B744D6164F7D140F132D6EFF859ABBA9184E6D428736700318
+gfp_inverse 659
+E29833D957EE2E766EDB4869B3602A3E358CC2FBF325E49DC050BC17C3E3FFAB
+D87D7CD8265A7534FBA2D11C33845E10E2383539D873CD268BBF39C077202234
+gfp_inverse 660
+22BCC0DC8C106B57664FA64A1D316615AD028836BB44E2F8285AB2EE13DD40E7
+6C1FDC7D4C2A85DD8FD33B88665726D8188F3F682061E333BAE9591211A935D4
+gfp_inverse 661
+59B3EDF212EFC48C20C7F981133F18A3A3AFEF687E999119BE369B7576CC0C7A
+148588CCF2F539048F66656335A4250F0A81C8B053B41A0B1676D3B5858B0896
+gfp_inverse 662
+2F076754267A167AB545213A86821FD52F88AC9407CD41ABFA7EC429853034D9
+C81E6B73A351410E366C7AAD7615520AE5F4FFB59430A092BA313C4C72683FF6
+gfp_inverse 663
+CBF3061B63683BB8D99E23539185132281DFC68A26A80C25BD2ED409481DE356
+AD2DDACF3B1B639B6DB6B9DB70B309FEB904D547D7912B848E7005D51D77F21F
+gfp_inverse 664
+2037D43FE91BCBDFB718689990660D07B2109A2B38BA8077F1F0AE60391BEAFD
+6C3E1D4F8FC3EE1E2D81C8D17FDCEA1CB25828E4F969223226CB1561E22E10EB
+gfp_inverse 665
+8F9E9CCE3D868039FE511DD551061050C1DDD37329C66B64B0DBF3EE6B4C2CDD
+4093679A5C7BF03205A6E7135E589C0E0FC241E0DB270AABBB29845A20CA2AC1
+gfp_inverse 666
+C29EF810302A59D862FDD18891A46FE9CE1A0C0AC952B37F01383E3F9286660D
+464C9BF12C69F84A8EFF5FD124B54528BEA0BE96AE4C0057616899A9F5C4B347
+gfp_inverse 667
+D849693265C34B6D027A05C970E1ABC086BB77AE618E86CCDADD63B2534471E5
+CF47FC96D38B24F6D61FEDCAD404DF694114D60F5A9A5333CAFE81087D2D1510
+gfp_inverse 668
+3BD3503FB7642ECB22E20F19A97DC15BD99BCF748D12312687E1E380FF5D8171
+A8BE006A16CCFF21DD0BF35F3671056394EA2FBA3FFFFBDAD1A8F9A391EA7D49
+gfp_inverse 669
+2F65F56EAAA3A20C459B35DD5F4A1342BE2D4FB1CE2560B08B3EB7B6A5281E39
+DE448514F75EE0A47F9B9101E0EAA1B17394D391BA3DD0A085C2BCD38FB13A24
+gfp_inverse 670
+1303B035627B9E1C22639415A01E70B7B0B3F6CB2A04548A263FBB4DF8FB2F27
+5838D6F3EB2FE42696A4545E645A16510285C41198AD407B8A102E522AC52551
+gfp_inverse 671
+A69F435D1D55EB770F2981D7C24B91E478E275CC0A3503C6032305E60FA21A5B
+C857C3CC370CF8F800F6F7F009161BBE43A537A1E461542FD80D6E1B794C7F5E
+gfp_inverse 672
+0F541B26083D01F9987A878A5E1C0AD1AC799E0D19A32FA88A4F8970B6070941
+EED420DEE7BB2C03F37270DAC96B8C660E2E8E12E6E534EA170BC3AC72CDA9FD
+gfp_inverse 673
+B00BFB4290B7EE92C37E2D9239BF7F906826F236C9520579398BBB8B8AF20D13
+B7C81632DA9D5E681D0304AD0B630BE27F62EE36E621A00767462876338485D5
+gfp_inverse 674
+92CAB021B961C8F313C9E2D47896A8CA17BC09D44B22B1F1F37A40D7EC1A775F
+CE236E16685DB0CC9133C0144705194CFA586EFB23AADAE498127B0E0E74C5F9
+gfp_inverse 675
+F5435E1C1EBC2593701C89C2A94ECA35E4CC72952B2A28A10F0E117DDD3DB729
+F53FC249273504F547D7F7D42A87BD769808591FBC00BCFDA82D8B7B30AA8428
+gfp_inverse 676
+07C77FDAEB78112EAF17F7E20CCDA3922D846F17FBB63065B3B333011CBAB020
+B0DC996BFED58943760E15A0660B7AC90CFFB58CFFF324E75F657D300846D310
+gfp_inverse 677
+B5549DA1A6A59EE16CE2671FBABC95EDFE40FE67AD0A32C3D73C5ABFC0076C10
+3963D30A419EF70A22881977DA53DFCBF3D0FCC751372D66D6EE7A4107F28449
+gfp_sqrt 678
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 679
+0000000000000000000000000000000000000000000000000000000000000001
+1
+0000000000000000000000000000000000000000000000000000000000000001
+gfp_sqrt 680
+0000000000000000000000000000000000000000000000000000000000000004
+1
+0000000000000000000000000000000000000000000000000000000000000002
+gfp_sqrt 681
+3F9D52F90E8BEC948F6F915FE21B37CA1B29FC99C6C80E2BC8C614B27B8444D3
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 682
+591628587017D55E4D58D8FFABBB1E399EAD7E99C4E9E1C8733A783DE3CAB234
+1
+8FCD7F4073C1CD2C81F98B521905D591C5B2E75A0ACD8BE146E4099030F97059
+gfp_sqrt 683
+B95687880A2DA565B818B4605E4C3F15D9D4FE2CD8AA090417E50E823B874543
+1
+9CCEA098535B6A437178BA0A1038F0B5E998D0EEE4DDF9B9C28EE907072235C3
+gfp_sqrt 684
+B2FFF17B3F665EDEF10637CE81FC069E7A609683CEAF4915888564E882168591
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 685
+750394960B802321D37BCC1DE5D0C40B889C0277D302C2FFC389E65FE47A6368
+1
+8F3C4BE3EC3B96054274A3EBED84E91EF132BF2DE040015CE064A11485F1115C
+gfp_sqrt 686
+0AF269E9BA3F7A13019586398029C8802D6FE3C5680C99BA7B1E28E2E11167F6
+1
+1F229DD06AA8B9E0231B3E14729135BDD70A39D133DCD77FF179F2D2E48B9663
+gfp_sqrt 687
+12B80AED6DA79A873D9A8079ABD0D7FB1292618550E40D54712EA6B36471FDE6
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 688
+03E1D9F436D49AC5E5EF577A915097D5C838B0F5FDC72866CB864E58F7067CE3
+1
+2789D059C6E50DF2E5A3863E1F525265C8B007EE4D82FEACAB6286CD3672D6AF
+gfp_sqrt 689
+9DF9F5002FC67B1A3AAB36B9ABFBDCA2D27F1EFDD82B1D96BE46EA328FE1EE68
+1
+E201552240CBACD0249A45845DBE3023A906922FA4B9A9C4B753A1EEF0836086
+gfp_sqrt 690
+65F4298618189AF4F3D74F82BF268EA03836E86577BD891FF7B103DF23231E20
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 691
+815A090B9E4AE85C4E8A46E68F10D897466FAC347B7ECFD2BB95C7547D6EDACC
+1
+2955D6F03945336BD51B1815AAF719F3FD68373B29ACF1A57CBD1F5AE28AF605
+gfp_sqrt 692
+791B2C6D8A4B7606785DFCBE020C257539DE0685E8535E59F3CF6AD7AFA64B3C
+1
+321C52966BD8C67656D050CD6760136783FEB17BFE7B8AE46E7836A4B4D19EC2
+gfp_sqrt 693
+8DD63CB95685D62404FCD5555DAF106DB8DEE081179A071E518AE4525B4B1B77
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 694
+5918A161953C96E1D8E775E0D9F55DC4180657A7E350BD13A6CCF8EF799E3E3E
+1
+9FB9AF5084768B8C54DD0BA5626467BA04A10547B401BA8570C1DCA1756B728A
+gfp_sqrt 695
+BA9B3AC37B9B2FA0F67E4AD9C9CBB76C89240BFB49510608CB1B202D32C43A09
+1
+C9D22950EB25F8A1FC2E6A591CE3BC0C10755C97F5F554ED83239EF54BA2E162
+gfp_sqrt 696
+6C18D982D1DCEC53212A8D9BC17A9262453BF4912E7A26E9C76C603FE7E8F9F8
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 697
+D332A39A68C87914B8910F5AEEBF9643A7878AFE7B8B60DDFFF16F61546EC415
+1
+263CFA5E67EC326A42343354F22D2882D1A89B37AD0C9BB6E9526A69D97E967C
+gfp_sqrt 698
+306B456C165AC8E3E63B39F0B06A947CF5EE75959B0865BDB7742020067116BD
+1
+16E6FEC353B97377B34E8ECE7E9EE51D9212824C83C8CB28EB4ED2E3895E8B6C
+gfp_sqrt 699
+1289BAFAE53169606CE193C22EEFA279B02E3D8DCCB1C51D0EBA0EA84770A089
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 700
+E6659847C72500230700AA89587D41F84E61F1474429E034DC9EF9CBA194FAF0
+1
+1570266B42B38755CD37880E16AC4191A26AA0AE044F1574F037AFC644D82A54
+gfp_sqrt 701
+C3E2E7D67E4F75CC23408814F3300613C91E186D18DD96B4F859457A0E042EE4
+1
+742A80631F2642AADCDED20443B30F66110E2CB638EFBAEBDB31CCD29BB183E2
+gfp_sqrt 702
+449274D2EA59679AED3A32A86AF257488D959C31FE8AD4A156D2A68C02F4B344
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 703
+3508BF97CD3D369916594834D33FB38F0F0749A50B46B99C4EB9FB1F86445F12
+1
+1C0502C6F02905313D0A270BB5A432CF86E3E7260B0F873B2114E0689F27F52D
+gfp_sqrt 704
+E2CB27248B7719D05263D53D20BF8855D8E2BD12367BEB3206DEBCF7A69A618F
+1
+4FDEBBECEEA7BB6433A715682E5F950C0CE5AF69430B91ED2954BA5CF81E54DE
+gfp_sqrt 705
+8005CE74721888FF4A3ADF9934B3FF60C26E7A4287F53DDD4E14D571A0F096DC
+0
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 706
+2779A2419E45FA737C3CCEFDBD3031B118051ADAE1A51A7AA285D22BB26BB5F4
+1
+401D68FBFE977C5604A65651CDBDE74758D50F1B4540F4262D8AD8C0AC127E94
+gfp_sqrt 707
+8E76E180D773F191DEB57DBE69FFFEE8971CD1BE2C684E181784244E318FE199
+1
+30803889FA6197748D118E3781728A07BBAB27F604B8157D03EDB92009758341
+gfp_exponent 708
+0000000000000000000000000000000000000000000000000000000000000003
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000001
+gfp_exponent 709
+F8B8A8B6A2A100797FFC69C346E16361D67C8EBED6C65F3F20BD6018D540DCD3
+0000000000000000000000000000000000000000000000000000000000000001
+F8B8A8B6A2A100797FFC69C346E16361D67C8EBED6C65F3F20BD6018D540DCD3
+gfp_exponent 710
+37ADAF4ECE91762C4A0515FC83090103EFD4F62CC9F065D6889E079781AF1B24
+0000000000000000000000000000000000000000000000000000000000000002
+B354CAB5CAC8C0FC726F2FC9E21746164F2153D9F7F12CF3B7440507F4883361
+gfp_exponent 711
+A5BE717B7D1F496BD32AD73E2281627FC4480DB964021BD786C91C53918A7D55
+0000000000000000000000000000000000000000000000000000000000000003
+3B1EC2DD87E94AE31CC567A70E02A7D2CCEBF936138370C7BC9574876352F9D7
+gfp_exponent 712
+5F19B149DE7308E408F2839C0834D8A364E215FC4A8C03EA1FCFDE2A79D118AF
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFE
+0000000000000000000000000000000000000000000000000000000000000001
+gfp_exponent 713
+9F160518071396C1B2EDDC7C6005928C58D7EB6C4BCC66C9F1DB114C81B0D327
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFD
+6EBA2F9B8DE10528F4A1B16D7BD8B40C56D940758A7AB16D4E0DCE02BC698ECD
+gfp_exponent 714
+2F457D9ED3E62AC71467FA4203B488A9B03AEBF0D48C1A0724AA7E25FE1B6744
+8000000000000000000000000000000000000000000000000000000000000000
+5647F263A1A2A2FD81B3BEDB7D012B0269047C29EF81EF93E66F2EADA678C0F8
+gfp_exponent 715
+0000000000000000000000000000000000000000000000000000000000000003
+0000000000000000000000000000000000000000000000000000000000000029
+000000000000000000000000000000000000000000000001FA2A1CF67B5FB863
+gfp_exponent 716
+9068E1A16CEF53CCD7770067F6E71644C48F4728209D8492F2A7567294756F8E
+000000000000000000000000000000000000000000000000000000000001C980
+116AA2893BDBEB429F5DD43D2604F8476437616AB32F872D3FC04ECABDA3485D
+gfp_exponent 717
+809B30BCFFC38AD15F6A681B1BA8880DE08DC467F7129D609425F2F6A15A3ABB
+0000000000000000000000000000000000000000000000000000000026153928
+05347EC47AAE0C16A36E118A19659F0FA40261051440670FC8CA967DDA7A35BC
+gfp_exponent 718
+FBED79B8FC6087905E646B01A7EACD4AB739964299EB29F3FCE664780A236824
+0000000000000000000000000000000000000008198AED7910AC4993C83E75D2
+0F40544804303B8F5F7C5C1C5AD035059C8AF5161F7EA46C8ECA86C33EC95F1C
+gfp_exponent 719
+D7E40EC07A06674C1A24F767A6738A5051DE0481F25EB68B1B3506895BAECF97
+0000000000000000000000000000000000000000000000000000000000000016
+BA759327BB48121320809A6DA1DDEAE0AB1CB26A997DEE47EE091C55981D65B9
+gfp_exponent 720
+EEC467CA58A59D84938E21585D7CB8DC7A11127F3C5B1A90A56BE8592B74517B
+000000000000000000000000000000000000000000000000000000000001D99E
+9B311F32C0F2397693FFC1557B638DD321F0A46CEE6AD43316572F9608FDA86C
+gfp_exponent 721
+AB948EA8A0F18994BE202DD25FFA69836DF580A5CEDF34A4C0DD3C825F2AA14D
+0000000000000000000000000000000000000000000000000000000000000057
+5EE81B5EF1735A9198063C51E42F479943F463106985460C9A419F4A7DC6A644
+gfp_exponent 722
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000F20D98C31BE8130D32ECEF2B
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_exponent 723
+502920F2A6949BCDE3FD179DA9BAA011B5BD66E5EDC5F4E72404B048BC088933
+0000000000000000000000000000000000000000000000000000000000000009
+0FA1D856218DA8A509E50BD678A1120CC6B6D32598FE79CFB6715D996286750B
+gfp_exponent 724
+5DCDFBEC7BCCD6425C496C07828A67313B8CBA2AF595AB53084EBA300F9A1702
+4B9F8B5953A6A96BA3BCC8A58F39F2B12BB5570CD33849402D7CB871BC75B362
+4E398BDE125BDCD96BE8D6A957EF6F5D76DD3CCDBB1096768A7E72FC481018FE
+gfp_exponent 725
+C931F9584436BE51A5A40A2A23B5D1634D3E57062C520EEC8FBE465279DB01D6
+00000000000000000000000000000000000000000000000000000000000000BD
+8846B8C4745A99BB06FB76C4A540B78F463F21C1B9AE3989EE686FFE719866CE
+gfp_exponent 726
+42C3BC7FAF3A0F439584B16349AE3964BDCEA49C70DDADD9C88121F305D2188D
+0000000000000000000000000000000000000000000000001C67B6867A98839F
+ED0955DED896EBC765C3B83DBAF0E9DE2E407037D77369C474A04C5F0181C71F
+gfp_exponent 727
+727724F87F492BF2DC2E5A12673086C74A2201F64BE4B2FAD7683799744CE94C
+000000000000000000000000000000000000000000000000EFA118DCB7E043C5
+32188F1009052B1FAEB9D983BDA55FA07F5C6F585AFE21ED3A0F1CCB205DE497
+gfp_exponent 728
+574D685A705460EBA7636BB9E5E8F5767FCE61DD16CEE410A1137A22A8130E39
+0000000000000000000000000000000000000000000000000000000000000003
+974B09F0E2630C0682769C423DA7E9AEB70611EE9BB7286AF75FFCE0DF8BB620
+gfp_exponent 729
+0000000000000000000000000000000000000000000000000000000000000001
+000000000000000000000000000000000000000353ABCB9239B36ED121F59EBD
+0000000000000000000000000000000000000000000000000000000000000001
+gfp_exponent 730
+AABCB7DE99B7D917B7BA06025C82C1B91BB03ADBBC8F390CF880152294115ED6
+000000000000000000000000000000000000000000000000000000002C848566
+92662D7D484778EFB9432A6480EF8721AFBD6E327868C961D71FF89C6E0C6CF7
+gfp_exponent 731
+85F63D948BEFD99B3404CD4E623539DA92ABF1ED7853E9165C9A8B1974D8DB2D
+00000000000000000000000000000000000000000000000000000000000000C4
+0A4008633D3DBB6C4269E32FFDF8CD9C7B40317A782DB1A7675F8C1ED46B9C7F
+gfp_exponent 732
+08D4F752D2BF78E3811514CC25670FF9C83152362C7A009B970FF556B5974620
+000000000000000000000000000000000000000000000000000000010F93AA3D
+334E0DA1D78E169CBDCF04F06EA203045838DD0370BFB4F45F53CC3DFFC5BA57
+gfp_exponent 733
+25B8189B37B8449E4FB78B6EC2538AFCAA4E28BBCB07C3338C56BACF16A765C0
+0000000000000000000000000000000000000000000000000000000195E74F17
+25F39E6D861C8D3250A89B6C35CBB673C45F3617DC0C9DD69A944A8B89F763EC
+gfp_exponent 734
+F4C1DF9E328277B7CC95FC43E1B43DA8F29E8A6940E01DBE6699ABECA2D2E573
+0000000000000000000000000000000000000000000000006A32829F498F3C2B
+87B136D33A243E7114C1BAAE5E318C4A5B60125AD98C2F42BF3CFF17A55F4069
+gfp_exponent 735
+51003963363A90ACD43AAB30B7F1104B716F302D095E20D10392ACA51D9CA9C0
+5F3E3146EC35AE21BCBF2DD1E5849A73AFC1BF85940E66536FC36A6DEFBF3BAA
+4122279FD45B33141FF2D7BDD730CFD200086B6C749AFF412B149BBC9FC5810C
+gfp_exponent 736
+0000000000000000000000000000000000000000000000000000000000000002
+0000000000000000000000000000000000000007B5C42ACAFBBDCF6B90615F28
+3794AB9795D546F8C435015BF3A4824FDC4D1AC2B870A8E7F19FB58318D042FE
+gfp_exponent 737
+936DFB7320CE4F5FBCD3A2610440E28EBC6FA6CD0167B64EFA1A99460724A3AF
+441FDADA4F0EA8A02FFDCD21872A5594C798B693D8108EAEBC0876465DD6058D
+5276707A67A46C3831F492BDEF84587CBA72D25BBBDDCC2971F7DCA4D1C98D3D
+gfp_batch_inverse 738
+1
+61165D6AD4C5649926EF112D80745B46EC1DC3FCE292C535CA344008C1C19835
+8500C4D6B1BE5C3C5500A4E72D4497AACF70DEC1307D562DC2368C93B15502A9
+gfp_batch_inverse 739
+2
+7B5832126A8610F04919645C23E1664265955665FFC7C896F5DCCEC80876E06E
+0000000000000000000000000000000000000000000000000000000000000000
+E8F3E7D69E297422574DA8BDD0CACD9375C7296AACA5B2718932749823F5EEBC
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 740
+8
+D9892DE5F3181301C5A4492D9CD784F55FB2247B40F3339A42D0EE0685397079
+A58F806D0F03FBD1BD034A4A329AF3DFFF8CAF2D039188128972003B58CBB596
+DC551DC534CA80FA1A6F757DD9FFD32AEE7F6E094FBD84C976A4D6CD875333C8
+4B9D04C94F786DA341357D0D1F945AD1B87FEBB576F3C1D532B18B7F03DCD2E0
+4598437CEFAB939D6A2662AEA2DEAC95AB3258842D9D67F402F660FB39BA613E
+2914BED0EA40E3988F3F33D252B86AEE59251B49A37925B3F1707CFB5EBFAC35
+16CD0DA835BB651FF8F31110BDE7E66322132164077EB7DDAE2B919B8D89E548
+704D37A8B5B86EEEE20A9DFAD71B277D42239BC604F53B2335ED1A430C014632
+4AD3087A4470410EFBAD069B5E26D99C2A05B98C462AD57F2FFD57C3BCE7036C
+AC774B389FB80CFC0742218A4B7143D496C5990111CDFCDCC88AE48EA2B1EB1B
+3BD8005180F24B2B81B4AB746803DFFBB5CA89C6D398A19EE628FFA99B27855C
+65406B1716D8642C8CC220CC17BC621CBDAF3A07554F3EB88699E5F390A03E65
+757DB13DCBD238D24C25044A19E4799BED5413E2F06004ABD0943E19D60ABF55
+1DBBF732B544972220B7E822BDFBB2FD47E769F3E644A3D1F179C0EA3B160061
+5F9A2895DC53C9E695006656BA3FBAE537706D4A74A26E971F9C2C34C473E105
+8D0E59424802D6A84C6DE7E8389C27ECCB4CDFBD3EDE3364DC3CB9093750C28F
+gfp_batch_inverse 741
+8
+180A7DF51352F77FE803F802B4962132C5C2B7F88EBFE71B5A5E694E5BA9F94D
+3E064EC70F22C3822D26D68DF13D515E6D1E1224B571F5BC688020BEB4B09DD4
+B3DFFA045D3528166BFCDAAAD89BFB4C92B2714C821B278E27C4B12F928A3AFB
+8402555B83F1350EB91CE8CC59498350A3E47B35E5A3FDA33138A10FA9952AB6
+46DA070B50205EEA8BAF2869F95A806029440F5F08BC109568A2CF31E4C06C83
+6C7FBEFB885C20E8FA76D117CC35B1E16FA9719749A38DFC4A61888175134ECF
+BA544C90D222DD645BE19D7EE16202720E94F58D1A959B6BC2A941D5BF6B54F3
+5FDA43CB73B9E1DC5D6A996C4276705969AE1732390848F7A89AFC67AE293863
+12C3048D94F48E7DAC33BDE83013F1F3A3A5E6090C3065601D3DE4214DED7B6B
+6A5326012DB1410A3F06FE4A93887C4343E6A03DAE76355FEE8B4C6E735993BF
+FB2F33AA8F86747E6A0AB35221FBF9BD68EE16953DF1466704588FCED5AA25E1
+143C2CB9C85C34867E5981A1F17C546D7E4C50E3808D033AB862B520EDC75266
+73E2BD55AA42C43FD4E0DDCBC58570626ED8F0AA3028E39F533781A876BD93CB
+5F7623428EA459485F4CFE9FB33F9F0D3906A40BAFE7EDA3A32A0693BC64079E
+CE3BE6BDE7DCCB4F210579213BFBB9B9B3E80938CDE2A54369A82E15F668D7C1
+D5F0824FB39F4097177C2D62DC05680370B3E6C90920AD92857DE500601889A1
+gfp_batch_inverse 742
+5
+0000000000000000000000000000000000000000000000000000000000000000
+52913D8DA4FEC7EFB77A6F80CC7B9E211E415022A5E72327105B1E062ED3E13E
+42400D3A63DE7929142C74016F7BD24E4F1BCDBC04E564847E97A4E36C517EDA
+78920D85FAEC9F2FFAF79575F4F4F5AE95A2007FF93C3A1031F5331BF1EB65B1
+84CCD1120206911BB5D5C4F04AC58BAD3DF9CBC1079871739BA4EC0E2B3D4E56
+0000000000000000000000000000000000000000000000000000000000000000
+9F06C496E676C9754BE583F7A1879553EFC25784B8FBD5AE8FAB6111FEFCDCCB
+2355160865CE879D2B7193B534E36A57D016FB7A3BD17D3BF4D1BC157038AB8E
+7828866FBA41507EB6379774719505B4D15146AFFFD99B1EDF56F02F5F7D7982
+53B49D4E9E2B8E49DF31F197D6A8C6706E636E50D0EDAE58125F45D90CF76725
+gfp_batch_inverse 743
+3
+617171B11A2135CD9C5946C870C981D8336F85AE017D089D93C2296997C1295D
+E1E27699F8DE4E472FAF49D2E3208C31F8246515B0DCA5B14629D2E981964995
+BEB57622DC28B34024DD9E364EDA7B83A9B81A2886407D4386DE41B712EC886D
+03F986D6F0C057807FBCFD9BFEC6E2676C3A02B022BF8295E6061BFCC304E7D5
+9A08C0B3B7D0FAF22D0E1DE49EE34F9BB1FFC026FFDBD1AB4325191D66F928F5
+89487EBD696DF3F59CED4078BE582A23E59AF2D180B6557318A31F623997B1E5
+gfp_batch_inverse 744
+8
+A73E32F548C1C1AD790841454E1DAACF32B6A91C2E85F541E3BAB4A76BCDAB1E
+506299ECF4A975DDA4F18C42817CE8ABC0831265CEB56C4C7985EA57BACA1BAE
+9721B9DC0EF6321576A1838BDC5755C8C5E906F8819E32ECAE5AC890FABE33C6
+685E2B6914DF7C5716BC76F6D217A9B17A143FF3B5938BB8A27743E08814215A
+0000000000000000000000000000000000000000000000000000000000000000
+A58ECF86FE03E02F2657E14D9C13E1ED886DBD28F3D07CB99675474A29A2E77D
+93DF13CC1DD181EEF08A1FC87F3B5F8C8923962569B8A8CBB2857BEF7D1E5F5B
+146DAE20955E8697B3BA3F1E701E1E3248ED7D70B4107FFA03268D8D8267F6BD
+E22B8A59A4246BE3EE3BDF91E0E9EFD72E5A7BD6DD12F5EC5B1A01CF0A08B361
+468820023430FB681D6C92D4439266BE5D5C690ACAF98E3A24A6F93739B16D85
+B5BD8D122AD24CD9D08F8DA0B61BFE083F305DF5FFD47E2E78C1423E2B47F41A
+0CA526F63A04C03D1F3B3A52428FFB425B29B137D801B6DD805FC2DB308E1BFB
+0000000000000000000000000000000000000000000000000000000000000000
+6822A41396C898483952B9912E26BB968DAECDEDA58A9F6FE63C23CC84D8D6B0
+4AF84498A4C4DCC4016A3937CFBAAFF992792485BDDDD247E770A062B7C5D5F5
+6B2544254F1A2143C341ACD12B1394C2C4923C0F30415D832322ABC819C527F2
+gfp_batch_inverse 745
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 746
+4
+FFBA81E7C4A8A1F6F3FC5B2584B09FA9E250106C7129D082BCAA253382D01F45
+51302DCEFAF4718DB224F213297319F92CFD5444C5D328BE52F6F0CC5F5C7F8F
+0000000000000000000000000000000000000000000000000000000000000000
+90070A4AF5ECB1C2180AA6F9E8C4BC7D489516E7B2F3F633EE2D67F9535A57C3
+ECEC239741089EA910939A4DC7D0AF908A028C2A820CB97BAE832BB1940565A7
+2B40BDE4A9C6C0A51B7E1B831098839D974517CB3C0BD45EDBD82CE132AEDCA6
+0000000000000000000000000000000000000000000000000000000000000000
+98C167FB0434B9634AD696909ACB643B3434DAEA6B44828949570E4E57EE1930
+gfp_batch_inverse 747
+7
+11CB8F7C7942B327CEFDDD8264BEFFE99BD0F9590F5837BBCB740FF34CE4FA36
+73B9ED05605DD9ABD0857DD14B51AA567399C4B73B90028369BA4A0B4E39A8F2
+E203A191AFAC2B00D4E00DA22A113CB6358D99F7FCB5B4970AC21BDD82B4F929
+DDBF75E8A9E29BFAC5ED054117F25335146C950811A09EC592E3EA331E6DE862
+0DB04BA1C701E3E54A6BBB32E3A817FC7B5B0E3102461B8549834370F296D64C
+E8CD4A1244260A7C16499F20D59612EE28B283182BBF5E9BBBDED13D72667B57
+4032C12928A689E3D0A7072CDB491EFAC27D63261EDFB5FD18AABC6DFC4BD1C1
+329348D41A36FD163C4463D04C7AA6BDADD6C503464778FC8E821E55075FBD9F
+C5E47E038F04E4A74DA9C4A2B7A8680FA24678CE56A6ECC15A01C5762568EB5E
+3DE4318D71217556ECC8343B95502B7027DC74CEE2B58C5B78083A0C96D409EE
+A989074688889532F8044793A51F52AC3AC9C780D25585D4F0835B84D19D0711
+B9308CCB0EB4C4C79557A52E691AE69B69D6274E896AA3D7A2E56A7A8EF37F20
+DAE26CC19F523CE2342ACDB61842AECAB34F43D4B91010D705EFF3B93A9DB7BF
+7C094D06ABF28DC180935C73DAB1F8F9667A8FA965D07F50012B351A576D3310
+gfp_batch_inverse 748
+8
+0000000000000000000000000000000000000000000000000000000000000000
+6873DBB231A5DC2989925A46903630957E36EF9B3229CBC3BE7580D7AC8B5E91
+B24221FC67426CBD3ED28B1C776A719244F5CC6DAA2A0203B6E28954F757F7B4
+2F159340BDED4F81BA296C1926C5BC85FD04639E444A996A4142D07116929F51
+7FFD1524748E9462224EF96B61B180E0991E15F29B13ED7005769CDBC0706E82
+8BC898C164F8C6596359175E9DA06A65CEF973CB1B0A2F9199A4BF741F59DD24
+CF0649D7CEB5C3495601B4F93882DF4B227A10B9550DC47DD0844EC8E78DE6DF
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+A9237FD075EE3E2427FCE5E0FBAA1F4F3585711F4A6C2051E238B6DAFB0900BB
+540FB16E23D64DF9AF0C4018D6124D9E5A1B5E768181FD5EC28659B8D97E6B5C
+F39B2D1DB08B8FAC55799A94DB2FD0E9B86D7277BF1B7F0CC32E066163660A7B
+17EF843E18C602011E92F6399E2CC0BA04F9F3A1C3AD0D29DE3B359AD42DADE4
+6AAE6F6790751299D86022547C9A01DC70228252BC375C51D64241DE31E2E476
+0B981014EED3DA28C57F73BFB30688FF770496F8350DCB7DE30ECF933CEB1661
+0000000000000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 749
+6
+38749541A549294A5E1A5145F247E2FC76CCDEBD906D31AF5CFA1B7C002444D5
+A0499F6401AE321EF008832CA73C70CBE4E23B938B47094472A4D51FAD91E459
+1014AF765E3DB76128516D35570E12AC951D03A0AF5542EE41B08D9E73F4C52F
+D1DF035567A53442292378199CA27D62445B763D34E1586BCB83DE004B1519BB
+E4733AFACE17D73C26D568FE90D5666D3C8C6FBD06C149391F560F6DD7636705
+E829A5F9A07A492E126AEAA69C0029062E555334B1271536AE7E06630471BCBC
+784473238321133BE8461752BF04EF85FC7D8E11DEFC3C337D689C4427AF59E1
+ADF4707622AEA86D401B14CA0C383B095F5B40EEAD3B2C9A73A266B369E85ACD
+CD6912F809445B37EE4C4BBBFF915A60B4703CA8B038DB93F3C6B102CD9CFC0A
+105E83D162995A764E067869D7B1385A844FA26B747DC230DDE0C9A90183FE91
+AEA021684468F3C013E66FEA361C55127D4514B17D5AC3FC9F247BD909651EA8
+966CA0111B510D612C358754B3C9AA08DED80E53E4F87062B7DB328A7DEF7A1B
 exit
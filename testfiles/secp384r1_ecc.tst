@@ -5282,4 +5282,8 @@ BBCD431339F30E879AC2E7F72CAF5B59AE5129D36538B7C3DC327FE02CE3699B4D01BE916FE122E9
 50E7350FB00FB63C682F9DA99371AD7452F725194CBBCABEFAE64ACBD38BC8C68FAF4EDB759672BBDEE749B5D23812DF
 0
 0
+eccp_multi_scalar_multiply 1
+3
+eccp_multi_scalar_multiply 2
+200
 exit
@@ -1973,4 +1973,814 @@ gfp_mont_parameters_order_n 546
 000000000000000000000000000000000000000000000000389CB27E0BC8D220A7E5F24DB74F58851313E695333AD68D
 0C84EE012B39BF213FB05B7A28266895D40D49174AAB1CC5BC3E483AFCB82947FF3D81E5DF1AA4192D319B2419B409A9
 355CA87DE39DBB1FA150206CE4F194AC78D4BA5866D61787EE6C8E3DF45624CE54A885995D20BB2B6ED46089E88FDC45
+gfp_mont_square 547
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_mont_square 548
+000000000000000000000000000000000000000000000000000000000000000100000000FFFFFFFFFFFFFFFF00000001
+000000000000000000000000000000000000000000000000000000000000000100000000FFFFFFFFFFFFFFFF00000001
+gfp_mont_square 549
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFDFFFFFFFE0000000000000001FFFFFFFE
+000000000000000000000000000000000000000000000000000000000000000100000000FFFFFFFFFFFFFFFF00000001
+gfp_mont_square 550
+746A1DB51000D398C886D121946E7C53C606D67454987B072E89E00BF20E8899B3465B16511BCAA3F2CC1D1ED114F09D
+1F47091381D27DA6D111B4C8980DA08638796BCBF94ECC0FEC2EB78316C24073F6EABB104716DF4B71DB6A2BC2FD0C85
+gfp_mont_square 551
+ED51C6D1F48B866F38018AB1FD4BC060A21F63E148FFBC5CB7A4B68794BC8BE020877C246248231DC30AF6F9F65B5D8C
+F68378AE26042889EBE232C5CA18B370CAEB961A56B5841F416EE7338CB35FFB5E0DFD1470C5D70FC87071B1F1F18FAA
+gfp_mont_square 552
+735574D99F498B4D7F2EB86330F924502B96D901D661F6192D05741815D5446B91A26AB46ED67B75A1CB238115627546
+E49C473F3728473A57D4545B956DCC7061403DD03479873DA2C2105DBD00CF9D181D6F038CF7B77C83FBB2D5D4DA10C7
+gfp_mont_square 553
+A2114BB2DCFA03D95AACEAA1AFF8C6699167E65CA9206B8C3F1B554B10C7F105A1AF175FD8E21CC1AC92FA71B77B3DE7
+D44D073254F4822EF2DF7AE5B9BB5549D71D6B0551692EE095C4DB7568D455E6AA9E11663695A45D116EA909AD31C6B3
+gfp_mont_square 554
+825DB1F65A9C5F53AD97A795864C63EE54C68E88D5601EE91DAB585C8F8AC8022C0001DD2816E9EC3BBADAF5FD9C41DD
+650F27F3E657BB2148C557A8845B6134C360CD16995C05E700FD28A392FB011490E1A9A9565DB5E7AD06CC0366B63FE7
+gfp_mont_square 555
+A79AFBE1E0F50F655871C6FC411578E127AE5706B1CE809EC36CA6A512C939481B406DF69C2551588ABACBE83ECFDECC
+89B4D2F611382E81F47D6BE19CC4DEA5F02EAD84D7F8AE76EA678F9C8E60F3F5BC117F4A06B34B7CCDB5A85FCF835739
+gfp_mont_square 556
+C6D6D4B8184288298E8C094F66F8500B81B824D6C336573EC0479EE5F26AB30B9E495FF8B17AF9E36C6A34CE5EB0C6D5
+3F32D1B49D9DCC60CDA37C6511155AF17B1BEFB39F1921A92D9ECB1104D051D22AF3F9B14617C8331CF57D65AB4E939E
+gfp_mont_square 557
+CBDAC170ABFC74DEAC12D7097328A2A5E769C8B0F4705B87758AD3536F29AE66727D866ABA352C9F5E50C115734FB17A
+328A1EBB6FB311A09E378AB762DEC1FD23BF8EEAD836E8C2A033942B10B516A703586EFC710017FF9EC15513AF90023A
+gfp_mont_square 558
+7337E1151A17B3FB9B394F99483E52BA14734F952574231FF042CA8EE61791967F7648CC6D7F2E68DFF904D3FB9D96A3
+343539EEF12886C5385569286B558A44A296300FB692D04EA19B0532487341F738C8B97DFCFD12C09DC1F5B3FC9D2615
+gfp_mont_square 559
+627D18C0D5DF8B8198EA04D1329610B7B48FFFECD1FB45BF1C58A5020E6CD003C084A0CD715640F7EAEE257BA4B6C304
+DF7D8064A58128700C6A26D00625092311FF2B59C247751B9599592D9E12B78C37CF9DCDD6D0754A7D36134C75707CC3
+gfp_mont_square 560
+C096345B0AB10FEF9E1D4D124D61FB470F19DF162097A37A9F342B0F16ACC52755323391F1BF2D13CEED02F4760D731F
+FBC24E43D647F280521DD8414F770B4B6CDF4284A87B0A7A24D9788B681CB05A8A782A63BD75A5A1E95C08DEC1E45A91
+gfp_mont_square 561
+487C79A8D7C2CF4E2C7916AE9240050B4A23CB600840A6E315AF1599E97AE721DCCC694B2B9629D9362C12788EF899CB
+E836165B5663C15F6BCD0F79856B90C35AEFF0B7B1EBDA649E314FCAA6AE79D0ED93D74AC8D9E89DB24874832FD798B6
+gfp_mont_square 562
+EC50E56DFD36F80FA83B67B93C7EA61D882E3B01E103504DDA2958B6481CA39818BE497901F01FF87100CB895C919D70
+1A5F8C18A57358788B502090774B02F0015AA37F8573A27F0F37A62A91CEE9FF7B9343AAD51A22A7B4E643986D2DF5DF
+gfp_mont_square 563
+E3E02C9B1AB9901A35227B87CDB86D29BF7E0DFF1AEF7A59559702E30A117EBBC6FD894F872B2ED7095212555250DDB2
+3F81A3CE8C57E4D4126F085500A893DC58C5D53160C0EE120B784FABE726F06A361ECA260F4D0E9AD7000E493878CC6E
+gfp_mont_square 564
+43DD046468D005710958248E832351863AA2FFA62FB9A30BBD15706E4AB93942BA33AD2392B1D6268254A7EF2483F16B
+05D9C237FEA8CD674E383C62D21BB89DD108533439AC8A3FCD0F506FFDA8DD317927D6B7601A30E5CA8227945EE786AA
+gfp_mont_square 565
+1F988B0AEC1603AD4DF8EB374A1B274F08CCDCECEE87DBF46A11CC278E7284FF3B1648264E983FDF72B4C52E7AEB66A9
+E72D79AA6AED28B74B7166B0F735A181A56D4A7591B6C09180D68E2A7BF619AC64BCE6BB3541E5E18616233E510586CD
+gfp_mont_square 566
+15B5131431B0FB18685B47183B642343F709E22AE7ED112189AF85BE031428509F23EB7AC8035EAFC24755642E8BE300
+B2FA05DD405D127880C0169E6F8E8A0799012C9710BF4B5D1BE0AD43EF46CE930F1B49E4C41207C533256507F23AF226
+gfp_mont_square 567
+717D5EA58228432BDBAA725B948175B5785B739F360A8AB47C18EAC49E5D7E0625EB22CA7F8B5FEB448B8D82FA385A8A
+559F5E48E87938EA180F453EF6CDD4E0B31E47BD66AC52DA5183C0AF9AA2A85348194211964A972F8DF3805CB8EFFD10
+gfp_mont_square 568
+BA608092A0C95E75A6DC35EC25B413BD2C879453774EE25B90BD2F6F5B0C8AEB1762BA53F989D0F378E52A25BAB11683
+3F2336FB63526B45EAF6D16C12AB4FB34E2B3CBF97938D167EB3EA857694A889DE27508EA414A13B68662A5FA05A37ED
+gfp_mont_square 569
+D65D3B49F9E2488E09A7B4DA5C1A07C13CC5C9E7FB6E4C98470D0C456B4A947D23EBCB7A4A81DB939654ECF125DCFA42
+D1804CC11C64DE86485CF6A61EFF18054953247FF972F5B557ECE8017FE423F462FA238480BA0ABBAE96618AC264ABE1
+gfp_mont_square 570
+949C4C03661515C8F4AFC996A93F617B67D930965E4B7C2538AAB22F592D2938F23CF1BFAA954432EAD75234FA228002
+0957734641CF609088B668C721A211A823BA9C75F9314AFC7B476A20232FB16A99FC3B71BA7F4FC19231089638FAE5EB
+gfp_mont_square 571
+D3487F7859D8B4C2C939F6857FE0942CDC3712321D16D5612C9D169248DBD77E0E2D5C38052F91F545E971D2C43C847E
+C89FC6C26E8DC7445C7E9031432443C9CBCF85D21BB99E4BFB80012B7EC8809EF2965852852649676870BDD86877AA0B
+gfp_mont_square 572
+0AACDE2B9D8BF053C6C832D7D3F9F74ECB2F82BEAFF65146049B6932163CAE5DF3FDDC7A8ADF7F6AE1E5E1660796D816
+BB99466C095AE4EC0224DB60DA711044E3C99A6467AEA4BA0AA6FB56689B76C087B85244FB2815D801DF67E6D9FB5310
+gfp_mont_square 573
+73DBFDE58D1622AED3F7AD8003F99482BA71622EC1C78B7306DE8B5E8A97BAEB6FE7613D3F9182BD68F4EE90FDAD40BD
+EB4FBE3F0D1FEDC6AB5746223056A9B12BA9778173E3A25F2D787B0DCD0672E38759C8E79E698FB3B1433041F51C9FF3
+gfp_mont_square 574
+90BF28FFC8A95FF4DDFD21D35D3CAB399B0A2A129ADA671E8FAE0FF8A41BA42446BB36DA840A401835110DAAD74862EB
+8860616E243C97D6FC8048EAD222695B5C3218AF2757FB04E57A7F84CE570557BFF3941247213F1CBD897F3667B2E4CF
+gfp_mont_square 575
+4BCADDBA6D6A0F53AF1728D7119C095797F76ADEF1BE497F6DEB504DA1DAA59CFF1A8CE5B3DF1E72EA2097C16443A2FD
+803760D52CBA395DBA414B149E232CDE0F67A467CC26691F8CBD711126D2185262D4D1210BD38980033DDD1A56C632B2
+gfp_mont_square 576
+987A0798D0A8660D4326E88DA91E66CDB3FA7136DA9D67AB90E2B8C042CE60EA126C2487A9EB0279353BD94A5590A661
+16E72AAFFE62637FD09B89E43526536F38237D5F767BD64DA453CC7E5FEE50B5CC107720EDA1E8AEBD32E79446C55D4B
+gfp_mont_square 577
+7B70AC6BB67912EDA41A35F0FEB9BEF214F8E505066FFB8372CCEF24FCFE4287349F54A6522F4A9AE8B7540FF13EE6D4
+28F507B239704D60ABACD95CA4A0AEA77A9EDAC9BF86DE0F125A536B7207559B60BF1AAEF73229CDE93A6AFCFCC5ED69
+gfp_mont_square 578
+ABACFE580547EA434027AD5FBD43227218614BE340606107C914C8DA28DA132EF86C5EB83F81D2273A54D6FE4D2F4513
+B98E417ED3501942C86FC4C94ED89ED5992FAFAF94D12DD669E616F0066165FC7F1F4A48393F3D83B72310AE23F35A21
+gfp_mont_square 579
+A38E5D9B0C474C79C67106FE492C2FEA27462EB32A03B057D2D2CC3A2DFDEC00AE84089B33C0C73855E90D4505260B93
+AEA8122C99C7F22BB2318D90A3F28895DCE5082A73A10E0F99D99E1328B9AF5F22CDA98F97116CDC7670B7F73052074D
+gfp_mont_square 580
+4A1352AA253A5EE271416AE34779B61B540FEA273403C6CA21A3F75AAED9F73781222BC3B9C81CBB222A034975217847
+E1002D4D8302E7648BA989F7BDFC35598B5B6F94ED966F76DFADF59647F8B322989FC679A8C87372E92776687C377A6A
+gfp_mont_square 581
+F624FDCFFF8FEBD8EE57A31B8C886674A42D12EEDFD39017DE47C009C6F1E5F6C79D9D96A93CEB5D5B9B34E86B604C0A
+F1564870074F110BA17A53E492FF293906DDF1B545A4E526D967EF002CD3A70F41D41878922BB6CEA26E18715D49EEE9
+gfp_mont_square 582
+0D3F9D324F4331DBAF78E2AE9FD2791221DCB6DB302E921293349290335AA4C1B022D54DBE2642F5CDB2C0066A2753B8
+17CD445D99069FF3FC3F7C3938325795D2CACA0AFF90062709017A858D64AD3E87A5D440C86AD21AEE1BB37D08FB3FC3
+gfp_mont_square 583
+236EE3EF038C9F10C1C3C2779E9CBABCBB47EF8F7594B2E877705DA57C3516FA0E9DD1562981331BEDBA7034569B62E7
+AFD5989BA1159E6DDAC1F1E7D98D55791994FE619CD2ABB77B4D1A44012496CA943D0DAD453C0FABD6E8C25C0D13415E
+gfp_mont_square 584
+88B1D09B09C9A90B260930A0C970B91ACE32C5573E2729B52DFB21F328DFE7648289D9281FBCA9E99CFC5E8DB4DB7CFE
+185D5372B87158CD7E7ADEBF12271C0E8A49C005031E51B2AEF4EB6917C9DA0B7940CEA85BC6AD245257E93D1C626B9C
+gfp_mont_square 585
+670055287A84CFE4A97A970E6E8548CC7B409E4D9854DFA51D0C54E1FE76C039C33E11DC654EBD8642384AE75EA3747A
+65D00CA2BBD2942990AB30B707A50538B6E3C1510039F3CF6B1746F0FB9704F6DBF9155F097E3E766CCC6B5E2355D771
+gfp_mont_square 586
+5CEED6D74D42BFE0411A2F2967E6ED36C17A103E897EB75D1F668B340E4EDBAC57AA067BE6610B88FF9AE41ABD7B6141
+A7A3C070C64F0304260C6649716A5AED1C86C7A67106EDB58003E65F7F6B9C8DCB69320FF4D0414C2420D16DF5EE06F8
+gfp_multiply 587
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+82E4FBB227F30F300725FB0B9F8BF404637E522AF37911B8677966BA5D42E08FD374D44A9D60E7AA8FA683F4B17B6979
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_multiply 588
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+75628DF38A4A672DE5BABCB82F1390EB40541D28035FFB53968FFAB6695C49807033D01D48A53BE350290C45D1471C0E
+75628DF38A4A672DE5BABCB82F1390EB40541D28035FFB53968FFAB6695C49807033D01D48A53BE350290C45D1471C0E
+gfp_multiply 589
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+F831FF826691A7EC819BE1A066749DBCCD879BB1E62607B873AEAA7EFF174AEE879E66F0A075C01D8987AF02539D339F
+F063FF04CD234FD90337C340CCE93B799B0F3763CC4C0F70E75D54FDFE2E95DE0F3CCDE240EB803B130F5E03A73A673F
+gfp_multiply 590
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFE
+BEE46E993AF96FDE5E1C29694F46F6B4389B497CB41E70D17D65DFC7E59993C43CC873DB995A4CE9E18BBBBB67F6EAD6
+411B9166C5069021A1E3D696B0B9094BC764B6834BE18F2E829A20381A666C3AC3378C2366A5B3161E74444598091529
+gfp_multiply 591
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFD
+B010FEC0ED85BA7ADA4F70854D889098A9070D9ED4CDA4D0C963A8E69E2C879238E0449ABEC58982E2E645B0ACE6C937
+9FDE027E24F48B0A4B611EF564EEDECEADF1E4C25664B65E6D38AE32C3A6F0D98E3F76C88274ECFA3A3374A0A6326D90
+gfp_multiply 592
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFF80000000000000007FFFFFFF
+7AA84EE9A6CC60E92C09926A1DE83369FC834305F7EDDF51ECFB1DD1C29FDE5A13AF9896F01AF969FE159A6D92E8C849
+42ABD88B2C99CF8B69FB36CAF10BE64B01BE5E7D04091057098271171EB010D2762833B407F2834B00F532C9B68B9BDB
+gfp_multiply 593
+800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+A937CB4D7EC81EAAFCAE7B91958C16232EB1DD1B2891360D193099F7F40D9829D019EEFDCEA7F1C55BE8B1F6CD152EA6
+F756CFF06CAE5B20D4721AB9BA0C359539BFFCC23FAD190F799514DF04198F8E9C60E9CD0FA447C590A3AB935B0BFA86
+gfp_multiply 594
+800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+16B5945AD46C10DAC12980F3F30B5D73862097A9052545F09A90A0B905EE8F05E21EEB014CF2D1E42CB4145953A0CF68
+5DBABC4E4F4436C036EA051506B4FAC4BFDF300D4DBECDD6C780177A6041E7A2D8F010DB3AE56878E894C659F8900CBA
+gfp_multiply 595
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF
+5F346B34A77D19085463CA582DFF38DAE77F3FBFEFAA0591A54B6EEB670D596913BA49FD17ED77BDE21BE37C9EEEB766
+5882E6F7AB9C35A7D200C7251880C0401055FA6E5AB4911498F2A6968D114ACD88DE1D0D1DE41C83C045B3CEA0CB94CB
+gfp_multiply 596
+000000000000000000000000000000000000000000000001000000000000000000000000000000000000000000000000
+ACCA9DFB59B67DFDCB3CB2EE93739671328E84305F3A9DA8F084A43DE6E3CA33490DC3C42D7BB2549F43166ECF1C152E
+F084A43DE6E3CA33F5D861C033FCCE4DC436475A8101C09319163A9F2042ECE79703BA2560E51240D353E6885F3A9DA8
+gfp_multiply 597
+13C300A91859C35C666A32ECF75E08F2DB0063007C9539A1C23AED933BD3CD5A637D4BF44FA8CBD5FA0052FEC99239CC
+5399187B2638FB22B4EBF26A2D2555DF29AE9CD7DFD148725F215ED42AD937878EEC2B7ACC6097601E408D4E6C26A143
+133F0A272F7F323EF5E158EF8DB3A0318F9867DD92CC21DD43EFD4C4057C525EFA8FE8E3598C882202BF06E1D86DFB3D
+gfp_multiply 598
+B61376DDDB9BA94B6A77F3676F178F77FFE4D7B9833189CB5DAA78BCE2A5D4FFCC60E6739EF7590EEA6EF21A1D4CAB27
+ACCA9DFB59B67DFDCB3CB2EE93739671328E84305F3A9DA8F084A43DE6E3CA33490DC3C42D7BB2549F43166ECF1C152E
+6D299C8D0D5A95EEA228871603E18BFA3CCF61F294FFA3498A4BAD48F0DB1406C2B153BAD9962044B4DF674BD6E3FE43
+gfp_multiply 599
+7A8A9EE9D6210FA3EE0413F84D63E406A30E4C9332236680F0D2C0C5E19E82C4A0EB6FC11121879A71B9ABE6C6CE5B05
+F831FF826691A7EC819BE1A066749DBCCD879BB1E62607B873AEAA7EFF174AEE879E66F0A075C01D8987AF02539D339F
+F1FEBCE4FFD42A72E365AC0290E61E2800E2CAB9FCCD296094346846894829EF93215E2F6CA507B267D688DCB7110EE3
+gfp_multiply 600
+5399187B2638FB22B4EBF26A2D2555DF29AE9CD7DFD148725F215ED42AD937878EEC2B7ACC6097601E408D4E6C26A143
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFD
+58CDCF09B38E09BA96281B2BA5B55441ACA2C650405D6F1B41BD4257AA4D90EFE227A909673ED13FC37EE56427B2BD79
+gfp_multiply 601
+A5EA2A22016C84E12B306FC3B5E41861013FC16DE77148E5F9485E498AB78912423455F256AD802DDC1D41417E8782B3
+B61376DDDB9BA94B6A77F3676F178F77FFE4D7B9833189CB5DAA78BCE2A5D4FFCC60E6739EF7590EEA6EF21A1D4CAB27
+F700CECAE870F5E3D296791486F9537A496E40E87729453D80F3EAD10A9CAA4CDAD94A235F6A5BFC8B691F7021831F45
+gfp_multiply 602
+854D8D3713600C4086BC38167BF7C5AB99DAE697B730AFE8C945BA897C8BB3DA1C5FEC718B81BE4A1EF6C4034FD33F82
+406F29F62402CA31644D686A712B34409E11D1449CED892570D5189EC96EF60381B48A3ADE16309EEFCDFC394E3F1AD0
+EE017D7EC3711EAF97D7A1991AB52D4A00277070D0938B6A584F5C8015246E4AFAA88E0DD577CD5B7CB85C8B40922C8E
+gfp_multiply 603
+006EEB6FA06F72B1DD2BC5F7FC5DB3502E2F91D5C4447B043AAD70915B56A0604B1F9AC5D8FA5AA16942E3003ED53BA6
+B010FEC0ED85BA7ADA4F70854D889098A9070D9ED4CDA4D0C963A8E69E2C879238E0449ABEC58982E2E645B0ACE6C937
+39BA87686C0A1EFE4284949EFF92CD04A30A73AD5FD7264D83734E8E53E3F6D54A4E627A455C513651E6E140ABF65661
+gfp_multiply 604
+917EABE5E9520B19C84ED939778F3A8CE8BE2948E9ACA3D38B4923BE5032A185E85AE7849C0A7A5D0D8C202BAD3E65B8
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+22FD57CBD2A41633909DB272EF1E7519D17C5291D35947A71692477CA065430CD0B5CF0A3814F4BA1B1840565A7CCB71
+gfp_multiply 605
+406F29F62402CA31644D686A712B34409E11D1449CED892570D5189EC96EF60381B48A3ADE16309EEFCDFC394E3F1AD0
+000000000000000000000000000000000000000000000001000000000000000000000000000000000000000000000000
+70D5189EC96EF603C223B431428824C6781E2ED4E3488D852BA96549FAB4BC30900FBD4ED31962FC0124481F9CED8925
+gfp_multiply 606
+ACE631CB24D9236F9B09F6D11522A8D26EF34CD1221CFBB2570D1F72A97E833BFC63ADAF5CB7CC8B98DAC428C5630494
+006EEB6FA06F72B1DD2BC5F7FC5DB3502E2F91D5C4447B043AAD70915B56A0604B1F9AC5D8FA5AA16942E3003ED53BA6
+AB11AD5D9594AFFE6621F3426E3FC8069FE8A2B3A4D3C3930F83A3C1D700C93F68D701AF442D0FEFD366B2BB6C22A302
+gfp_multiply 607
+ACCA9DFB59B67DFDCB3CB2EE93739671328E84305F3A9DA8F084A43DE6E3CA33490DC3C42D7BB2549F43166ECF1C152E
+A937CB4D7EC81EAAFCAE7B91958C16232EB1DD1B2891360D193099F7F40D9829D019EEFDCEA7F1C55BE8B1F6CD152EA6
+EFFAD216BBF97D6CD4D5DF9714164D0B64A2C3902F94DC321921DFE2A4018DD8AF2E68C1AA231982BB98B36A34E3DC4D
+gfp_multiply 608
+5F346B34A77D19085463CA582DFF38DAE77F3FBFEFAA0591A54B6EEB670D596913BA49FD17ED77BDE21BE37C9EEEB766
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_multiply 609
+16B5945AD46C10DAC12980F3F30B5D73862097A9052545F09A90A0B905EE8F05E21EEB014CF2D1E42CB4145953A0CF68
+800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+5DBABC4E4F4436C036EA051506B4FAC4BFDF300D4DBECDD6C780177A6041E7A2D8F010DB3AE56878E894C659F8900CBA
+gfp_multiply 610
+A937CB4D7EC81EAAFCAE7B91958C16232EB1DD1B2891360D193099F7F40D9829D019EEFDCEA7F1C55BE8B1F6CD152EA6
+A5EA2A22016C84E12B306FC3B5E41861013FC16DE77148E5F9485E498AB78912423455F256AD802DDC1D41417E8782B3
+7E9BB0E8967DA6321F6C36CBDC57EDAE2A3DEC2CD9535884E3570A0058A04AA6329CFDF5AFA9BF504727DBBC36FABFAC
+gfp_multiply 611
+7AA84EE9A6CC60E92C09926A1DE83369FC834305F7EDDF51ECFB1DD1C29FDE5A13AF9896F01AF969FE159A6D92E8C849
+5F346B34A77D19085463CA582DFF38DAE77F3FBFEFAA0591A54B6EEB670D596913BA49FD17ED77BDE21BE37C9EEEB766
+1658606EE3F2D033DAC655E3EC2AA862AA5F72C8E2BB6F4569FF65ACEEB6E85BEBED9F85E31F246D74FB5B5CC4D8C9C6
+gfp_multiply 612
+B010FEC0ED85BA7ADA4F70854D889098A9070D9ED4CDA4D0C963A8E69E2C879238E0449ABEC58982E2E645B0ACE6C937
+75628DF38A4A672DE5BABCB82F1390EB40541D28035FFB53968FFAB6695C49807033D01D48A53BE350290C45D1471C0E
+F6561061882DEF53D0F7C144E455A7F90B3E9BB262F01D97FB86F8F04FE68FC3DCA3C653D9DF15DFD12E2AF866C65F1A
+gfp_multiply 613
+BEE46E993AF96FDE5E1C29694F46F6B4389B497CB41E70D17D65DFC7E59993C43CC873DB995A4CE9E18BBBBB67F6EAD6
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFF80000000000000007FFFFFFF
+A08DC8B362834810D0F1EB4B585C84A5E3B25B41A5F0C797414D101C0D33361CE19BC6113352D98B0F3A22234C048A94
+gfp_multiply 614
+F831FF826691A7EC819BE1A066749DBCCD879BB1E62607B873AEAA7EFF174AEE879E66F0A075C01D8987AF02539D339F
+7A8A9EE9D6210FA3EE0413F84D63E406A30E4C9332236680F0D2C0C5E19E82C4A0EB6FC11121879A71B9ABE6C6CE5B05
+F1FEBCE4FFD42A72E365AC0290E61E2800E2CAB9FCCD296094346846894829EF93215E2F6CA507B267D688DCB7110EE3
+gfp_multiply 615
+75628DF38A4A672DE5BABCB82F1390EB40541D28035FFB53968FFAB6695C49807033D01D48A53BE350290C45D1471C0E
+ACE631CB24D9236F9B09F6D11522A8D26EF34CD1221CFBB2570D1F72A97E833BFC63ADAF5CB7CC8B98DAC428C5630494
+1CC32AC3B3467639073D1BA2150D722C9CB8BC4FC20C04D293B25FC5C8178C912CF1D1DF99902CEDA9987E3785002DAD
+gfp_multiply 616
+82E4FBB227F30F300725FB0B9F8BF404637E522AF37911B8677966BA5D42E08FD374D44A9D60E7AA8FA683F4B17B6979
+BEE46E993AF96FDE5E1C29694F46F6B4389B497CB41E70D17D65DFC7E59993C43CC873DB995A4CE9E18BBBBB67F6EAD6
+9E43B0AB8CC42B2B3B358A082A74C07610D2E71FDC8FE75059E9298D8B8AB6E7E8A26E6902E667E2F8B2F23645D42C81
+gfp_multiply 617
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFE
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFE
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_square 618
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_square 619
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_square 620
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+gfp_square 621
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFE
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_square 622
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFD
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+gfp_square 623
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFF80000000000000007FFFFFFF
+3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFBFFFFFFFC00000000000000040000000
+gfp_square 624
+800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+4000000000000000000000000000000040000000800000003FFFFFFF7FFFFFFFC0000000400000003FFFFFFFC0000000
+gfp_square 625
+800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+4000000000000000000000000000000040000000800000003FFFFFFF7FFFFFFFC0000000400000003FFFFFFFC0000000
+gfp_square 626
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFF
+000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000
+gfp_square 627
+000000000000000000000000000000000000000000000001000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000100000000FFFFFFFFFFFFFFFF00000001
+gfp_square 628
+13C300A91859C35C666A32ECF75E08F2DB0063007C9539A1C23AED933BD3CD5A637D4BF44FA8CBD5FA0052FEC99239CC
+7A9E9EE59CE5329EB7E282A530887CCAC1674A9A1940CB94EC77C259A19605299EB49785172C238A29403553FD280052
+gfp_square 629
+B61376DDDB9BA94B6A77F3676F178F77FFE4D7B9833189CB5DAA78BCE2A5D4FFCC60E6739EF7590EEA6EF21A1D4CAB27
+903CEFCACBC23FA65F38EE7BD74D8954E497797DA293024C2062896872AC88AA027718FEE585C1165A54464E2D1058A4
+gfp_square 630
+7A8A9EE9D6210FA3EE0413F84D63E406A30E4C9332236680F0D2C0C5E19E82C4A0EB6FC11121879A71B9ABE6C6CE5B05
+2ECFF1DDEEF2834CD5179529303EE33301B572D1DCD53520D47B448F87A4F5C147465BC17E137F8AB6C9A52969557B4B
+gfp_square 631
+5399187B2638FB22B4EBF26A2D2555DF29AE9CD7DFD148725F215ED42AD937878EEC2B7ACC6097601E408D4E6C26A143
+B32738172492BD6284EAA052C69B8CFE2D1DE6A24A7DA9A3F9E5E77AF1C093977163591517137410E21AFFD3FE33FDA4
+gfp_square 632
+A5EA2A22016C84E12B306FC3B5E41861013FC16DE77148E5F9485E498AB78912423455F256AD802DDC1D41417E8782B3
+5C25FA4F5FACB346902F01C15BD3EEFD937FB1E11883478C15FB4DAC11DB1CB952B2DF01AA2A9EC2EFA32D51FE55A82B
+gfp_square 633
+854D8D3713600C4086BC38167BF7C5AB99DAE697B730AFE8C945BA897C8BB3DA1C5FEC718B81BE4A1EF6C4034FD33F82
+62C996CC8F9434C4E25F212CAEA2BC16C95FC0B99C06D9C426DB3DA66DA7D34FACF0D75021FBE82068C654EE8A2EA92B
+gfp_square 634
+006EEB6FA06F72B1DD2BC5F7FC5DB3502E2F91D5C4447B043AAD70915B56A0604B1F9AC5D8FA5AA16942E3003ED53BA6
+A27313849C90943C63B20BC8C311A029C50D1FBE46D23CD7ABCF5AE590700F1812F21A30340CC429CF5C9EFC80E850C3
+gfp_square 635
+917EABE5E9520B19C84ED939778F3A8CE8BE2948E9ACA3D38B4923BE5032A185E85AE7849C0A7A5D0D8C202BAD3E65B8
+1CF96EEFDEA73D5ABB62FFE498376D7B812FA875364DDCFDE9C22085034CFA8ED5ADD5157C26ADE803A9154410EC7826
+gfp_square 636
+406F29F62402CA31644D686A712B34409E11D1449CED892570D5189EC96EF60381B48A3ADE16309EEFCDFC394E3F1AD0
+BF3E9A0D7E1A8FFEEB566A3E9304FCC638BAFD5CC109D04EFADCA137A9AAC9ED354D578A948BA6BE84DC8CC394DBE2BD
+gfp_square 637
+ACE631CB24D9236F9B09F6D11522A8D26EF34CD1221CFBB2570D1F72A97E833BFC63ADAF5CB7CC8B98DAC428C5630494
+64E7F07C759389F7EC10EA00B1FCF90602FF8E46AB02CAF648AE22D8BA84D8225D2465E6442783856BFB349978D855DC
+gfp_square 638
+ACCA9DFB59B67DFDCB3CB2EE93739671328E84305F3A9DA8F084A43DE6E3CA33490DC3C42D7BB2549F43166ECF1C152E
+E31F42EBBF0A5605399166844F01836D03F8FCDDBDD6204106CCF30B5FF96682C53B9EE8DF7448307D86EBBCE3FCF4D6
+gfp_square 639
+5F346B34A77D19085463CA582DFF38DAE77F3FBFEFAA0591A54B6EEB670D596913BA49FD17ED77BDE21BE37C9EEEB766
+D6DB288225435EB783B7C4FD4D1C3CC46A6CCCDABE55801E4B1BA20EB40C69A8932E303BF519E7E98CA0C369455B19B5
+gfp_square 640
+16B5945AD46C10DAC12980F3F30B5D73862097A9052545F09A90A0B905EE8F05E21EEB014CF2D1E42CB4145953A0CF68
+A0FC08864A188F5E55FD9E7C294BD806236FB8135403B295F5FDE244029FBF1D09B42FD3344B3AC5DDC40DF963FC367A
+gfp_square 641
+A937CB4D7EC81EAAFCAE7B91958C16232EB1DD1B2891360D193099F7F40D9829D019EEFDCEA7F1C55BE8B1F6CD152EA6
+6B541DE78669432529B2D83FD431AFCD19A077B4EB7C6828938EDEB596D2C601E98DC41BC9B88D52268AB4DFBE70A1E2
+gfp_square 642
+7AA84EE9A6CC60E92C09926A1DE83369FC834305F7EDDF51ECFB1DD1C29FDE5A13AF9896F01AF969FE159A6D92E8C849
+893F6C892E52860D4E42560B82C1520DADD83F2D3CF4D5C933842427B20DC0431748F785E2CAC4466DBF3D608EDE0499
+gfp_square 643
+B010FEC0ED85BA7ADA4F70854D889098A9070D9ED4CDA4D0C963A8E69E2C879238E0449ABEC58982E2E645B0ACE6C937
+4D3A2539AAFF5EFCA116FA51719FD8C21047519D645E567EA2B8B05E74A35E391F8EF077C14192D86FC64F8163B6A9AF
+gfp_square 644
+BEE46E993AF96FDE5E1C29694F46F6B4389B497CB41E70D17D65DFC7E59993C43CC873DB995A4CE9E18BBBBB67F6EAD6
+510B49A99CA77CCB8D1461D707377EB51651E29EC1B5F762BE0708D3AD413032F0AFA89CE93AFACF7B09E1A36E987612
+gfp_square 645
+F831FF826691A7EC819BE1A066749DBCCD879BB1E62607B873AEAA7EFF174AEE879E66F0A075C01D8987AF02539D339F
+79A938615798AF9892B365E5707033D06FDA5C435E24970B503205B3D0E3709DC2D9C0151DDFDBB3DF4F9AABE2FC9D25
+gfp_square 646
+75628DF38A4A672DE5BABCB82F1390EB40541D28035FFB53968FFAB6695C49807033D01D48A53BE350290C45D1471C0E
+30C3B6EAA2DFDC06F7C754396A2FB7203BF1DFA4987D573E7ECBDA208FC1022D8D085D1A0CB30BAAD4FEC0E21FD9E944
+gfp_square 647
+82E4FBB227F30F300725FB0B9F8BF404637E522AF37911B8677966BA5D42E08FD374D44A9D60E7AA8FA683F4B17B6979
+A96EBAA9F31C140287948CA668DDAAF1E02F95CB04ECFF703A68DD3E19BC5D2AC3A7CA8F26F24D84D376523DEFF50F2B
+gfp_inverse 648
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_inverse 649
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFF800000000000000080000000
+gfp_inverse 650
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFE
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFE
+gfp_inverse 651
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFD
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFFFF80000000000000007FFFFFFF
+gfp_inverse 652
+A50C5682C99C6D5E891CF2A8C7602804A77EDFDCDBF91CF7D0D944F833BF8E813B60B6EE7180DB104174DAD7497A90F1
+63F66027363F9D84C626E5D0FA48645C750A95B6553FDAAFC1597CFBC2298977D0E5E8B786CAF88B5E46955AB458491D
+gfp_inverse 653
+F800AC48FEBFBC9CF94CA5C8BEA990D7BB59D1ACCA6082B786EC10034143F610035B7AD2979B26F1471F034236C5F891
+C0A11ED729C19D6AC8BDB22F8ADEE238B886A2E3599E1FEDA247215F5DE3D5295D223292D810FE26AB3D00A332182843
+gfp_inverse 654
+5CAF4FAA0861B9E7A538E0F19869CE6795BA923017FB56EE84754EABC6EA85FB54BAEA7EAF13516CDF12453EB54C3AD9
+E84A9FE05A160AB64A6E34136216A890B01C33B2D62FB877C5CFA0830B6FE0E814FBC368DCFDCB2FA2DF2E353D708D2A
+gfp_inverse 655
+5731A72AF2A87A26B135F2FEEBDB69A25C40E9C8072BE2FDC349F9C7F2CF0F9639EBA3941DFB88FEB0F8D1685DFCEAF6
+D420A3DD651A990EC4A6E9FF994C9C28757764CE7AF82E5E343FF09EF21EA5A18F0B59A36B66842900F511A9E0E8DAF0
+gfp_inverse 656
+7C24F687116E32C65610D31802841A9F07C81F7223AFACFE5810EA030D3F8234F8A03880D51C685CAF88A4D46F854E45
+BF1B96FF87996C078E9F58BAA63F9B43FD2403BBC0F95E85BA5D61181B706B25FBBBC21CAC24F465784530A69FEF1E0C
+gfp_inverse 657
+203D308F21E3A6613AEFAD9045F259E79DBFDF8A973A6505AD5713F51667C9CD4381A86BD40D84A276B074C900A91AC3
+DE70DC397B2C186ACE2DD109AFAE3648F611F81C1B2E5CD36B20B25839AE368E4CA80F160934AD650F56167A8D8C516F
+gfp_inverse 658
+847F69C4904469F36DD90A68980488F7FB633C7162478BA8A9B58DA5FA28AC543E32F4332E8D40CA8BB78F866B51C642
+EFE2C5CCE37E62D553F762BCED43A243315608717B9C0C56F510CADABB4685CFDC0249D7799836E115801F21CFA3379C
+gfp_inverse 659
+C21089703149BD8808699E04E35722074C8EFC102303910540CF517D4528B339EDB492927AFDD002D49EE0C0A07A861A
+40B70CF6926EB3F999CDFBEA6355701A710C7D0065173E71E275CCF99ACFCC4E564C3BF3BCDE1F824C2F1763D458AC21
+gfp_inverse 660
+291452F98379354A00A9D5C5CF3D822FEDAC9118F2B518AE1BC28A53937894B02D140C93CEF15EC41ACF5EAF72CBA482
+8EE9E77CC0DB427FFFDBB1C7C1F991C064E2979B2FEB4C5A16218F166E2F1A4A993DB467775EC16CFF0A6F9C32B1EDE2
+gfp_inverse 661
+8A9EBDA5B1BB092CC469271D87E23F83DE9B7FE5DC9C16A67C780FB479441AF164A4268297BAF5F026E8B9A61EB28A29
+F73655C1C49009208A6C42CAFAD906BDDDCD698ECAB82D3A9FEC8F176656A6B356ABCDFC488B90EA1BF8941F09BEDB78
+gfp_inverse 662
+7544E5E4EB4D6347C53E827127837D33636B371CE63BC275A4EB8B86D78670F03723B986786F1F91CB9EB546CFC6153D
+1B8D92C0A819E632058462397FF391E4ACFF5CF6687834D9A5D0AB51E25C08DB122C537D109AE59779D87DD5F400AF81
+gfp_inverse 663
+969E88CD5EF9111949290466220132A251C1B0504077725C6AE75E6F5677AF4A02BADE3ADAE10E7BE9142223DEA78A4C
+27820B5B1B7FA04AFD18319A8933CB47AD3FB1C3F70841B24A82D2C32C02E8415CC804498DDCA8B644385E6573F99E95
+gfp_inverse 664
+9ECE426D9F5C41D6685BAD6F1520B7602D38C7014E0F7553C7B002ED015F0402392A7A385CE5F554ADB7D032DAE32885
+45EBECB5CA5240D1634134E66A7B9BBCCDA2084580F478413549F49F65AA2BD7EBBD0AA1805C76AA3D0910B6EBCF26E9
+gfp_inverse 665
+E9C18038E91113CDC0CAD78520385F62696E33D96162147031B9144E16D70903A45FCB41ED3722B73B4455FDC4AB2072
+D9BE3A6951233CC916C5BC66207D69F04C13A6E436F1562CE76AE8B55408AD7249E9586814CF316EB05095A9DFA34822
+gfp_inverse 666
+EBCDE5C57CF12F75F7FA809AC6C3A066865D5608853100D10CE37959F43C0F80EDC4A9108511F17125C51900D6435019
+D31DF9672A076407C6F4DFDD46B6768FBE8FF2EF6DA323D7AE5EB9A8095C44D407759E8AC14976B263EC8B5E26AA79C2
+gfp_inverse 667
+A9ED3B2FA641E0E745E3A487DE028B8263C0134797787305B65F7F96D779C66954253303FE91D546E20A753D5D404A35
+21E7D2FA1EE20FD9970A46EDD3D9F08FB6B931494B3AA5CF78BAD4A146DF0EC46D5290D1A2A3B1AFB6B7A1688007D871
+gfp_inverse 668
+FD3E31C6B83B82929C85039E9A65AB3496C62BFC1C02320F0A8CDB0D21A9FDA342F637181114C739F78A2C68CC3B28F1
+996B4685C39CB371B41287F1C6AA0024FAB4F6E83F790EDB8BDBC237B60DD6DC9FE23E9BD1B56B7C2DE923646809CAD9
+gfp_inverse 669
+1624DD9E162FF40BF7B8AB53C76E5BCDC3F5786EB0049F8AC84249EB1D14A55E81AA52288150AC54D1E8F4FC27B5E192
+44142EF8917A622B6FE23C5C7906611624C436BE1748CCAE4F2B632E8ABA042842545FF4ED73DA5AEA2BEDA4A1B6D0A4
+gfp_inverse 670
+D18FA6F2BA5BD72FF93C0D9828830469569E150459DDBDBF3753A1751FF80B0AC145B234AA36AC40D53161F7FAE1E856
+FB951A9080B241CA3E3F3799241864AE720A702476E61E5C119C3AA47FA68F44EFCFA7F062C7AA2F55ADFD19662104CF
+gfp_inverse 671
+ED79BBD3BD2C3B7A7AA4A9B3DC0859482020D2FCA0FE694239BF543E2F1CC025F7114A9C2CD585EB3E85889CEAAF9CC2
+6CD176336136A866CDC90E187D95494524003D45AD2319B7227D903611F4A051AC02B671ACC08E481C173423B75367CF
+gfp_inverse 672
+5F008E66926847883241A435CDC445C2F89F6C36749F86E422FE00719D372DFEB9F8C1161C4A838C9F51C7C875303AD4
+D661CCBDE7705C40279B8C509F66DD53D41A7C4A43D8C5D04C0FA91B5D470F1AFEA28877F11DAAB2348799362D648222
+gfp_inverse 673
+0FA5154400647EE4C0B222174622404D117AD089E96371F6437D304AA040BCCB550EFAC3F899E134250525BCBBE66483
+13A84E491CA802256A498FC192C936FE5139D05477D0F497B94BB0BD7C56D09A2A75C15562CAA1B533B3E10588D51AFD
+gfp_inverse 674
+E479DA6F464FFF7902E3BBEB0FB04005516EC94274ABB14FA17E9059FE5EE98B7ACB1AE107A5F146A7819015E1E531F0
+D3121D412CA6615787A9B18D62F64099E15E75EC72859CE8EB511CF8DDF145CD97088B1FAE42E0E83F025523BEF4C07D
+gfp_inverse 675
+245787535F86F15FDBE4DB88D5ECBC67BCCDA8941A181AC256009EF79FB3BB2EEF02339362527D5B19F47B77B8A7A602
+CDDCF0C4C04585305F37E57288C11D0407DB32FF9CA0F941102568D2A4A40969DB9A173F0EBF1299EE3CE99E8B1DFF37
+gfp_inverse 676
+F21EF33D04F30E35C99B2A8A678814C3BE7014D578115138C30DC963AAD41C555ED1520825B5E612C17A8380D530CE70
+93BC5F9B9CED6997E90AEF709F85326149DBCEB34CBBCD953A16DDC221E63490A235A51D623CA9A4DDD675F7DCE66FC7
+gfp_inverse 677
+F147F8C8FE7E5286E48B372503304A905F9E66D7721DA0D9FC5C94D91A97920B269E93AFD68A4215E38F4BAB881E42B2
+28F0F1737F53DF28E7691953B75A4DB060CCD5138BAF838A6F189115E12E8278EC7B16B11A807399DEDE9B6F579B3C14
+gfp_sqrt 678
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 679
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_sqrt 680
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+gfp_sqrt 681
+57BB7D973AC4DA9AFB81392137161C16B00FD7BB4ECADEA281B62BB5F86664AE64A149F5E3838B9ED5A9422A8BC08313
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 682
+7B3D3E48DD9B6AEE7443BD3DB173F19FA329B236C600A95660E9BCEAD590A48CC4CB54EED2933DEE4D9EC36AEE478903
+1
+0DEC6823FB5C9D5658F92DEAFD4BD030679A44DD23C49CAEA2CF62BABA958810B4EBF4B6E1C60AA3D510BB0432D90DCE
+gfp_sqrt 683
+90F6953118924FD46AF9F44952B3920527FC406337E18CE84BA83A0BB4A05BD05A37400AB2DE385A9D1F19C006FC4189
+1
+15A0CCE60E2EC40A29CA862D6E4505F5416E99B0E13E213EBDAAEA00A01D616F121AE3E603A63966213BCA7FD644DE30
+gfp_sqrt 684
+00460D692ED654115B49156137C60E984F3E885EE1E437B7F735EFE608D180113E940BB452D31E1B8C0D0033FC2325AB
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 685
+859082007EC528339EB56390A0C715DB00E35769467F3B6F1C31803ED8639D6561D1BE06BBAF65BC02BEE2929FF9CB00
+1
+0144702BC6B789EF81365ACC3F88AF5933736DCCA7F0C99E80B5244A4767E1FA79823EB21579DA0A61B2480C55D85E8E
+gfp_sqrt 686
+94CFBD755A35AB412512BE6AFD4D3C0BE6ABCB9DDB223D45CEF9BCE0925B5B28D33EFE37DCB1119C06593214672045E2
+1
+4DE2F8AD4CB59AA705C22D3F64DBC8D30AAAAF81963892A766465D2824D4589C16FA1421D129D06743A08F0617420E95
+gfp_sqrt 687
+B96245D348BFCBCF264337987E834904FC173498B87E4E2B537D9128C3A9E88963B759F598B81C66E10C167DC8B6EB01
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 688
+5647E64A603C6554803F32D557312F584A6FAA58B02C9E9730C0151F40C11143D3ADFD28F0684BB3A067352DEB2F2729
+1
+BBDDBB9B6DE2FB1FA098D6918352BC85E456559CB70AF5F2D5D5891FD329D65C0B35B1DE250E7B34A4AA07B49E6397D5
+gfp_sqrt 689
+58F9087E9FE54CAFECC22EE9DFDF3D3FD80C53B2B6956547053DC5E80E7F5260613A06804F3FF472B42230883F2DB9CA
+1
+CDFF5A1CD01A914CD5BE785A9187DF42811E7616C0BBE6ED8614F504E8EE65A123A9A9DA816B2332CFED943BB3783A7D
+gfp_sqrt 690
+8EFBA442738E0B77D5F860C3606A0DEB1ADBCE5DF5A2D8795C57532BA31A49DD221265400AB7798807FA22F715C89201
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 691
+378770E472A7D2EBF2C2E2175CFE69E2D3840CD86D380A654E7D5FACE3C5536844A9E250D08C3BA66B18999F473804DD
+1
+CC35E83474FA941200D935344387EE7B7D42646F3E9B768FAE4001E3880CB401A050609804D2BE09A0B558640CFFF055
+gfp_sqrt 692
+FFF8157F24619CDBA11DD38BB2BA8CB0804BF2283845A54D348EAE9A4FD6AA1B3A27709E09C416E17D8B484A525B148D
+1
+BC9E28EABEE8062610E8AD0186A74A63A8C7D9E01789819F8902DAFCE5D9FE8180C2B5F1EEB89FF1BF8E51AA11F2D44E
+gfp_sqrt 693
+C458272F498DBFA8AF06BCF7E91457DB7AA068F113A5397F61EF7BD1D874BC797E736D5F75D8D8A4F9C9C679A661F62E
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 694
+9E262596B6E0FF0358F927BBC6B376AAEB7CFBB707F4D75980274CB4BAF2B1F8D59882547CC35C4AAFA7E232C0DB1AA0
+1
+BE437C7BA6CAF4A341023AED54EF125A25BDA659998648E013D5316F32C32444A48C1D5CA1FEB6249DF2025F0BF7A4BE
+gfp_sqrt 695
+B65787E08BAAB75376CC3B32400FB456FD888A7EDBC38536E8306E219D4663228F898C9214DFCA60DB99D08C6B3635AF
+1
+AC084BA5F8F659AC44CE4AB37C5D42DC0F877AE37B7FEC4B03312EAD222930AE9158D4A89F03BC5A4DEE4812B16107F2
+gfp_sqrt 696
+047B2C107912EF4AEFAE5D4E15FA8B65FA6672CD4FC9E91833020CCD8C90473EE4C717FDFE48EF631E563408C4653CE0
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 697
+3999392791D4D2B8697915C74BB58A6E3BDA92777BE64F02883AF604BC2BAC598BD596FE68F1C62026D71139AD54F82E
+1
+35B7E44863087E5244C6B895FE749E67730F37F1FE9EB4ADF7D5F12481B1C025D1E4D0A313932904757F1CBA4A227F3A
+gfp_sqrt 698
+627D81C47C8D6521663E93C89889B067F290FFC0DE6D7B8094A197F1CACD7D76B98A56D403BDB0A884418B0C7E35964E
+1
+F3E6CA734305E98686292BB5BF5B411B24491DF6171E1A8C94DB5F8F1319D42435F10300EE379C65F21201E4EAA3556D
+gfp_sqrt 699
+736506ECAE7C8F097DDFCBC9F3308CE500EB4E1128B88073065B8C3564E276027C73B6C9E04B0DCEE5D00A4D7F7595B7
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 700
+CC51C5D2332FD4C9507E2859BE411A68C79471E73BC8D8E688B8F4A662A030F02ECE485D5BDB2ED925619DDF643676D3
+1
+00721F8454D1AC6BD71961891EF3EA4450EA7DA760487E15580DC5AB6A8AD9CB24056360BA28A6794D4CA9C767C98FBA
+gfp_sqrt 701
+27D29D6B91B33E23B3E6A7D86E12FD925B1B5C9C665567A815417A830C7110D0CDCD9D9A49740C92C61F322447480FBA
+1
+E6CD10F103003005B688B661321C1744ED2879C1F09C0AFB1EBB079465F456AAD6CFF718569908F6C0301B2153158CE5
+gfp_sqrt 702
+5C57722E138EFEF996D4480FDEB67AE7FFB0DD9E63E1986964950DC210A25B195F49F0FC40D284064A327E2DBD6A996F
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 703
+4D93580277BBC14B81BD48AFE677BAA7BF75434F1790CA2A2686D38AC0CDABB011C908BEF439C0E0E616D7495591302D
+1
+491E99F5A97766FBD5AD53600D36CE2C1A09A84047D7DF790C5B4C59DAB0792946709312C172B2986D94DD6DECE8079A
+gfp_sqrt 704
+3BB75AD6926AC1F818710CA556303F69530115FEF55D06924DA83546A5E1D817103F100982133BDF919F6A83EC707A01
+1
+5F93D180C5EF5CFB3099F27150CB407A82CE786F6FAD79364406C053F895FC553FD3BE98261F40DFEF82D1A3A28CF7B2
+gfp_sqrt 705
+F0D1AB56E02F9A72E9D625C966692158A1826327C2FBD8A3CFDCC257076D490AE25F4B1C6D80DE7CF4C73F2BC8FF1C3A
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 706
+82AC21C45E8B5A2C295E62EE2F60423954AE4982E4F016806675784ADB4C95C991D9C1C556DAA20A42BA825CF14F41A2
+1
+C0AED9C59D6B023F736B96A0692FD360BB7B738EEEF795CD0CAA761214A0B00BB835E8A534145E878C9A37518DDCF83D
+gfp_sqrt 707
+FF1799A972DACAD19DA9303EA1482D4C1464C7B97A24A463AA96606FA567441AE2863F61BC42C6C28F8DE1E189FAE4A1
+1
+78E10E702BB71C682097798C8CD3E418ED4142BAE9729F3F0C89C0017C4EA6034944F2CEDE962A6DA4FD57C523797D46
+gfp_exponent 708
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_exponent 709
+818C44CCE49B83E1588CC4336F544DA81514947FE8157677A74D58E93D2762DF50826CF4D324AB07B73ACB9527E8DE99
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+818C44CCE49B83E1588CC4336F544DA81514947FE8157677A74D58E93D2762DF50826CF4D324AB07B73ACB9527E8DE99
+gfp_exponent 710
+9E19F9DC5D61D897F88220D29CDBF4F4DE89BFA4768E2E84E8B5F9837F8EFEB9AF1028C88CAA7B9BE2B6F7B4D331C014
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+683550814491498385287572309E14548F9E493F37E1931A6016ACC5A1B6B1ECFE0688AEE94D90C69A23424A4E5253ED
+gfp_exponent 711
+2965688DF22AF6539C40CFEE5639E0C5CBECDD5184CD396438A0649318C5D5BE78094D932A6996A59DE54FA023075A7D
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+6FCF141AFA104FDD852502B2F5BB162EAAB7D6630B8FCFF9EA897E8269C98F70B47591CD4430D5D489BC8FC0DCC80DC5
+gfp_exponent 712
+B006E5CB5678E445337291ECEB63097C98EE483CAD1AA7F3B901E4DB6CF78C3E388A1AEFF122D2D23D6CD8518E26089E
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFE
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_exponent 713
+3C937ED8A92D2EED2417A30E924756C6FE1FDB1952C3FBD971CCBCEC1275615E443FA3A5C63B167390360A0B20DF5ECA
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFD
+6D17118D240432F7C457D330B7D625C82B3EB3B9851E86F12156BA3BE8CE5BFC336D4CF65DE81E1140EEB712F537B211
+gfp_exponent 714
+1E5650404F73332CC4D41A505B0D6D42662FD2BB50A48F13EBF52C10056D2899D70586C165D188649804037CB84FB0BB
+800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0F16C31ADB7E40CBD815FDF1E09B05B5EA55B52B55E84D48AB15B6F982795BA9725BFAAD0993BE2DA5E2C5C60FFA889E
+gfp_exponent 715
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000147FD
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_exponent 716
+5688644C7CC90D4902B60447993C6F21694A27FB7256DA18DBA5F573AA3F06B3ECC23BD3DB5ED8F7AD8C505862DB305A
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005A8
+59AA4B17A52F133789EF1B87325F810E1D60B2F8F21AC7EAB1BA3A682423BC7E3242F81E29B29C371367772BF11AA3B1
+gfp_exponent 717
+B459165DF1D82A7903E4FE69C14CDDC5042F46E133490683E9EFEF7DF9C3F39ADC358A98E251BB63B758FF498C460673
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000E
+F68C0C625994E62FE536D454041705A76330971C76C9D59CCC93E9FD3A3E65394CF0996E8730F536060D9C2934BE7DF8
+gfp_exponent 718
+2CDE12F99C859A6A1A7007B894A69F9FE05854BF7BE9DDCCB48CCCBC5F5DC77951A3DA42801EC5A1B003D32F9B76E5D6
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000055
+D65CBC72E1149A7C1CD9F117AAF8C98EE9EFE85148B7FE22A87507AEA4DE88C6D7F9DBECE7B2274DF93C029C465AD3F8
+gfp_exponent 719
+EBC8488BA1A10EA43F94126A32C2E838073890738C290E3414D5100A46A60F8671DF7330FFB20DCA0DFA28901D2EAA75
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001B595
+ACA09D65249075BDC2E5DE6564E67B944EF508EFBCC19D1FEB331CB8B2D8D84F61AD9A975A26DD7A21A07433F3EBCD90
+gfp_exponent 720
+F6EA47942881AABA9AF4203C7CBB0A4DECBED946501F2F4DB56CBE49627A836E583B1F5155D8CEA20F532179131A92F2
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007
+866963DFC0529F5A1F7646A139760AD3CFD4CBB97BD1E63941594FDBC1E2080C22D76F56EDF5246E94032C7530E6CD5D
+gfp_exponent 721
+D64D8ED97A3DD45D0F2048B6F33A6F35E44FF14CF85BD898F1205DE1A0F00A60465A7768CBAB4152BC8A27387D9C1EBE
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000EA
+6D52B928061155852FCBE07689A295D5368E41550CA8301BE176840765355D7E098CB1719893B94C8347553A1582F179
+gfp_exponent 722
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+C18889E9FC7EF218EA80A1BF7B45E70E33DA74E682CF6DDE842AACB0188923A9AE794E83FAFB5889DE984E35001DDE83
+C12FAB19EB5495DDEB8506E9901CB1D1C3DBABD46F364084D386FBB7CEC8337D416B3E0361FCB2600F4034241B5C88E8
+gfp_exponent 723
+8391CF290ECD054BB0D593A7C886ECC8AAD39891FB3350CF8A7ECCC8CE018424E1388C353F0A3DC9C3319574959BC009
+00000000000000000000000000000000000000000000000000000000000000000000000E6BEE755BFB5E37C7D1B50900
+D815C02E160E9433E93F9C79D18D0AA0AAF68B4E2BD4F7952CE99B3989642A41D0C23E46F62392D8D977262C07BC3D03
+gfp_exponent 724
+28E8A632AB242DA8CD83D0ACE060284F795EEE9C85EE467A72E28BDDF092AFFB66A98F76A66C7FA1821C6B2FC40C0434
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007
+2B7E77532B71E609A6A26B931D0FC4B24E77AFBDA0D3D18DF6B5BE2AD855CD95F0DB24F10C3020151171BE3FBBAEC733
+gfp_exponent 725
+BC7ACAE5546264F2EA70F0FF2BD6EAB5B267D403CEBF369D82A3476F9D4FAE58EC62C78B92DE73941E1E961EFBBCCEE8
+000000000000000000000000000000000000000000000000000000000000000000000000000000001315736D25D3BB92
+48D962F1E3A268794AE11F0BD4B0303FF99DE8F630C8CD7D0F5A9F37F9320C94054BB8F5A63CD9335E033788D8657D60
+gfp_exponent 726
+28C6E0024C4A46752EC542378DE7DD357257BB831D94225C9FC5CE0A66248D47F3BBB1DD8BD8FEFF910520A04B1BD5EF
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000A9
+831167A0EB7E68A558F1D8A4B731C2090655D9B5FE78EED8F00CB058564F339F2C6B283BCE5DC69E04D00F611D27BF1E
+gfp_exponent 727
+9B549BA26672B3F9ADB3A8460E4A6D28876DBCF95A6608705B678343FC02A5D4E58335B6E2B4D050CAD8A763BF95FA89
+00000000000000000000000000000000000000000000000000000000000000000000000AC96735E5F385544CC74D785B
+9CAE52C8434BC305B100935846ED45766BD31158A9AB9924C9BF98B93549EB298D459A23C8BFF495C783D5D4F692D8E5
+gfp_exponent 728
+7035ACB278C61319B03B3B44F4DA1720B6DB7235D542674C8D4A715B3F23C1C1E94E7187121059E4467C885DF4AE790C
+00000000000000000000000000000000000000000000000000000000000000000000000698E5358AEFAAEDD558A2687D
+83DEE97165B37DC95D14687D808F5FE8BBA5F7915AC49CDD118F06BF9408F29CECC78B2378BB4DA9EF52227FD7F73DF0
+gfp_exponent 729
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+00000000000000000000000000000000000000000000000000000000000000000000000B68E8E6C340C50D590CC24620
+B9E694402B8BD670CF03100EFE7ED46AEBB00F28779994D5801B3D7032EB0EF739C4655CA0865D4034C02F32D49D6759
+gfp_exponent 730
+1178983D4AD0FDDED97CB126A11CC4B71023D8CDA6C91B3E10E91B218C4283827A1AF1A5309CFFF7F16E5912B382F4BA
+000000000000000000000000000000000000000000000000000000000000000000000004071BA538FD8CFC6E32FAABF6
+BAE58BE26C519B1A5E68BCA897352B98ACE495248952C516F857580D33C158971B80621A4B9684CD6A3BD03DD971AE78
+gfp_exponent 731
+3CD0D3E3918A88E35295CAF17C41A114B7E9CA732F2C76F52E9799E71FB134098C0E078319EE86316514002E2E738302
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000D
+A8A7A312AABB0472958A1BFD1FA0FE572D7144349B5F6713427F793492C9404033587E1694BA2CF1DC4AF1CAB5FB206A
+gfp_exponent 732
+86EC88FA1E8B756F4E0BD127592986D685177D6D07942EEB611EA754C48A6F623FF84AC570202748317192B3B4BD6C45
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000150A8F241
+5D2997414F5DBF004FB106A4CDF16CA4E53FA5100DD6B2F1102ED0D8EE0C1B04983B29619674E18FB97EB27FE2612714
+gfp_exponent 733
+E87C9DC8541A875C41325EED5E3E9DC7BA6C720E718CB61F182EAEC3954EF3E10A1BB26B928DF9AA7DB5A6E88436E370
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003A
+C47E063B3DA588907C774498E8F01AD3FEECE19F1220E5C7251F6105514C0816780E8A07B19BE33159D08C7C81CF98B3
+gfp_exponent 734
+2152B497D85B37DDB0DC28C219B96ADC7338EC8A915083046CA75A837C8C1699DF3E652F317BC8AD1AF41BF31B31D4BC
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000007
+0EB15996DF085D30BBFF68FD2B1CF39BF1A233F7295A97ABEE6EDA5CD3F2818CF7BC335FD2C9B7276B52D6E97715E0FD
+gfp_exponent 735
+6C95B025B0A08989E95BBFC78524BC0EAB8F5F30553BE8B1E5E33FAA72B1ED9063C72A582049306A5A38D0E40719D91B
+B408EF95355CA552CB702E0767F2D58E058540009A57A09646D7221285B670814EC8D1B0435B67894F2CF90CB16DD940
+71D9DB1EB89D74793FE121923FCC85F8B679B7E26E9D83297625B4B8311EE22CB3BBB2E7DF9B51F5F8F56E052B9A73D8
+gfp_exponent 736
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+0000000000000000000000000000000000000000000000000000000000000000000000033602E2C4B378FBE1B1E23FA5
+E7F28D637339AEE2DD15FFC872AADDCF1C1E9059799F97602444ABF0A69F137EC3C35CBC9A1EAFE17853E5B4511775A3
+gfp_exponent 737
+12FF6DEAC6F8CA9720518455D54068146AFF6F2AA248EEE4AD2134C0F4337EA07858C2F3614808E3C8F6DC921C524847
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000D
+4E08C49AE7D059BE35A76C8AE7D1E42113D69CF7F1516F807C3B417C0ED11A466ABD523400B859D6B3601422FD2475D4
+gfp_batch_inverse 738
+1
+6A6BCE7212FB74D27A9B1835A73592EA9690FF8647E2BE98B0A947DDB7E5B526B6F145726B428A1320E1BF7F670A7260
+04E496FF223E1D7DB14244D39513754E933F48858E4429903D9A551D1F89FD60C115E3DA4ACE2835C1C34F72C13649EA
+gfp_batch_inverse 739
+2
+5E249AC501E8B0F4429D863387E7FAC07A147EB22469858E26937FD981863086A583BA8F1B873DE747FA4B412616B841
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+815BED51C19F47810FD82B90CCC1925209C9375402C062462BACE80ABA00F965FF6DF93A96CC87FDE4AE371AE7CDE6AF
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 740
+8
+32ED56EB46DB44B1D5A731D5F1B2CD1B5A65CE40D8823B06A8E130F785B805782A4142AABF051C6E8F36AA85DFFE56A7
+C2E940200239770E310310101524B0F1D954B4FE3C322917BE27C06D04A7E59DAA5D02A7566963C5AD1AE84E2A029B11
+BE31FC460D5B9403AECDE3B0B68A55A8DC33699FD9C04FF2054E10957B0F01CFB9C38C1501943815B587E715665A3B47
+8CEA85036F9E89BF1272767F8B4F8E7B4DC5FFFDA4D25DE0DB81054ACE4AAEA24CC382B030ACE298D6C8464ABA5B1D19
+51AD8498373CD0EA14D3685F1810952217C04F66346E727B8340ACFDE6083076AC14DEA135C02310CD35CA08FB0142D2
+19323B905BC3E727979A5CC9463B77ECA9B63C3E92B99BBAB7BF9E172F524200AA04BF1AD4AAC60175A38749098844D6
+5D5DCFC00A7314390EEE34B324C3A4F141DE8A24BEB8CD6DC4873AB744644458E39AA49C8CA2FA51E7AB4B10C92E9D6D
+CA37087FED1D31F5436CADF7EE4677F504554CC3B27ED7C6541DDD13C3E2329324FE8F14DA33CFCF141ADCDDB1E1C56C
+9BF5881BB9183276E486EBA962B231E4CBDC46D246EFBEEE2D2207934A3D475EE1850E742E755A655D949170AD6C2B4F
+388627A3421507F95F457C4CAF44CB265F90CE21F2E9E087881A681A80BBDFCA2ECDBB45637C5791C375E5C6068029F6
+7F93251AFF69D122D891A359740B22F3080C07E53092E346C070567AC3FC5E27396A325C81FD0B460C63A584B40A1D84
+9699D19BE5869AD55B81DD4CC24EF7881BC5CFE1A438F303FEE588678DF7CC98B1927A6C81C082F31FFE540C1D8F4C88
+638C95E006706A3B65F147113472E229F968A04160D7481725AFC545ED600CAF8A8A83D1B966BE120DD02BDA515DDC48
+8091268951B97E876F4069B2510F7FB1EE282E51BDCF7C1D4EB5594FC8F42A66B916A1607392D862F51624434C2253A5
+5A7AB2A06F56C8FAC95BB84F43A43C56BD6B64D2B83339CBD5959E0B6499699C5058AF52A45667A0B7836BBC8590E42D
+E2D1035BE7EE93F5B65F79C2E912B62FED95BA54D125C14C72EA2D7F8B9DC57C0DD7966BCC9057E3BDE8C8F69BDA48C3
+gfp_batch_inverse 741
+8
+B35C85D459504B08A53DE97BB55819110142325A6D4FB0CF0D92B185944B1EEB0695B7C42D60E5633CD133329132B4B5
+76572568886DA4E57575EFD5B03723DC908F30C0BB9090A8A7E77F2024749029FE6363E03186045C2191870E12951CAC
+457C1DEFFF39AEEB785DDE7832542FAE396F774E7E8D6C309757661D7290EB30996A6488BA987AE1FE81ECBF515CC570
+5FB8AD7F6CD3D5BC1CF3B0DD7885A69028C1AA0672AD5A25244362E83532A55D92F61DF278A006E00FB9FBEB714B054E
+5E06E4EBD2AC402210C0EF60229F36E108BC5441AB90CCFC1853FA889F74D32F7701186A55C0498A2FE01FC1BE7A09C4
+3686414C69AEFDE470DC398C469E4801802B58301E815FC5420F1AE0D4C8240E8369474141F3DA66F779A01711F0CAD4
+E64AC68A8395BBA0FEEFCBACD460732D65379468A40E3AB14AEABD1737C0328E65B070ACF80511CFC908DD11F21BB744
+E4795C91B95F39BB550C8B890C455AEEDB779D5E0B6DB9AFE0BB84D311DEDC8932EA028D2700D7235A3E0F7A50869B35
+4DE969BDD8ED6C56FA9A2FC53B4E5C0AE43A7E28CF138EC2CF3E625BFC0ACDCC28BA01BEA4FD9ED249BB7F57B18DAE89
+DE9C85518BB17BB892F39E0298C9B1664A6F5CA48083E0086D10B9CD2E780A0F84298BF7F4DF17FC439255BE0A6C5200
+3B73B9472F881D3E2791FDD948EAB46589DBFF96FBF53D284A6B6F5849F66FD50CB2F5F42156267D5B4F8821C9BED772
+91B746669DC95ECD47A771F6F56635AE9D64BCC498B5E30DC65318A0B56052859EB823DAF9488480B697BA2076AB07F9
+E191C1678190809ACD12B102C8C1056B28E566FD921501353B98CCB2DF08A213EC55B0C9429E7F189A9B3B4EE4D53045
+9EA06C813DD87CFBE27A3BA206D1D1725965F5718C22A0FD3F04DC97B4748EBC23E2E680120B00C862EF13A58ECFE25B
+6E493628CCC5103309B6A22E10A732866974B4EFFD7D5ADC3F9E1AC0BCABDA7E624FB52DDBB2B6DDB59E9815F302FA7F
+F6E2ED0F103B0FCF121E445BD9506D0055A60E71BFEB413B2B3A91A7542F94D65091C0A2C2DC75BB20817FD1B3D2B26F
+gfp_batch_inverse 742
+5
+B693163A5CBA841BA1A717EC6A283F8CD0BB59C1FC5B0388741D04A1EFC02836C9F597EF1137EDB1EC98234D9752AAF6
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+EED1AF79E95D8978FCA8020F44BA95E206C16B5E3BFFFB2874F67B1D43AB3565C6C007080C4A3BC1F64E43320E2FC854
+9A90B6566BA432551C6A7C0767DD9362A701FC0A0E46CB0A531014141AD56D706DCB2AF1353B36600D148F8D65B88011
+69A9CDBE2853D2A5DDE2E5C17950D2EFB47BB1A804E2B78C3F65D2C1582F28F34B3AF5FF843D0E61EC5C2A1814488C82
+EBB1D79BA6947207E8061773E574D50F333D37DECCFD7D12CC4D17F6DD6B6EF426933465EEBF6BE9B17596DA2454F1A1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+D2DF658EEDC1E904C07504DE1A6C048FD0BFCACABA100CE78E3224D36A0621F88266FFB89CCEDD5596E735B1425370F8
+A7F6EC2C75AD9789C8484BCD6E8BCCCE8A6CA6E2482ED210946304FA02B1FF9D8BF011E53B46DCE70A251AAB869BD49D
+CE698870085EDD4D2D2ACA1E9F4921EB1DE5E8A56B7BCFE0C7C7211BDDDF87951EDF7FF55605C32B238AAF26B287BFCF
+gfp_batch_inverse 743
+3
+A08E23DE06FF67B0BBDDDBC98D839EE28DFAB2174B045C245B61B49F65A6F6CA6DB9EB4E5D5A664CC087551D0CA8ABF6
+30235CB7506C3B8E0403E6A97BF5B96FF40C3F4DA76BE5FB57565B5B6A868CD3B730D855F0CAA82EF30E1E5FB5A686B6
+590AEF5F101F2E03A1FED9249873B9B5639F0F93B7DE72435A8E0C65FF26B9AD61B121C3F645BDEB1F22C8BA3C311C67
+85B75BDE4924345C5A405E809AC7EA7CC03080E11FF9ED7B0DE3B587DDD08DC11EC64DF75CA516BF1648BD0FB7820B02
+B44E1BE606D3544E645779C0474A54420A8591D3C32B68B8F225C89038A21125B5BF73899B61B502B7205B08FB2BFBC6
+7C04EA772FF29EEC5AD13F81A73DFB23AF660B58AB6BFC5BB18D420F81DAA9979F634BC6A106E10272990142FB52E298
+gfp_batch_inverse 744
+8
+629239F5E66DA98C5E56DB38E40790C3F50E025031A1D7CDED1CDD1EF752CEF8AD5D255EA9D18E167B9AB6D66BEB2CBF
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+52DBA3CCAE0B55C981837660349F5DE3634229CF3009354DF1AA534591C128B276ADAAF04F2485F64F1CEC2B97F492FE
+D4A2EC910EDA5683C097AA01137344370F3A9754C5701B582E89497C576559948B9BE1605EC7D70996BA9A4A6E2310FA
+EF780E0223584A57942399A338A3B1349F809F40C8AD3D9B19F1F205E7083CD7331253F3DA013FC2569EAD6F724B8C0B
+2AF442190EF42C9DEBA1664A58227D0AE8C02A58E50A704B98222C43C0BF569992C69C4D3C478E95AD8B78D6584033B6
+802D3C1235A54720F68FA6D2F32552F0D9F6788F0526ABD4033B614EE50ABD2720D1A19E80017F4C1F4AD9504B8AB617
+4EB9445D0FB22F74F50C211138BFE2DB648793AEDF819170A7F48EDEEE9C97A4A98CFCE1A50B987AC29E2D163B477BBD
+F7B45E7081AB22EE6DBFEA943848103E6EA789A53843B1CF2A579A782D927AD555DC9E0E7B942CA142FFD006765AF380
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+07B42E22A8F214125512CBAA09E83E9F6F3EA8220A64F3124055CB627B35314C401410D0C39EDCDD277A2264F0AA2BAE
+98D33DB8EB451A9EE36B709F2A81B04EA0CF01EB43EDEA7AF1D47F68F45EC9B23C32369C3512591ECD8454344901F92F
+7F0457D5505DFCAE3BAA3D6880F9E0278B100723C1A92ACF2E42422CA0C1010D0A5E976110C51FC3479A6F8BD7F1CD53
+E2892CAE4EE1371775C9547FE9331105DB838EE0A91F7602B966CC07495CB04B570EF3B5C108200CC782C7CB77E00979
+56746585C10EB6F40AEDCE87FDE84175714C40A7E4B9F1ABAF5010BA52DC5D117C6CBE9B26F10E5566CA685A459F8AD8
+2B8463F30800B282BDA4C9389D52CF41816A0A3059C6F23A1433A69C9D348E61D9CFB8DAAE9AFEC06BED468B03DCEC33
+gfp_batch_inverse 745
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 746
+4
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+82FC1287A8CCE559382535144FA3CBDE2B305AC519BD56A31CD53E1AF5BD2E8C00BEE71199B91A75A316F390DE7C03E7
+D91EE7B974D1F5005CA1FBBCA445EC0FA6F63BABBE5064C977341DBBFEE3DE85D3D8F966C65D890E07DCE663BD0E3393
+AC16F3D05100405A9002CBFED78C19BE83A3D5DD25FD19703F276AA4621B9E09DDDD7023D9F10CE21A9C39B4F9DA71D9
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+D97350FB3A1F2D923D5F73A7707EED32FD5BA43088E8846A7A8B010372E01D0783C1117D5EA88DE7FBF1BFEC44A85E77
+86EE5083E5E0B17D7BB91D9868F383303195C1D339FD7E8CD036440B9BDA2D513754BBFFA6F8985B49D4A16EBC6EC344
+57DC039068340E868CE9A04175F7D418C2CF3D3B9913CC302191F3C3CB94CB1476DA07169BE111B4B1A3D074F4EBA2EF
+gfp_batch_inverse 747
+7
+0C6FB2F29E9EA14A014FDB12802AB9D9D280C44388DD31B8A08EDFF60D0C76EC94E74D7DB841080912D951E28ADF7CD7
+A5723A2FFA944580EFA024530D4C0EB01DEEE20B0BEC84A954C2ADDC14E60EDE5738ABCBB522AB87C12F24031B5AB13D
+43E967FF99645453963B946237B2C9CDBD8AF3469AFB899064BC2F940E5597848C665BFCAF28ED00EECD599C2979336B
+2BC1953D0DEDB1433D4A976600866AB0B86E4E90B7AFB757FC2D43628A696738EE764B2CAD3C9EAFFD87E0ADBD0D864E
+7F4EDC76864A8BE6E43CEE3634AB92BDE94BCF6406BC6CE98D612A17C37ECF7116054F9F73B5A0B630F41D053CAEDAB0
+40542C91D702D66416EB30F003B856C3F0E7ECEA06ACDB951766652F4886B968063412051515B7B76FA455B553201A77
+9FB863300483A38AFC0F7412E20E108812395C6ABD537A7F622724BE3EFC036262E9D7D4B74074AB8F19610F50D22423
+00C6F6F0155C283C260D61CBB72E4BB1D04AEC2220B24C6B68C1740E15BDCB21796A5DF28D023E276AA757B48B27086C
+006D60D85997F4318B669867CE3B5DD515A6643E96C2A5C125B1531457EBF0C9DB53C518DBAC91ABD0188CB706A5AFDA
+0682995A51AF07DED873AFD0EE0CA4AAB93637EC1C007C24045E9023385BB516A64CCB730EDB0B1A5B65699B235EB484
+E712AB672CE585704DCB532FC0D115401143351479D09E53FA077CB1170D4B45BEB099C5A85917E6AD552F6174C51D2F
+C6628EEA72B51B1F320D0DD32EF22B15F30C1D2C6997A16132ABE0E9FD411FB22FF59E191C358DC1B72DAFED65F9D51D
+A8E91236F32ED22795C03273F62AFCB7656BBCB3A2A0A1E894A475828F5AD0561C001F6007CBC901EB10E2C3D1BDED2E
+03B52CFC57B6770039A0C0B6CCF0AED3C708B4A6DAE4755FAEBC268980DBCB988A1D8BEB6ABFA030A5EF5922D853B967
+gfp_batch_inverse 748
+8
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+5415E4FADB63CE490C64EF8FD1F6CE3FFA234AAC3311CA44CE8DB97F9F9BA7A83E5737D1A8696C8210BF73AE28FE57B9
+4D901472F015DDAB597B75C384776FEC36E91A73020FADC9E8EB896796A359FDF51A720C78B99B14316EC4361316459D
+58D9107D173C1358B1438797F3D7E74C5C5AE2AFDFB11508BC9F530AEFF920E66B0A5F777EB18C72B449DF3355271B01
+216D9C8396BCA34CAEC6A59DCE741A814CF5F1FA2F518133D86C2CC95C1CD5D4AF4A41A454DE8FF41B3AA895FFF3B836
+13DF8142B8298E81E996B7E326D075933727314F952766A258325F0983563A93745FD46C7ECF017D279ED8BF75599684
+07AACEE6C45F628D60203B77CD395CA9D7707A621918E89389A2FCD5F51AA875284BBB9E0543F3557D2C70FA43288ACB
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+9EC175E5BCB9EB43A0750E64FB004A9F7681D4B82E553DBDF85AA809181FFE4C04042402CC1570434C1118362D5B58C1
+2F78E53F7250085FF5B0132B57F7BF711E80264AF86AC1494567042C2BA92C7005A5836072E68561EC76035402471296
+9215E63E885B07064EA97C4AD93DC3024B2AE30D5A878739A9F1D7700AFC90835D67A6DDBEB64484D397E8EF0F03B144
+DD9FA67A6D53383AC3CA005DB83163570289948887DBA934159594603034FC3E7DB684E62377E465612AE5CC6DB47259
+4870739CD8D18A672ABE61E16DF5B65670492EFAD1B1DD037D82916C6D21A594BBA8AE1DACF43B32E09D37595B25CCBF
+BBE1E4720C4F8D65B84763031F36BDE704467323E86A6AD940FA7C751D9A30C6956C2DDAD407ED3EC3263740702F6518
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 749
+6
+9657F4D35154B8344B4CF5FBF59273C091114E67C5FF288603D22A8E08FEAF9B69F3855D753CD2B836D2CFD2C4A5D610
+A147D40AB35ED8747EA7F8E0102FE6120BB41C98B5BB6995F89B60A6F62D222616CCDF0925C8864DAFE42E43A0219AE2
+881F1F8C7923F926B589524CAE91866CE8752ECEEE8AB2905EE6BB4595C37FA58A3CCB356F9B841B7ECD5B2BAD0BEAB9
+86EC0620C612914421FCDF9AC1B9E996B48C58958E457090BAC086A9C6ABD55D4D855D11A365AC595B115EFAF7DE2376
+09C331396929A5AEF1BC7E9EBA241098869396ECA7120D9E25601D0532BAE047E16D4DE776FFA079C0E471907FD5F0BF
+E4435AC4E2C6AC36066B6A43270E46CCC52002F8A5C0A7EE2847F421A5CCC4C8E72B999CB4A0798DEDCEF27F10FB60C4
+B0677781EF4AED97E46969F578C3C46349063DCE9F348D48CE8D0DC91ADB710437FC25203D22971BD53AE50116D92B71
+3E332EE7CA85160703515C2ADE103EB5FA547FA6FAA76388DC7D208C70F4FE9A10EB927830419165C58FF5B06C605E0B
+6DC1D65CEDAE1342E042770AEFC469D09A96375BC177CEE14F4016AB7E6ACB573C09215E95C30D18A74E896AD8B53225
+41AEC695D46860F42E07062EBCC56BF4908858D8B5ED35115BB65A4DAF00572BD15166AE979E6E1672544F7A27D9B6FA
+A93847F470C9FBE71A8655546874F6C240C27DCD26C09D31A09027444213FEB4B6FDACB21BC5BB9BB46C6C32A020BC95
+142BD6EDFFF0E31EAC2D3B2B09D7DC5C0B26B5B8A54F289B3633A8C2E9126B757B5EB9BD617D47E16E7043F4B351D5EA
 exit
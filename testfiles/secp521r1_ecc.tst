@@ -5282,4 +5282,8 @@ eccp_jacobian_point_equals 704
 000001514767C3A3CFD7D5ACB68893510694061E127120F71BBFFB60F5E5DDCECD2B561EF565610B08E337BE8A9EFD9BE9E369E08450CA7F4245B868FEAB88FB951262F2
 0
 0
+eccp_multi_scalar_multiply 1
+3
+eccp_multi_scalar_multiply 2
+200
 exit
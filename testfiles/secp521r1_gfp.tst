@@ -1973,4 +1973,814 @@ gfp_mont_parameters_order_n 546
 000000000000000000000000000000000000000000000000000000000000000002D73CBC3E206834CA4019FF5B847B2D17E2251B23BB31DC28A2482470B763CDFB800000
 0000019A5B5A3AFE8C44383D2D8E03D1492D0D455BCC6D61A8E567BCCFF3D142B7756E3A4FB35B72D34027055D4DD6D30791D9DC18354A564374A6421163115A61C64CA7
 C62EA4F2E4CE0ADF19220182DE0E06035EF8E920BE81A64310875C3817DFCC6FFF2162C664EEEF4E4BC5472A3AB0C1FD1D69D11F1FE1BD0533FEEF451D2F5CCD79A995C7
+gfp_mont_square 547
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_mont_square 548
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000800000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000800000
+gfp_mont_square 549
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7FFFFF
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000800000
+gfp_mont_square 550
+00000172C0A3F9ED0FCCD62AA4E8B7503764A6BF863F8D6E506008D2162AC9A872E9163B34F64613431B63B8765B30ADFB3F35A7B679E454441390EB84F1336776ADABF3
+000000DA4E5A1A0B7BD8FD9296AF238C2DDCA3AF8DC62B307E8D2C364F121EEF9DF439D70C9A0ACE42EB6CEE31F989820271A02218516178912E23D03FB5BA3BE11EF79E
+gfp_mont_square 551
+00000177DF2A0C50441F7E933F0A28AD1BD9EB36789D2AE1B5FEC674BEE0435EAFB43BD438BA24A5C1DA84A6A9ACC2A7DC6BB9ED10AEFD8B4B97CA4EEFA28A9D0976BF48
+000000DA3A11925064C5ED9ECC6409194E7CC5288532AD7AC3FE4310F1C702921E26ABFFF984E7595EBC174E60FCEE8A9E5E22235F8118F57512BDFA4122590B58A9EF5A
+gfp_mont_square 552
+000001BD323F57A834CE37873BD40036F18A4FB464A94A35FDF55E4133A09B70FCD5FEF06A46F2D5091A3214051330018A459505F60B4D4C571CAC1A06A6273FB4C63E59
+0000000AE9C294B1B76EEE898DD23FDC407A8FF6F18C9545392AA9775C2CBFB8D15354127F9440815201606801969E7D7A2CA27B7C37576D075337CA0E7301C6D580C7E8
+gfp_mont_square 553
+0000019B297CE07396418D415807CB8ACA403E5725BD13F0B075943B77D7531D609E5771A6E48CB74FD327D3B1C996C0663329F1B31F45C217670759F1020A7704D33B4B
+0000016D18A06CCB57548C7DA3270534E859E4848F7DEE9A8F4EDBB1C397FA593270ED9E2E93593817DC0A6A2CAC6F1949F366336376F2596590B5C2E9CF75F65B631F4F
+gfp_mont_square 554
+000000DDDB54BCBD0F962BBC90FA1EC4896CBD075E0DBB13DC46AEE5F17F2A950508CC58552E7F80F5CAFEA9B314BCA0236F8C773BF52FA56FC57700D708E03DAFC9011D
+000001F56D6422646F33E37247AB0BD5741F7B5D3B710115CF0068573D671642FC6F21D5A43BD6BE82B46047BB46C7BC846CD150272A79014A0F9FD269B46577373E98A7
+gfp_mont_square 555
+000001146CD63DD8DCADE37284572BD540E32D880A4D50D909286C7B5122209A13C5BBFE08798EE4AED790BB9D72569D2D19316DC61FAA95FFDF6879396584C887282FE5
+0000017ED4BBD24F65F73BC57F7D409913E7C53BD2854D0029C9D640E8B65F627342012F360758DBAD62E1E4C1CEB165D967166648412E42CA3E242DBD94168EA0FB78D9
+gfp_mont_square 556
+000001F78A5164344472ED08A7113FCDF9B2345160F804AD8B6EBBF725DDAD8B3426D65EEA41C812162B5D865BBF263578E9F13C0BC7DD37183B7DC36AC7E941C9BA840C
+0000003F207ABA20059AE1BE1F36949AA594F7471CBC1974DE3FC524030DA0C8BA96A187E73CA8D2CD0CCCC7CD6D0767B5695262715BB740BAAAEA5ACFEB324579E747C3
+gfp_mont_square 557
+00000056C85296DB84519E15F9DE96B4CB6D3415A84997637B579D218D42B86376B9035170BF034CDAF0DA7D2A1BAE523510E4F383DA56CB8469DC4CF9E3ADF1D0333DA3
+000001DB5A91B3D4F6EC97584943330797D4B6107F7822A241E7F15DF9349A1228BCDABAD6ECB98C5D86C127D3EE54EC69B921EEA26C9E920EE81C2891B6D6CAA1C93CB4
+gfp_mont_square 558
+000000BEB07F7BBAA8DB819001A5F67DE8303C0C54B66F5DA35D7616C64548FF53729C723C58F012F4CDD24B35A8DF6808CF66EB6C8D9A83182EBEAAD8DCD446CE74D5C5
+000001A8153B87BCA0B2CE20185367987812C051F8AC2D267FFCF56EA0572BE7F3DEA9FC82BBFF270CAAD077638241A726ED223BD4463998A46219D3BC2851E427625202
+gfp_mont_square 559
+0000004B3AD1517E60E06A7826BE8C40F71C4E61DB2836EBA88C6E86142A384210418A72E138E6B5B59DC6FA1046766AD226659B30AD774689E1035130BBBC95F4158A1B
+0000007EE14F22DF6CE5C0742109B657B225CB6EE44713A5191ECB86935819A185E915DC6EDB6C88F83CF67FF8E8B48DD0249410890394C1411571BD55E5BD0135E6D26E
+gfp_mont_square 560
+000000E3B57BBDB193310973A34BD230C7728C030E5400C294EA67735E15F2478DB4934DC09F1572AC8BD20084C5ABBA20C04E682A86DF6789FBFBFCEF7F94C22BD643DE
+000000D052BCBCAF8D6FC6D413695A7CD5EC7A16A7B6B131D0D4971F8B888CD888A400952B1D8C8D7363E61AD0F1590931315F2F08C267EBF6C9308BD6815BE65C73A797
+gfp_mont_square 561
+0000002DE6649CE6F62729876F2E000440042A9D0757850C905FC107073AA6A1877AAD5F618C933A299E04DDA7E839973182E7EFB0C7672711698BF6EA79EEA28E647B09
+0000013AD30AC92D642DDE96FD3ABFDE9F16EA8BD21413573D502194E50D3B286EF8A2EE63A2DA7F0FE1ED128743BB6AF58A88BE938377418C29DB5EA0F27415E3B7EE68
+gfp_mont_square 562
+000001730831BFAA1D6B176284221D32AAB67F0B5A4A092022E31F4D539F431E67D56645A103599A8E45B11FAEAC88BE8DF27633F5663EF0F3664C64F123B2F1685F2AF0
+00000019FC85CE1EC919E450594DD68EBFA00ECF80FC0B29AA5F48EF34E679FCF9D63D57FCF7C021889F8DA6106E0F514144E1329FAAC765EEBB2A11EF10B5EC3CD1E768
+gfp_mont_square 563
+000001B35F595C991B5578803FEA9C4E5F9F7ACA28663240C19B42138891D5228E668D16F51934F3A87AD08DF5F14897268EA842CAF605CE2BF24179480195D97F58C6F2
+0000001EA808BB69758F01FD8B75628809001CA9C86F8C1C3A7A8422A1A50A0841E6296CA4EF5015EFB9FD15B13B48ACF816B8DF15D18D890EAF35277A432A8376C881E2
+gfp_mont_square 564
+00000054BFE3B41E81F9C63CE1498DEEC99CD41ED71D3708D68E8CAE285AA4B5F643553FF302D9EA7DD94476C71E7281FF91DEEDB95ABCE0A0D610EEA062CFD3C207A534
+000000E5D236FB749B5594BF14E463EEEB114F2A80D9F522807F9931CA4D57964BCF9AE4E93BF2BD6F217152A781135BCFD56FAE7AA1F8325038FB2F591F8CBDF53E3704
+gfp_mont_square 565
+00000102A507D13769542AA503FEBFA9CFF3373496B8A6148F92EE0950C3BDB1D77C2DEB06DEDC66056E0D079840D828617A6DF34319B6DDC0411D92C513B8DD8A3699C2
+0000012E7A634BF395BC7022FB59D8CE3641D6260FC74B47BA655E0ABBDE55B7C69494BDF066CF55B201E95BB0DD6A652236189E93CA7F5BDBDD2E2A82D734133B1B48E7
+gfp_mont_square 566
+000001C390E8D1531E2580C3FE8CC971629CEFA6FF6028F508BC39F0F53D34B3E355DAA838FA52C78DAC88400690BA631C69388551BA96A4132D89DB09538B3D1733ECA0
+0000013DE9BA0CE70C1F3C7CDFD9E35FF957C1C6FF0DDDE495CF29E8D7FCE5DDAC90C77159DE8B58A9F37C7D955F23BB33A7CBA3C2A429BE561B8011B3541A12950E8B6F
+gfp_mont_square 567
+000000DF2F48F7FFD1774A171EE6B20DDA36AE8DFF6C3DC87C3C16BFA432A7EF72DC31048F9D9EA14A7B52F7D800BAD7BA92219592CC39B4088FC0EF5678C11CD105A960
+000000A31CBEB98CA8B9E00B82F3EBDA5B361B9F48C08255EBDDE7564ECF12FFE1BA2F2873DB28061AC84ECF1C5A42C78989C2B27015DAB963B684A7AE41ADA3B9867CAA
+gfp_mont_square 568
+000000489961DA867DE3FC6131279AB3193570045B0FA7F8B10A9121624ED259D47C6EFE2F391F1B6EBD062072A9B9478DDF03FFCCE7989C33F00B5C5D6E62F4E647E0F3
+000000B78C4294051F1B785DB3CF4D212F35D6E0E2B09E043700E88F3F6F2D702327A2B0304C17F8B26459FE7F4AC2F1CEC72FF079B0A6CEA57F62D01C977D6C4CF02508
+gfp_mont_square 569
+000000567BFF6723FE6671644A16AF80C66E4D16F092131E0BAC4322EA5177C028E8A1CFC51BD75B3304565146F7F617E0E2F4B0FD7C913D8C553F7B7CB53C64ECF3CD61
+000000802EE330646770FBDA60DAAF040AE1BDE2F58663DCFCBDDCC434C39ED737C8F868BF790626147E60CD07535F91F9C791429E9EBADA06CE7BF9B4B523EF0FA649BB
+gfp_mont_square 570
+0000019AEC45494D54319C687B2E6949E59D200784EF9CBB09C46AC678C8E290C2B72035BBC3961ABEC5E533642589FFB20362FD5F7BBB0A3D00C1049FD1F78AFFA26370
+0000011F6D1CA4C97E3F73034CD8932ADCB5063C3C3E68DE359865BBC308D1C2CD3E91477F5B9BE4CDFB6FF4961F63B40694BBBB5AAAAD06DD6730EAF9B8665A1FA5CF8A
+gfp_mont_square 571
+0000000D48469F285946BE2DD220688A6BB32C189B9EB4F908B6D61DB4CDD4A7A62B65F11799F11DADF822A35008194D694AEF694FC39BB39E8CB868D52A44201A591B39
+000001CE5B62E44E61324D27DCD417D9C7749BDD98D7F586BFB7B994263AA3CB9AE5CC9C67BBB87E8547703328D941E5F9EFC89F0634BCCE4DAAA142A36D9C2B2C280F8A
+gfp_mont_square 572
+00000114F4CD5A87F730A32A08B1193FB7488530E9B2C52D223AB038049CA59809648FE7AC408B13F6307983DFCE5F92F8F6DCE0C610AD7E52FFCDAC4B39AD2B0BF41B39
+000001BD813F03261D4A24E268474913DF110122AAC857189E72DF943A9F4671A259EDA326AE5C1FFC33681677E9D97DB3B38443A050D0C85F457F4EFCE41E087B19022E
+gfp_mont_square 573
+0000014F4401D48F17C40F90884A57E9D5D9B50C30FBFDDC0D1AD54E6E369483F50573C1D8403B5DE6AFE9CDE531A85E304B79728672BBF232511B2058463C96EC823C7F
+000000CA0B0DD425BB041AB6CAC2103F72CE012E690C7EFC81441209F280C2AC6A012676AB7EE62A0A5380A9219D6CDAD75BA6D7926A743A8FCF32B6170239706112A214
+gfp_mont_square 574
+0000015760E6E770A1CD7A5132EB50A66E2C61FE434838D32FC037DA72ECDB3FB01BCEFB4B3A6934522DB8475F4AE06D16AFA5123005208C79C804B05F3961365B6C744B
+000001F75D0C9C96BBCA33E529E30942E3826C6681FB7581C57F5311DAA2DAFB67DC210506AB118A54F00A517EAE678F6BBE7C57A68DF1792EB0A9F62F56C61957C558FC
+gfp_mont_square 575
+0000014CF018961DA3C54EF86F889F21AB6782E2CDD21E4C61BDF96F8647A6A5FB57E251F74366B5FFBEA63DCE03D8D8FCE85EE5BF6652111F5B2487D26A88E87CF359E5
+000000205132F27726BB76593634D5026F9ADFBBC923CC96B23CD025F0BAFAC60FE09B4FD4734304B89F08A7C3FCDFE61DFE4FE6097B2B00DC89C920BA2C334185AD609A
+gfp_mont_square 576
+000001BB6A665A6C506EE1AC325B7B2A855CE2A7CFDE21C1496900D2B59328DCDCEA34887EF577DF5FDA708E032CC8171BA16DF5173C1DD4BD4D89B92D56287DCD84CADB
+000000D991E41A9B42BBDB0ED2509B585EAE72F17ABCF9F6F018CA1E514CCFCC6A0EC25ADCBBDDD4F68E0ABD1EFAF1AB920DF1E4C2D604E7BD1FB65B8B6E93D0002EE2D3
+gfp_mont_square 577
+000001A03E5986519C2527BF1E709C91865530F348C3AC6B08970709503BD2B85CDC52A513409D61B2251FCC431A1F88D8B2919DE358B1A271FF9CEB006703690236B6BD
+0000007DE6D3BAEC8D8BD37EDCFD635E1566D625221C819578B2FE100DD4098EC21F54A90BA5547AC4EEA26EDAC52765CA0FD30B2046BE1E275E5CEECCD810442DEAC337
+gfp_mont_square 578
+0000001CDE68F2FF9A3E695C5D48F065CE3C525549AE68F652F02746C902ED0DEF63E8B4C5442209FF90BAD5A8B57959C78015C8E57DE0F28C2BB12088466C50C834B370
+00000064F466828FA7C0DCDB84AE94B7029364B57477ABA22A1487C85A081FD2EDF1ECF432AA4C33F29D1342BCE7E26AC398D3F5FC7260B2911738F46E3233BCE48FD6C5
+gfp_mont_square 579
+00000181111671D598FF80F22357BE3DE4427FB6025FD935A9971D43A60E834E139C2E807365A1FAFC5A570202D83C00718AE76093843C28AF752A5275F8374C6FF9F3EA
+000001CD4F873B9FC77A93896FA01B2E242B8A4C94F396B1CF42C59F7ECB449EFC01EE1D64BCE4FA4486D173A4DA3A8F24CAAA96C91D63D29AB7E77A20FB9D84CD2D012A
+gfp_mont_square 580
+000000838D60424B8339A62570DE6E6E0A035618D9E84245A1AF076731DFEC969799D20EC2D821E82F15BC781B801827D978F16E8A43E91041566B4A9D437D069AD6F43A
+000000DD17E7B68FF213707E63BB68AD0000D2B16F79A8EA74D86B47C155C22CE5C0C57AE68856718849DB36B2BB63757684C56665EBFBE2A1CC568CBD291B35529BD4FC
+gfp_mont_square 581
+00000070092771AEA7ACEE11E8F2D9B289E42CBC28D144A1B360F6B1564CE8BBF905A957E88C809ABA59C8271331D8CB1F700BCB33879FB6F8445968165F24E40078389D
+00000173666FD87A8C4C3F91E2140CDF2D817D07C5DFDC2DA12BDF93EBF5B8EBB51A9613862346C973B7C9B9A6D506227834BF9157663298C9B9A1B2412CD997D5311D4C
+gfp_mont_square 582
+000000B266F878384F6778A947190574C3A107DD1292802FBB402C8819597F83CC3213EDDBB1E0002977938067D9CE4D8A490FB44B4B5B23D284BB4FF8DE448B08EAC281
+0000013BB4F4B83AC4813EC19427FD6ADBFFB9E39BC9A50786A3CF1F7261F7AB72B4B664DA35F923198B95B86F9C0B186F95FD1DC97452F831608386B6B2D41A00EA29D5
+gfp_mont_square 583
+0000000C2BB925C8D33634099BEC5F6BDB87FDA66A5415D307E963BCB09A65F852C1833FA6B3E8F60A7E209D3C7848D6DE3A9520EEA75E4406E6F248F342BA71C70D1577
+000000B8795A73D0BFFFE0ECF0CC167139BF4DF2F1BEAF4827068E285CE258FB08917849E67EB1824D05523527888B284D1D3CD5C87402C9E91F650D5938677FD77B164F
+gfp_mont_square 584
+000000589409CC352D1E682ECCF1CDD51308D503E46CA56EDA79942859E538E3D56D474DFFFC108C9410481929949996BC560BE967FA3DBB658B3894648FBD3577B2305D
+000000F422E0296778BB3C8A739F47B63776A144A802988B52304D4A54BFFCE8D3F4A065B86F77C290A0E3875007784634CDCE110F285546199304C0EBD071BBD593195E
+gfp_mont_square 585
+0000014AD9C3918FD42461D1CD7EDC6998390F6C08A4B4B7FF95943E80CDD3BC9392B03F1AAE42796AFBA009BE432990673E59CAC31614A26737F7526B33F25D02840137
+0000011ABF8CC68D33DDD467BD8C2EF928DD50F5FD0EAB37B51A48E6556BD344F828870F152FAB2E6782BAA60DCD128CD6DBCA00AC2B3BEAE89FBEC6A19A45C3B84C9821
+gfp_mont_square 586
+000000DD6390E2F0D577674F49464E826F90189A206EDB2E159D6CC4659FFC91C20EECB59C32AFFD9F3EEAEAEC793B47C3E71F3759B0F4603DEF9DD2903C3A2BEC7404B4
+00000001D7DADC17A2DBD604C2F8BE687FB0EE365E1924619A595CF43236C3612407643D9AE87D54E04E5804A55768557CECAC28EE095ABBDE53E5EBDBF2D28D23C95B4D
+gfp_multiply 587
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+00000081EEDD3787EF34BBCA362BA7C0B37624441795D2109EC5B1272A7E5E12C841310CFC815AA0EF6B57701634C3CC50122A13C21E8FA69CE8815C21E51108A439E552
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_multiply 588
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000001D4ACFA72D54982741C9BE0FD5543796067672D879B07B37F1E162C769A82D8C1924796A2F14188715E35CD654D9EBFEFA0C01288B6523AABC668D90AA1D7874408
+000001D4ACFA72D54982741C9BE0FD5543796067672D879B07B37F1E162C769A82D8C1924796A2F14188715E35CD654D9EBFEFA0C01288B6523AABC668D90AA1D7874408
+gfp_multiply 589
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000001DAA0A52B2DF32CE83C6838893BE8961D66C17B052E54D37A3D46A4565FF8C42F8DEE8C9BB36FED5666E312DFFB7A862CEF0498119036F729082CC43AB052646E87
+000001B5414A565BE659D078D0711277D12C3ACD82F60A5CA9A6F47A8D48ACBFF1885F1BDD193766DFDAACCDC625BFF6F50C59DE093023206DEE521059887560A4C8DD0F
+gfp_multiply 590
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE
+000000DFB4108C78B45E50B035242EF1C9F11A64486A88D5B0D3D81E8F5240E64C7C5262824923D8DCDC3F5882B886D5C108D4BE105D1701F99231987E62C170698C4923
+000001204BEF73874BA1AF4FCADBD10E360EE59BB795772A4F2C27E170ADBF19B383AD9D7DB6DC272323C0A77D47792A3EF72B41EFA2E8FE066DCE67819D3E8F9673B6DC
+gfp_multiply 591
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFD
+0000005808B6F794671295339AD492FFA1D735A163721F64DB9FBFF04C520178FB8930DBD0DFF051584F878FBF969BFCBD09713EE3E1AE853FCC5A7F5C1E1F6236907E45
+0000014FEE9210D731DAD598CA56DA00BC5194BD391BC13648C0801F675BFD0E08ED9E485E401F5D4F60F0E080D2C80685ED1D82383CA2F580674B0147C3C13B92DF0375
+gfp_multiply 592
+000000FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF
+0000004AB29B35197A638E1D02B08FB308C7AC49F9335775BBA7BA7CE3FF1BC104AD1028F4579F329F4C1D39463355089F94A80839E3854CD8070044124D54D1003B13D5
+000000DAA6B2657342CE38F17EA7B8267B9C29DB03665445222C22C18E00721F7DA977EB85D43066B059F1635CE6557BB035ABFBE30E3D5993FC7FDDF6D955977FE27615
+gfp_multiply 593
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000400000
+000001AD826188EAD32BD235D3A1A0E7E3855179FA80137481EF1C071DE559F14EFD5A78B25B9D012348816EE890F8559A0A2DFCC8161BE5561DC2B21243A0D2AD0BBB3B
+000000623AB4CAF48D74E86839F8E1545E7EA004DD207BC701C779567C53BF569E2C96E74048D2205BBA243E1566828B7F320586F9558770AC8490E834AB42EECEF5B04C
+gfp_multiply 594
+0000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000006609F9D6DD3FF7CE03B6048259990E3052D3C0A74A8BAF4FFF84E591E57F8288ED0B0C4895B6A893B72D58C1EE14DDE0B7EDA5697D5A6219A1F48743D5FCC920CE
+0000003304FCEB6E9FFBE701DB02412CCC87182969E053A545D7A7FFC272C8F2BFC144768586244ADB5449DB96AC60F70A6EF05BF6D2B4BEAD310CD0FA43A1EAFE649067
+gfp_multiply 595
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF
+000000F386EF8378528571389ACC664D09CA2AA8B2DFF7A7F9BF5BD6A888D4CC1A82D1C3E21D9F3D50E7B0E1E4A8765D3C6CC868E4414EE71553C650D58C4282CEAC6F1F
+00000087AD7A8EC7653399B2F635D5574D2008580640A42957772B33E57D2E3C1DE260C2AF184F1E1B5789A2C39337971BBEB118EAAC39AF2A73BD7D315390E0863C883E
+gfp_multiply 596
+0000000000000000000000000000000000000000000000000000000000000000000000100000000000000000000000000000000000000000000000000000000000000000
+000000ADD570DD7DA00390157A3C4725E54902A9C8CA32874EB13E88974DFF0EA9759216CD621A60DBA384C09437B0EB417386F03645BDD6A1C756F2D219969F0987A19D
+0000016CD621A60DBA384C09437B0EB417386F03645BDD6A1C756F2D219969F0987A19D56EAB86EBED001C80ABD1E2392F2A48154E4651943A7589F444BA6FF8754BAC90
+gfp_multiply 597
+000000717BC3A3034205E550C16CA0E317620383E90669DF4FEEC135CBD6504B9A92DFA958EF78A0EB82C4F1A16D65C4FCE1B259F70E39E6F94A4DFD754C4BC31155DCC0
+0000004CBB3835092C1D71A8B3B52C42A1AA036EE3E63AE19C17A48E49FF9BB6A4B1CC59FE177771E0F39E520FAE84924547E7651F2C66DC14FA46C55107595EF3018E40
+00000185B607678004CD7204ACCFA60019153CB38CD8224C898E3B6844DDBF7D77CD254432569F6AFA8949A8D8F614D1EC8FE04479EFF362665D3364764DE7BD06915A60
+gfp_multiply 598
+000000CB29CF50740C009FDDF2AB6E3F21F4DEA74C9942FE11AF27103D047879EC8B43822612F9B510F836F1C725B20C9A8768A2E47F10467A12860EEDA16B2FA3D307FC
+000000ADD570DD7DA00390157A3C4725E54902A9C8CA32874EB13E88974DFF0EA9759216CD621A60DBA384C09437B0EB417386F03645BDD6A1C756F2D219969F0987A19D
+0000003C1DDA7B28F3376281D6C127F8DB321FFDC56FC83A2D72A4C1EB56FC201FF71FE06B6355B75E6CCDB41E0F59171E0D788CF2148A91ECCF5F0135E457713B52CE87
+gfp_multiply 599
+00000010349AE3A218C56EFAC055BBBE285330653ED198E9863CEBEF04BE34224328705489DAD801F5944F0FB6897EDA8C110E419EE4509CAE421DF494F0C9ADCA5A6E31
+000001DAA0A52B2DF32CE83C6838893BE8961D66C17B052E54D37A3D46A4565FF8C42F8DEE8C9BB36FED5666E312DFFB7A862CEF0498119036F729082CC43AB052646E87
+0000005480EA54A715F329BD8BE08EAFC134F050F868DA10824A832933C36A3CEA1EDE26F90B2226FE442F8DC904EDC8B348BD5D3371CF86C3441985EA60C49F4AA315A4
+gfp_multiply 600
+0000004CBB3835092C1D71A8B3B52C42A1AA036EE3E63AE19C17A48E49FF9BB6A4B1CC59FE177771E0F39E520FAE84924547E7651F2C66DC14FA46C55107595EF3018E40
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFD
+00000166898F95EDA7C51CAE9895A77ABCABF92238338A3CC7D0B6E36C00C892B69C674C03D1111C3E18C35BE0A2F6DB75703135C1A73247D60B72755DF14D4219FCE37F
+gfp_multiply 601
+0000010127E14AFF8D6710A7E16B31FDB944D47700AA4578B19A61885D4350878F59675414D09501B82CCA76B58C1F17E0E4206C2147494EF3DE70F26A3ACE5DA7B9D5AB
+000000CB29CF50740C009FDDF2AB6E3F21F4DEA74C9942FE11AF27103D047879EC8B43822612F9B510F836F1C725B20C9A8768A2E47F10467A12860EEDA16B2FA3D307FC
+00000075042251A6EC55836696EC475D57B1E1136D842CAECBD710904554155D0FE4D23D7F8F00B48D1888BA81EA8CDCC268624E2ADF1B97BBFD7DF3D23B37B8099BB44E
+gfp_multiply 602
+00000113642DC72483CC5736418DD631E3C0A00DDFF1C6CA29D58AE02B04527A603F852A115B6B4781F1A4267BF3FDD24C517DEDD826608B370DE6ED2779BDF86973A73E
+000001AA2C2DD56BD8F6403C56132E1261242E10B2860229EFE751E9AEFE694DEBD5B306DE9B7ED9B4DA712ABB508A6EFF16A36373CA7E3CD3535381E2AE25C52F6265E2
+000001749F7BBDA97A7AC6E4AA231E078EB60012ECCC8F1E8A073B73799848C6C2651F27271246FDC2A79288ADC276C6D8152E4E8A4234C077BC3FE07610BD8A5878DCF9
+gfp_multiply 603
+000001EB4DD2C99504DD27B6AD1C476FE06C431D475259A6072E60EBFAFF16A96C4F61950FDA0CAA6305B03B2B96664D54137809668F0A56DC9191374D88373FAEA0C5E6
+0000005808B6F794671295339AD492FFA1D735A163721F64DB9FBFF04C520178FB8930DBD0DFF051584F878FBF969BFCBD09713EE3E1AE853FCC5A7F5C1E1F6236907E45
+000000472708523CFD659AFBB166A20D37385703EF3647252C0375742A7EFDB7575F9C5AC1CBBCEF37495B34DB2CEA3EBEFF9D8455A4ADA64EF75EBD3973AB0F5A76C72C
+gfp_multiply 604
+00000110B7F26D90E9388E6F7A093FCF023476818DB3D5A93B34E5E83B658BD203EFB5B5D2CA2F479BFDD7A0D93D1E6B1DAFF6D6281BCA3B15F848FC270B1920CA1A5205
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000216FE4DB21D2711CDEF4127F9E0468ED031B67AB527669CBD076CB17A407DF6B6BA5945E8F37FBAF41B27A3CD63B5FEDAC503794762BF091F84E1632419434A40B
+gfp_multiply 605
+000001AA2C2DD56BD8F6403C56132E1261242E10B2860229EFE751E9AEFE694DEBD5B306DE9B7ED9B4DA712ABB508A6EFF16A36373CA7E3CD3535381E2AE25C52F6265E2
+0000000000000000000000000000000000000000000000000000000000000000000000100000000000000000000000000000000000000000000000000000000000000000
+0000006DE9B7ED9B4DA712ABB508A6EFF16A36373CA7E3CD3535381E2AE25C52F6265E2D51616EAB5EC7B201E2B0997093092170859430114F7F3A8F4D77F34A6F5EAD98
+gfp_multiply 606
+0000017999A036A769D54FCFE5AC6E61D4F36F94A597DD1BEE32A3084E1E30495B565CC2E9679CD3E7303DD89E86F7957993AC511B6EFFD8301DC70E9654825487C337EB
+000001EB4DD2C99504DD27B6AD1C476FE06C431D475259A6072E60EBFAFF16A96C4F61950FDA0CAA6305B03B2B96664D54137809668F0A56DC9191374D88373FAEA0C5E6
+000001B5F2CB29175095CBF8848633435587B0340C628D2127C6BE5684A3F03B5E5D9A07BB6A0F991DE7F70ABFE66A205A816A2E2A3DFE70F7B06DDB60CE94C0A15B5BCB
+gfp_multiply 607
+000000ADD570DD7DA00390157A3C4725E54902A9C8CA32874EB13E88974DFF0EA9759216CD621A60DBA384C09437B0EB417386F03645BDD6A1C756F2D219969F0987A19D
+000001AD826188EAD32BD235D3A1A0E7E3855179FA80137481EF1C071DE559F14EFD5A78B25B9D012348816EE890F8559A0A2DFCC8161BE5561DC2B21243A0D2AD0BBB3B
+000000C60163649F955F416B3E6741DB9B97B9DC2B5A0B656488FB43CA03BB3D816654CA16C50CD7D6559AD363136E4ACA9EA1AFE9F61B7224BD8F4E08A7B176C711BCAB
+gfp_multiply 608
+000000F386EF8378528571389ACC664D09CA2AA8B2DFF7A7F9BF5BD6A888D4CC1A82D1C3E21D9F3D50E7B0E1E4A8765D3C6CC868E4414EE71553C650D58C4282CEAC6F1F
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_multiply 609
+0000006609F9D6DD3FF7CE03B6048259990E3052D3C0A74A8BAF4FFF84E591E57F8288ED0B0C4895B6A893B72D58C1EE14DDE0B7EDA5697D5A6219A1F48743D5FCC920CE
+0000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000003304FCEB6E9FFBE701DB02412CCC87182969E053A545D7A7FFC272C8F2BFC144768586244ADB5449DB96AC60F70A6EF05BF6D2B4BEAD310CD0FA43A1EAFE649067
+gfp_multiply 610
+000001AD826188EAD32BD235D3A1A0E7E3855179FA80137481EF1C071DE559F14EFD5A78B25B9D012348816EE890F8559A0A2DFCC8161BE5561DC2B21243A0D2AD0BBB3B
+0000010127E14AFF8D6710A7E16B31FDB944D47700AA4578B19A61885D4350878F59675414D09501B82CCA76B58C1F17E0E4206C2147494EF3DE70F26A3ACE5DA7B9D5AB
+000000DE49B627256EF14915BE70E04C5D9B65670F8767B2913B84932ABEC5F837D0A8E8B33E77D0B4D910B815DC9D1A617D3F72B7C6A9A75496E76348C96A23BB39BFC1
+gfp_multiply 611
+0000004AB29B35197A638E1D02B08FB308C7AC49F9335775BBA7BA7CE3FF1BC104AD1028F4579F329F4C1D39463355089F94A80839E3854CD8070044124D54D1003B13D5
+000000F386EF8378528571389ACC664D09CA2AA8B2DFF7A7F9BF5BD6A888D4CC1A82D1C3E21D9F3D50E7B0E1E4A8765D3C6CC868E4414EE71553C650D58C4282CEAC6F1F
+000000F8C2C8C69461C3BD99203C2162CEF70BB88AD0F4ED73661E1B99CA13138413FBC3B8B5913BF5EEB67846FD2938CC83835FF71BB64B046B4B2E7F15C7653CF20EFF
+gfp_multiply 612
+0000005808B6F794671295339AD492FFA1D735A163721F64DB9FBFF04C520178FB8930DBD0DFF051584F878FBF969BFCBD09713EE3E1AE853FCC5A7F5C1E1F6236907E45
+000001D4ACFA72D54982741C9BE0FD5543796067672D879B07B37F1E162C769A82D8C1924796A2F14188715E35CD654D9EBFEFA0C01288B6523AABC668D90AA1D7874408
+0000001D0F4607FABE20765BF4A5679D466A3C1325CFD346E0ED63F3FCC06A28FAD380DD008E389EFDBB7C57E7D5ECAC865908E1524A407E9F34D6408FEA3BB99F95B8CD
+gfp_multiply 613
+000000DFB4108C78B45E50B035242EF1C9F11A64486A88D5B0D3D81E8F5240E64C7C5262824923D8DCDC3F5882B886D5C108D4BE105D1701F99231987E62C170698C4923
+000000FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF
+0000009025F7B9C3A5D0D7A7E56DE8871B0772CDDBCABB95279613F0B856DF8CD9C1D6CEBEDB6E139191E053BEA3BC951F7B95A0F7D1747F0336E733C0CE9F47CB39DB6E
+gfp_multiply 614
+000001DAA0A52B2DF32CE83C6838893BE8961D66C17B052E54D37A3D46A4565FF8C42F8DEE8C9BB36FED5666E312DFFB7A862CEF0498119036F729082CC43AB052646E87
+00000010349AE3A218C56EFAC055BBBE285330653ED198E9863CEBEF04BE34224328705489DAD801F5944F0FB6897EDA8C110E419EE4509CAE421DF494F0C9ADCA5A6E31
+0000005480EA54A715F329BD8BE08EAFC134F050F868DA10824A832933C36A3CEA1EDE26F90B2226FE442F8DC904EDC8B348BD5D3371CF86C3441985EA60C49F4AA315A4
+gfp_multiply 615
+000001D4ACFA72D54982741C9BE0FD5543796067672D879B07B37F1E162C769A82D8C1924796A2F14188715E35CD654D9EBFEFA0C01288B6523AABC668D90AA1D7874408
+0000017999A036A769D54FCFE5AC6E61D4F36F94A597DD1BEE32A3084E1E30495B565CC2E9679CD3E7303DD89E86F7957993AC511B6EFFD8301DC70E9654825487C337EB
+000000A835835E9C6A387A99073362711E78D1D67B7F0005BA9477D38506A32C1AA6EC34F76D12D78FA9FAF45885780A4EB5FCE2E57C1A2A43EB35C29E757A27727943E1
+gfp_multiply 616
+00000081EEDD3787EF34BBCA362BA7C0B37624441795D2109EC5B1272A7E5E12C841310CFC815AA0EF6B57701634C3CC50122A13C21E8FA69CE8815C21E51108A439E552
+000000DFB4108C78B45E50B035242EF1C9F11A64486A88D5B0D3D81E8F5240E64C7C5262824923D8DCDC3F5882B886D5C108D4BE105D1701F99231987E62C170698C4923
+000001A894BD707CBE6B8A63D742F63AB9B5E04C728C9D1E3B956EE21A184FE410F3320100DC828706703F56E733411085AC956C3B292C7F6E3EEE4A19ECA63566AD7832
+gfp_multiply 617
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_square 618
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_square 619
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_square 620
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+gfp_square 621
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_square 622
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFD
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+gfp_square 623
+000000FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF
+0000008000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_square 624
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000400000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000000000
+gfp_square 625
+0000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000008000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_square 626
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000
+gfp_square 627
+0000000000000000000000000000000000000000000000000000000000000000000000100000000000000000000000000000000000000000000000000000000000000000
+0000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_square 628
+000000717BC3A3034205E550C16CA0E317620383E90669DF4FEEC135CBD6504B9A92DFA958EF78A0EB82C4F1A16D65C4FCE1B259F70E39E6F94A4DFD754C4BC31155DCC0
+00000168988FD0DC4B5DCAF6EF52A39AAD2F7D0F0B4A45A484A89E06F2082C5DBCB66CFF287DF7FB3E79E10546BC8DB65463120189B026AAF5669E7B9D3CD5B4E65FD3E4
+gfp_square 629
+000000CB29CF50740C009FDDF2AB6E3F21F4DEA74C9942FE11AF27103D047879EC8B43822612F9B510F836F1C725B20C9A8768A2E47F10467A12860EEDA16B2FA3D307FC
+00000045EBEA67D74BAD96D47E545405F7774A66BCC4CB76AF6BBBDBD687F80150AB777DCEFA6683DDC97E8010642761527591B424282BF7220B59D0CB4F01F5EDEA0F3E
+gfp_square 630
+00000010349AE3A218C56EFAC055BBBE285330653ED198E9863CEBEF04BE34224328705489DAD801F5944F0FB6897EDA8C110E419EE4509CAE421DF494F0C9ADCA5A6E31
+000000B86EAAF002B103B10827329C573E5FB440FF1FF7662434AB1363C8017FD1066F80954EFE45E77DB7C57D9B0D1C682F44FF8CD535D99360D3D3DC7352250C1E10AF
+gfp_square 631
+0000004CBB3835092C1D71A8B3B52C42A1AA036EE3E63AE19C17A48E49FF9BB6A4B1CC59FE177771E0F39E520FAE84924547E7651F2C66DC14FA46C55107595EF3018E40
+0000007394ED37D4210B47AAF686459AD3B515B8F9D3E7DF07E404716491F7A81B37CCE0AABA89D76A8B17D21B7773523B74AEF103F3D2794D7ED4E6C47E80402C8CFC6C
+gfp_square 632
+0000010127E14AFF8D6710A7E16B31FDB944D47700AA4578B19A61885D4350878F59675414D09501B82CCA76B58C1F17E0E4206C2147494EF3DE70F26A3ACE5DA7B9D5AB
+000001EF4244C042AB051C1689A8CB3AED55B8EF99C3932A8BFDACC15A5E979E6D9E111D218FBEAE23BF5EFC993FCE15DEDD9E4975CB017803C946F7427920065C8057B7
+gfp_square 633
+00000113642DC72483CC5736418DD631E3C0A00DDFF1C6CA29D58AE02B04527A603F852A115B6B4781F1A4267BF3FDD24C517DEDD826608B370DE6ED2779BDF86973A73E
+000000D77CFE47BA7BA7740C740B3C9988374E474D809E65B04567DC196749DA53789D5BBA86958C833BB6BF69DD4CBEE6AFA8989A4EBDD845C5106F4644BF543F7B7D15
+gfp_square 634
+000001EB4DD2C99504DD27B6AD1C476FE06C431D475259A6072E60EBFAFF16A96C4F61950FDA0CAA6305B03B2B96664D54137809668F0A56DC9191374D88373FAEA0C5E6
+0000012DDE8C4EF2BBA36FAAD6DDDE50740EBD1DC41F07AB7214B1080F6F64CDDF0FEFB88E34ABC61880357911EEEF745FC12BD0CB34B78E303A0D62CB38874AE680F6EF
+gfp_square 635
+00000110B7F26D90E9388E6F7A093FCF023476818DB3D5A93B34E5E83B658BD203EFB5B5D2CA2F479BFDD7A0D93D1E6B1DAFF6D6281BCA3B15F848FC270B1920CA1A5205
+000000ADD405D717AC6567CFF39EE0C63F34537167C24EB797DC7E717B7B96922EC44337248903DB0866DC63AEC740DDCEBA2244674E99DCD06C4CB46B6D39C56A40788C
+gfp_square 636
+000001AA2C2DD56BD8F6403C56132E1261242E10B2860229EFE751E9AEFE694DEBD5B306DE9B7ED9B4DA712ABB508A6EFF16A36373CA7E3CD3535381E2AE25C52F6265E2
+0000017CEB745B27649BA0798CFB294150AEF5907727D59ADF976C44CDBF4B729C5058DC969DD623E55421826114375C7163C007CA87C46949DC335E06545D113F5E4D2F
+gfp_square 637
+0000017999A036A769D54FCFE5AC6E61D4F36F94A597DD1BEE32A3084E1E30495B565CC2E9679CD3E7303DD89E86F7957993AC511B6EFFD8301DC70E9654825487C337EB
+0000010001D7B1B964588CCD5EEFB57565F4FD72CF68DE97E8E4577CB9D3CF7AA9202884C65A4C09F70E4E4914791AEEB71A65A249E47346AB5E24C6AB2E12C1FC9AD45B
+gfp_square 638
+000000ADD570DD7DA00390157A3C4725E54902A9C8CA32874EB13E88974DFF0EA9759216CD621A60DBA384C09437B0EB417386F03645BDD6A1C756F2D219969F0987A19D
+00000060D9DAB4214EE54B26518C0605C1BF2539367D85D2CDD6072C80AF0B1AE9847DCCDC1BA0883B96585D4084EC3793B98C15F44E074079C2E2FEE36CD39F503E7E10
+gfp_square 639
+000000F386EF8378528571389ACC664D09CA2AA8B2DFF7A7F9BF5BD6A888D4CC1A82D1C3E21D9F3D50E7B0E1E4A8765D3C6CC868E4414EE71553C650D58C4282CEAC6F1F
+0000012C918B03C2457EF00E6809B2744250CF762FAEBB9F9A314C32DE7DB6052113A1ABA56BF901E41EDE6D049C8E4E746F0A91B077D9264FA71C6423963B3FBF94621F
+gfp_square 640
+0000006609F9D6DD3FF7CE03B6048259990E3052D3C0A74A8BAF4FFF84E591E57F8288ED0B0C4895B6A893B72D58C1EE14DDE0B7EDA5697D5A6219A1F48743D5FCC920CE
+0000009C8394150E548C61854DCFBE446158CCDE9C0B7BA65FC5F2C934A8EE9B50C3C0091E3A7DB5FB3366333497F98092A971CC4A7D96B3CDEB2234B12D55F14DE188BB
+gfp_square 641
+000001AD826188EAD32BD235D3A1A0E7E3855179FA80137481EF1C071DE559F14EFD5A78B25B9D012348816EE890F8559A0A2DFCC8161BE5561DC2B21243A0D2AD0BBB3B
+000001C481B34FEA334BB324FDDDBDBC8E1F999EE6F398758A81FA692A1950C01D24BD812C74B9CD990A6B28E70D4AB503CFA778AFDCDD8A5D86D5F9171E4D0BB3DA15D9
+gfp_square 642
+0000004AB29B35197A638E1D02B08FB308C7AC49F9335775BBA7BA7CE3FF1BC104AD1028F4579F329F4C1D39463355089F94A80839E3854CD8070044124D54D1003B13D5
+0000019981F03D487E0AEB5BF8F99AB977986E9397A8AB6C8386136309654B09BCBD0E3AD73E27EC4CF2F9701C1438095144B4072E373D9ECC33AC744EB09592436C4F86
+gfp_square 643
+0000005808B6F794671295339AD492FFA1D735A163721F64DB9FBFF04C520178FB8930DBD0DFF051584F878FBF969BFCBD09713EE3E1AE853FCC5A7F5C1E1F6236907E45
+000001C9375F33BDD85F25537A176E699A664A008BC083D04E7628E58077EE6E7B1A2E742887B0BB4BE8A3119848B167C36EF7DB7FD7CFE66BA011F5D0452E791A2D6475
+gfp_square 644
+000000DFB4108C78B45E50B035242EF1C9F11A64486A88D5B0D3D81E8F5240E64C7C5262824923D8DCDC3F5882B886D5C108D4BE105D1701F99231987E62C170698C4923
+0000003C770A0CACBD4840ED6C827EADF65B61F4E0B9D5528F8FF6278919D162482F8BA270AE2E09A5C1EBF924994B32684F51C26C84FE1047EBA0D542C89A8800761D43
+gfp_square 645
+000001DAA0A52B2DF32CE83C6838893BE8961D66C17B052E54D37A3D46A4565FF8C42F8DEE8C9BB36FED5666E312DFFB7A862CEF0498119036F729082CC43AB052646E87
+0000017B2F40CBB1D17D4DEC5EF7ABBB6D4D84F8601E0FE2452F2EEF551DB534EEB76925B7A25296586FCF8708121B751C27486ED26A51D9AA4381716EEA912BA0BB1027
+gfp_square 646
+000001D4ACFA72D54982741C9BE0FD5543796067672D879B07B37F1E162C769A82D8C1924796A2F14188715E35CD654D9EBFEFA0C01288B6523AABC668D90AA1D7874408
+000001BC49478AAFEB876C6F88A085FB459E29117E5564371EC5D7F5B727D17A902B573AFD2101D43FE64F105A52BE5F447F473715C758EDEFAC4F83D28A43F0DF7B2FD0
+gfp_square 647
+00000081EEDD3787EF34BBCA362BA7C0B37624441795D2109EC5B1272A7E5E12C841310CFC815AA0EF6B57701634C3CC50122A13C21E8FA69CE8815C21E51108A439E552
+000000D77360A654E518610C70D15C05628A4931746E4C95F1F55DE1E51ADE117205352466F794CCFA41414143524112572588BBFF5CAC1BDEF4B1A52993250503D01A9E
+gfp_inverse 648
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_inverse 649
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+0000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_inverse 650
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE
+gfp_inverse 651
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFD
+000000FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF
+gfp_inverse 652
+000001B9F9A236A2FD3471DD8B160265CB64783732D4B50AB47B1F606632856B1EFE4B687A6CC8321204463A43EA673D7AE860188D23A50EADAC8AC920A4CE63F831C152
+0000017E2AAAE121BD6A5805FC7BD74A74385395F1D51DEECCEAD4BB7D2BE670DEC09488BEEFBD608A7FBC34D4910E78917580379732F5FEB7704FEAD49E781DE2CB2A56
+gfp_inverse 653
+000001C4FB30A9F78E45338F73F49AEA45F71D76E25229CAB05089AA8B7804524B56C574588D444AC67B06E28AB608A3CD31356B415AEC7054B4B604701B35782B816295
+00000161ECA3896257793BD996D3BE1E341066FECABCEFDB264AD7A59FC0B4C2B367F63E66EE9666F5657ED6061E60795100C7780DDEAA81FE1E58C57B0596A0B038A73B
+gfp_inverse 654
+000001128E92A4AB7ECC02BBD146C3E6E0FF29FB86E6CFA800D779DFF89C57B39F3DF48BFC3AA618A95AB6223FEA43FFBF32C1A28020CD7A0BB5A359C4FE21C4B7E63C14
+000001B340B3832CEC88122C6F6E7738E577E364772276682FA54FF3D512131FA53357D7871F0510884F8BE3EEFBB591562548F09DC5EFE4FF3F8F70878B03A59FF12ABF
+gfp_inverse 655
+0000009ABA37452345CC49060EE70945472F3173276D7B1930CE4B034DDCF64392126D5935B8E888DBEAB8A00390F61C521E9C8709124B61D81FB7442B96BF0F41393FE9
+0000011EA3B2AA9A3A64F6F4F9BE4F642924DDD24A100DFC1FBC43CF9E5BDDF2DC2535356CDD982F30CC585F766698C490522CF06CC89F05DBA425588AE23FC1B0D4F31B
+gfp_inverse 656
+0000005E93B9990F5B773645D3E7AC9EE000123FD0AD9D101711155B00B34AD6982FB16A2BEC1B96BA78CFACB51B560037B736905FCDBD86E1CE02EEFB8365F4B3D634E1
+0000008A2CEEF43D36A865793913E528D6FD7B140293C8BFC973C0432BB335A4217D088AF1C46D685A3A4980889E05E5C945D6C555A8A04F1E943A6262AF5084E709659B
+gfp_inverse 657
+000001F11670FC3DBBC4006EA7EDEDF41F74F1C95BF134B89F4E2B598C077FAFE3CFB76E6262992A79C5FC8F3884471DA3A6AA6AECA1E72A7A3D8E5E2EEB3DBB598CE6EA
+000001A0129CF2E133B44EE3EE606DA4D5C3D1F749F50D03E037744F72E2D088F09FB313DDF90D1070B43B9ECBDEDFD4EDA0E4B8C9A21FE1E423A795073EF520EB3EC774
+gfp_inverse 658
+00000149A99977557B81C02E0E701C3FF8E25351FBE541EAA35E6DA738085A2B44ED88C970683CB59BE4BDE6342BF55D9E74922EE40A1BF395A4CC690DF0245B6E10144F
+0000015D2F12AED5B25F30164C9548743DEFAE20BBCD51826A619539E34654126E7964E7FC2C427BFEC17F77C8FCA9412C7FB20FA50FCDEACA5DEB0E1FCD0EF254996F8B
+gfp_inverse 659
+00000187FE3FB494182FB7AA5EF59AA0BFBD9B4D6D1435EBC9452B3F4CFB19395C70D29DF860E5BEA3F2EAE54400A05B8566111D40995B9C86F55955D6437DA680F40D30
+000000CCF6BB13AA502CAF6FA0E23DB15E90B45BFCD0F751BE6E80A8A152825DBDFB65CCC8D26931699C1815B40413FCBD42FEA490D836CDA527367A6DC8D3AC6DD01A2D
+gfp_inverse 660
+000000280EB3AD7F81FA003EFB4F8482A9CB64CAD141CEEB5179B50D810C78E6A6554AF60F9F7620471298DAF000272029964169A4853DC9E56963936A08DFF78B8A0A6A
+0000002257DACE039CD870935D151470D4CC20D77BB3E5CB02BDEBA2B5A95B31B2B987F70E7C976B72EA203EC3D706CE50CD7A1EFF0CDA46788A4A2786148CFE077A81B5
+gfp_inverse 661
+000000B14F298A02B704E1F24413F0DD10343B99004E81D05A055AC1435F410AAFA59C492D33B00A1730BC56889AF50D6E38E944704877C70F8E59B01C9EAFBBAA3A418B
+000001B61C9742082A95BFC743558B306D48413E337D6A1710597841F7C344EEBAA40064648F32312D3FC5B3220A99A2D11A13E61B390EF15E0616048E528417CD5CFF09
+gfp_inverse 662
+000001C941CEDD73BA111310726470067EDD83ABCD3F0E3B486E3F361D664CB0BDA29AC413F065D7B7A28CE6D5341CEDDA4ABABCB42D764C97DC8ECE674B9CAC636AFB62
+000000970D7018B436C428B33C0FB0E89A7ACC50A8C1EA61D0085289041F8614610B8F2032991F61343BABA30D604B5582A4CBC238608B3C87F81C927DC9853FC8D060B7
+gfp_inverse 663
+0000014DA41EF5D64B6D8709C8A6461F383A8C862742D88D61739860DF4AFB3F8ABE804583EF13DFC66F17530D068623EBDD1EF603DA85C4C4567C443D8CDF8C4F66724B
+0000016E809033D0418A79267AD5DA65787FBE128D0177A052A829F57DE5442097204F68F9246E69E404C58C61D32C525C3E53D5C4A6ED608AB380EBF75A5DAA9AD701DA
+gfp_inverse 664
+00000023366FDCF57D20FB8641DB4F94660D49B307EC495B1E63FFF68F01EA2C22A3B124F600C3A0CB306C4E43770A2B1B79B1DB03230CEFE6AB4BC6BEAC7C58DD2406B2
+000001452B15C60993202E32C61C8364C2889EB6BAFD3B1BB16CB36F6D69A8414E81802EDE9141AE9774F5EF9BC2658B6DAF6719C22E4E1F8A7E7FBC279DE0FBDB91EA15
+gfp_inverse 665
+000001CC6B7C18E1E473C14953C8AF1B984D751937B1525ECB0D9AF206156053DAC01B5C194CB772275D5176228A673BE3E5C63E2CECCEFEC39725634691DC46BA7319E3
+000001F2A5A02DFE90EE9860002A1488A926D5A5367BCEC33165147011EDFAE3696E465CE3E5EE0C4A4305D263D22A048F5FA6F428F265256CB2C56B06350E25B19181A2
+gfp_inverse 666
+000001563895CB681CEC1F9C882C703A2D661DDFCCF616F6316136D7743CF8EC9D5976E4F6D1F99852A8E243738B02EE7CE0AB6F92B57AA89CAAE43F79B413BAB1C72A6C
+000000A0925A6895C743C27002C7C5565766B1F48FDF2225D54355A21EECC5542D3BBC2FA4BA314E2E2A1AEDA245D16DEABC011B8A4AE8DED67B485FCD377CEE6B5B6DBD
+gfp_inverse 667
+0000012331507579DAC1CCC6989A8AFAD68C27B597A2D7A446511B1AA5C54932C51612D1905FBD117736F2B65A0077759667EAD0390C83EE6421BA3323A7CFF5D275459B
+000001599ECD3188B8AFC704BF724FB7F0A46A1FFA2992D391C8B097CD8704229FC75E97D658275ABDB7361B983CEE843BE2C4AA72AF20C1191F801395010B1AA7CDA864
+gfp_inverse 668
+000000BA50A4DDA7E724EBD408C7C90BA4E888BAEB128E8B1E96A578BFA88E5A93B76EA3FB9A6C6965848D673E79A025682937AA06EEF98CBCB2814439CF6D61E9A356CE
+0000017FB1C3D49B9BCECE49F0B768C1CB1070D3DE6655AB6F2DFC0BCFFE6829860DFCC70D1AC998E1798DC8AE477D29FB05A37B7FC051E4E755A9B032EC59642CEDDC17
+gfp_inverse 669
+0000001DE7ACCDE09568C8F55F5A4427966D7818B6739109864617B55C5292DA4DA70EB0606E40F06FA0E16CE8DA1356FF6C486B40CB53E5A5269F4F7FBDA64DCDBFBD12
+00000099AE166931A01221A1BCEF944CF6C9E49D5B56F1A26A18D50C7DB87CDDD82D80888A79C13937EED8CC0947B8D5862E429026303D93B794BCF29D55A2CEB917615F
+gfp_inverse 670
+000001265DCF08012910F46E937A09CBE39281DB75FD344E1AA30DCC3D970BD078E2DF72AA1F233E96E345BE4A339A3D4E0ECB182E05A0BD96CA7F4FA3A3DABF69475B19
+000000D49D91FB6F80A8E6940031F3C83BB1D7F8F0A284514F9DC4F3E28D67A6999FB1D61BD2ABA08180D132B77F617BD9B31FE9A8B048BD7F390337C59D00AFD2B49C68
+gfp_inverse 671
+000000219B748C151BC60A57E292C8BFDBBD33BC030BA1B17C40D2B3FFE214046ECF504D7422991212517A8953E0680FCCF6FCF577FA8F63F66AC897AD5A55406DBBABFB
+00000034393509BAA711F76005171E9E73CA2BFFB3BCE1C2BC397C3437423DC95161FA836CB3D2DDEC3789A228C032B7766D768F043F18683C3E92E916EF692DAC888F47
+gfp_inverse 672
+000001D2291C29A35CC94C96FF87AD5559EE80E186F6603483DF6A8DD3610DEBF9FE6DBCBB68ADE0D48E617806A36271A3C589940F0DC13AA348395E6F1C4E6F7B276EC9
+0000011C41C746142DCF2024BD47269D12D19ACAA3A7C0A128E4CE88E20E275C12CAC50272A40034BBAF595C1FDAA2E49A6425894886D59382E0E0F45EF3AFFB547600A0
+gfp_inverse 673
+0000008089573702BC3BF9199CCE47B33B9F4CBEA69AA181D104AA9B58C4F8D0079C792D1D6B9DEC997E67E0962F2A4367F7D8AB12136A77880E4C8C7AE39FA02DFEF2DF
+00000155A62EF9F6449323FB00880BBA91700402A3DA5ECCD16D7150D8A409FD33D287495D6371AE8FCAF83D1540ED3AF2363E4124579759B70D29F9029BD35914A549A8
+gfp_inverse 674
+0000013D00C0F431F1F8FD73B5E53F995C694BD662DE1268C8116EBBD4F7B5E243A2F6FBEC4EB58ACFBDE1BEE0078525F860A0B0859F31829BC1FDB8EC478683D45CC661
+0000003CEADDC00DC92263034710366C42856595CD54DB0B70F410275EA955722209BA05F8695986FB96C5E3D9C1E708CDCF4232DC6998FFE785A9F611DC0CB6182AC6DB
+gfp_inverse 675
+000001A40B7168CFC65A285701ABAACE3460C0B6CD9D019E8AD7E67004047E2809AB11E35A494F9AC9033BE5D91041787E7025DE2CCD77AD4CC479D06B0A3D105813FD3D
+000000E9DD376BC7ED6C36A89B336F50FC3C1557733123FC19E1C6C74496AACC4FB643FF67AF72F8F610DAF089779B3C7901D7CA4B4E3139C2DFE7FB77BCF83A37A703F3
+gfp_inverse 676
+0000003824D8EF8BFF191F705FCF495834A9A3A533CCAE5378703B43E05352ECEF5BC5B0539DB1B17BC6169B6A5AAE3C8FE5A0681A53AFFEA504E6FC79B368CC07C7958C
+00000134C22C33C27DA0866C0419A918B77AC1AAF320DDF8528447340666906D797F0ADEDC383219B87768E087AA707B842FE315AFAA8A8611A7ADA7D1A072EA8230A4B5
+gfp_inverse 677
+000001C6C173EDAFB19E3B425ED1DABE266C236D5E9FF10F79A13AEC5B5BD156386C9C326AEB42D944F9F7A9F9FE4E1BDE0B297239083153EF1EA9450CB51544362C8C57
+00000184242E1E346A137BCECC49CBE4984B3EBB007A0E1870C318B9E7B1EE60539B5BD2E02D3DD56B3D8EB7C17E46A59A64EAA537AE24F183BF83340FF6255D1D79BB17
+gfp_sqrt 678
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 679
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_sqrt 680
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+gfp_sqrt 681
+0000019E4223B8AA5E49422A3D37664251BCD77A1751F5798E4DC3A3578A60D82CB8D14C173910E33E7C6567314197758C3BA85923BC91526D6B987A73309B95C25E1151
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 682
+00000060354D41373FFFDA6817590636B04301611ED6B677EDFB3A30AD10357AFF744A2142ED1687B350535454CD1CA1294E9A5EF74DC29EEAEF7CEE9AFD3CB526EB04A7
+1
+0000001FC08A58D756947A7A452E704D607A473235C2E229862FE231BEEF67FB69F446126201A9D369AC0F03DEE0A843BFE98F8C0524137FE322E96D33BF915791D277F3
+gfp_sqrt 683
+0000019F1D1FF3BC48BE3E961374A4DA9AA0E17D62FC49C1DA5669C57D61BB78FA68E51E503A79413A920D2C7801E464605D674C6650114F2B639975D935D048340ACC07
+1
+000001CB45619FC017B4834C37495C5ED93FF716DCE47B21CA51E152A12F3A94877B55CB80DE8B3EAFCF0E77203943F65C327A6DF7BA38B69304106E470B4FAD7F867D60
+gfp_sqrt 684
+0000014BB374FAB6B8C3A4D2D34D1C0DF10586671BE03DF0AE9C78BDF8CD9EC385B9C09A26EDF1BD27855798394AFBE91BEA705EC879B6633F9B6BB272EE6A2EF8E4CB5E
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 685
+00000128BB570CE4B94D9ADA8B9116822BE6DAB35B86EA96ED8D92558B788160C96FD149A99AF2D45A869D1B67D8DEDA9AEB14D14EE38139A8EFF762526353AAC59F8CC1
+1
+0000016EA53FDDC9099F9C9FEB7FE26B91C3098C3B8A27BA202AB6FAC844B8FD0059865A0A1FB43BC6E0673A8D2F29E715C2C81A75134107E5174EBDC3C9F7E3D8B4C832
+gfp_sqrt 686
+0000003C33777F49F5CE4B0E3DADBB83B891F38DF0CF76E4A47BB75D1C5BB0E249465B6D4CDFFD99D52A941A47DD12218404A2FDF072D57A36B949CE4D373215741B349B
+1
+0000012AF18BDE0E86417B604CE3B0CC1202952F197536B11CB4BA55C38B48A2B2D643A26FFB726AA2E3F93A873B99034075916EA060846C20C26F71F662222E4DC4AC8D
+gfp_sqrt 687
+0000016F568A8C29B221713908BA9BD97E318AD63A0EA6E15EC69BE3ECD7570B6CA06496AAD7C7C03A53C17641DB898E14C2732A6B86290BA5ACD341ACA99FD0E2856EC8
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 688
+000000C74AEDA0433743A4B3B69D08B9F35C116543DDB8071E4FD6C6A4E02294C726CDB1B77BE68B207D69B3E2489CB16FF3210EB0BF3F9FA4ECFB329C620BD13526D406
+1
+0000009F334E51AFF848A9567EE5E85734893498114340FF813FB5CDD85BBB6BBD37929D4AC7CCC3CC0C668201BA985A32B558FD6577BB54AEBCB0AA5CC0FF066BA99D02
+gfp_sqrt 689
+00000177EFB2CB323007AD5110AC48B678BA1C6F6313F173E533CF81B8A94FFAFBDEFFE526373DD36BF14A0A24D427030A96FAFB4BB328B7DCB7331C15683CBF182286BD
+1
+000001CA2FF3C23C9C2F67237EEA6FE19FA40DD6F3B17AF01BE7F3CF4B80B828E3AB6283C2AE35D243D87A9738B079E17711B7573B16494331A59C4AD1EBD086C40F360A
+gfp_sqrt 690
+00000048989BC9DCF95FE8A0060C88043683D4BC0DEA6E4E64B9CB1CEC032E6B25795C189844F476F2E2054D0E71597AAA50B96FE90FB6516AC26AE07C2C6A87392BC554
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 691
+0000003DE2CB7B789380A854596919F1EF7C58FF2F4DED692D250BBA09DE21EE5AF52BF1E283E965DD6E094ADB12B4B2B6E277FF1487D0BDCD43C6CE7CA0712270FA49DE
+1
+00000054EE7D0AE2145103C7FF5E1D1F1CFB0A06BB93C8EB506F68ACE2328994B647E8A8E5EE4C91731BBC4164B0BB142F217E720F650638B5B94AF30D456BE06A56AAC4
+gfp_sqrt 692
+000000A6E084D5858A882FDADCCACD7FBCE4F260017C38A400A67E8E7A402154DB88741D9C6780AEC50967A6ADEE6738506A78FFAFF9379E43EF28621BCEB1FB96D025F1
+1
+000000A9FC27D6835FB6D625D6D106FB60ED33A0B9B253E3AA1813454FD3E758082A2F4D77B5ABCBBF0E11E086592243EF95EEE8A70828A72F7DBA0830D0A2B8544940E2
+gfp_sqrt 693
+000000C235185376C2410AD1F6DA7A638FA624F71FAB5884E29AACEAF49C9EBA6B911F9759F9BB7914ACE1CB47A164E41407AB3300BC22CB1BE4A5DB2B54AF7771436E1F
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 694
+0000002C299D680D017FC0AC1C261A111999A464E3ED374E3D93F55B821AFD1DB308C2443519B9CDDF11578CDCDAB05235C9462179F2220035E2AA9228046BFB54A940C9
+1
+000000627243D47CEB64C5C48AA1A59C5F6A35D9321A6EC17934F0B8B48BB0750C9C20EF167774EF6EB4FFF8CDCEC408D26F1D764F06E95AD252A617C4CBA0385B4C0D74
+gfp_sqrt 695
+000000E3136FE57D4B23F212BD511C501DADC3DDE225BD28D67ABD9B531A109BA904E8EC27FADCF0F8F8E28F16640F02C9B8427C4E892519B8CAA2E49865438C3D51A5EA
+1
+000000ED08EC379A602533DC0A68013D679F2D9EC4445AAEA01AC23ACFD3BB743F7DC86B692A4F0EA1B49BF707C0909C797B1538E5A15B79BCC0FD985D3F69CE52C4641C
+gfp_sqrt 696
+000000789B75036226BC9858C5D6D5E9B12E1DE2D2A0169D4DA60990BD0D8CFEEE59B397CD751E08023A80A22ED51B127F1D490EED97EC7621F91A997E544D56D096BFD8
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 697
+000001829C9C021EF95202F2CAC07DCDBC9FEF06B092F32AC8910283A292F9982C612771E2989AF693B336BDB24883E405CF2454C0B98539B7EBE11083DF318981594FE6
+1
+000000216862BF793F4F8B9D28F1A81BC0BD1D8464457EA432830689830AE19E143A51809880E88BC841721EC8A948145CA2C13275F5C1A051CDF2F9DC7A615D53EAB032
+gfp_sqrt 698
+000001124AF83841288C16357213E8C5ADBE652F5F39C2FD321F55320218342FF575C0C81983BE945A86D0A7D1CBADFF1A8FE242ED6984C64352036DE94089EE12771E76
+1
+0000006A15866FFB9FE5E39943CFEADF1279688CFCE205CD1AEFCA62E22B64A66D32A901FAF20AC0292322D35364E64D8B6BFEAE8D76D7A17B50079E08AB4AE4A648A58D
+gfp_sqrt 699
+0000017E3C2496EBAC9261F1E429C87C9ECC7B5F75FF199D6AB6114F2207C6C03BF449FD2C564D56726C2C95F8DCA309B5B39023FD09E37C7F9C13216BCA9B3F18AF266E
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 700
+0000013982B75491A557F210B83850F65049290AC36C450E4BC04CE5EDE34074F6757C2D12CE1AC22F3FD4236CDB4936CE07AD51A82951F3D5689470AC04C9F9B17316E6
+1
+00000085BCF1FCB54109D8D65F7B07B84485C04F911F52DC47868E4A4B354E934B3E90B7D7435571C79DBC121F04A6FFC272F5A7AA17C57CC61C96DBD8D4250D89DF5E7A
+gfp_sqrt 701
+000000412B0682D70A12069AC81B0362AA02D2584A626C1B0C3D7A432BAFBA5E2DFDBE39F3AC64D095F6370CE1241C1D39B1D25310C73C3230CA3B070E6AAE807439FC4C
+1
+000001FC406C61326564D13410970046538AE1C130312932940A3537E8566431E258D2684806D26F27401FA03C49FDBD3ECE9F2C2F8C6C083F5783EA707C5F3D32FE1F37
+gfp_sqrt 702
+00000076D1B0B70BE200D218798A0D59012664F61A327537097A5942FDAF451376C32DCDA74068B219BD2640CEF61D03A64ED9963B3BC81386BC2B9981E004FB3EF68758
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 703
+000001BD5FD2B5FC9DB69696856BDDB124812DFA9440AB4FBD6F28870AA14D37E300D8636B848EB63785357F3099DB654DF17A34C578CCBC5C744E8E99C08FB93FEB89A7
+1
+000001DC31B4932C954C2FC1D3F2E52DF9143EF599B9EDE73087DE350CE66F731E84FB363B9EDACB4B2E7245E07B59D80A5527A25FB65B55EA14843A72C39A28D72EB3A2
+gfp_sqrt 704
+0000011A9F7333D6F9BBB4D6CA89CB6AD5104D0C41AFF5C8D3D64263A16149DA37DEB1C452F44A1193C8EF916CB4CA0BD112A3F6F611158401DC46787D050F9D05B53B51
+1
+0000016B989D181CA33066BD1B1466F6019F7781F2198825AA2D6C38C71C588CC6664843428BF7739A60F91972F920262D819D38DDBA8547833E469F5F4AEBEB133AD73E
+gfp_sqrt 705
+000000F78C4CAA837EE14B90CB978BE3080E31B03412882213F388704FEC0F409EFAC2922F65AB4E5F2EE40DADA65CC468B3E3AA53C69B0AD19F0BE902E9C9FBD0930B66
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_sqrt 706
+000000154E47C191B9692523012423C996446FADB20896792BAD76D71E1D93EE1072BADA1FF56CFDEA55EE979E8DA4F3456C1F6E7485C5B8FEBA444BA8AB2CD3C26BE7C2
+1
+000000D1456B312CB2061ECC65D464FD29E78B06A72ED5081755C6DE88B409C8A3A16D922790BB018CD5D187A9FDA2EF65322A48CBBC6C9419F48C75687DD5121032888E
+gfp_sqrt 707
+00000089FA9F9186555EC835FD2627EA12ECD209954E4CCCA3765223C7E45A80FD61A20FF22BA4D55FF24712F150403863CCC52E08EA5AD4B32DDEEC4422FCD60204E6EA
+1
+00000188DD3F400604A99E636A9C2A336A01260F5B7042DFE239D3D79107756FBECE71454FF6F2C50D25F954F4042F1E6AF7EA314EBE9880AAF5A86E48866D48FCFD36D2
+gfp_exponent 708
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_exponent 709
+00000060EAD71655A428049DDEE3CB28DEF78FE6F9E00B003DC09B31151F2669D69AC2F55BDD7A0989F900CCA9A1A2E980DACE21CD046C9C5ADB4C1DE220DAA3D837FF9E
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+00000060EAD71655A428049DDEE3CB28DEF78FE6F9E00B003DC09B31151F2669D69AC2F55BDD7A0989F900CCA9A1A2E980DACE21CD046C9C5ADB4C1DE220DAA3D837FF9E
+gfp_exponent 710
+0000008980049B5425F6FEC550F8C92F68688930C36BC5F11CDD0B2A05E0EB6B311E972307B0EE0B6B51DEEAEBAE3F98A0B055A3190DC33F47E5CB363D26AC2B824B87C3
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+0000000F4B3D0A01F3A1675818506291099B9DCCD07D91E331660B8129F3497F1DDED6C01707523694A18438E669A23474264EE5BC23E568A9220B191E7028B9260346E1
+gfp_exponent 711
+000001D6F97748BD522958549EE4391EDBD3BEF729F19238871E73C2C347383361703F288326A0465B185D6FE2B747B753E997ACEF0575560ED1F3C5FA2F60B939EAD428
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+0000005F31AD4D22CA645BA80CC6EA74ED56CFC50E32C8C0D42779800A5D6E1A0DEE44E48EDC0E25765F5C5C7919DAE92FEF0E47AF028CCAB7A3A65120BB2561D1ED8F1C
+gfp_exponent 712
+0000013F0B3D23D78720C1C00412EFFAD43470CFBB063C914542B789B1C054C905493C7928E6F8664DC7F41AB2C53034A0B98954A221FFD9FC7F51CFC22669F3CA70E179
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_exponent 713
+00000109B89E83370AEA89C5B25B2FFB23C7BB3006F0CCEC350B56D399C9838C8B0D2862E32160AA4D07DFCF240687BC8DA3B6AB4B9EE28DFC75B050CD7797F99C49D727
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFD
+000001D788114A5C310FF84B0BA610D5A43BDA97E0614CA5978305E97D011B8560B36096CD502042762CAB2ED51D2D3A34FB9B203C8AB97953C5D603DAE579A66857F4EC
+gfp_exponent 714
+000001C8B66854B14D5E44B4B42795CEF806D07BF9F4267B58A911CA42B23802AB4FFF82F6C04B49B9363C0A71B3523045F7EF155A6DDBA7219868D49AAB5C4CC2E6DAC7
+0000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000374997AB4EB2A1BB4B4BD86A3107F92F84060BD984A756EE35BD4DC7FD54B0007D093FB4B646C9C3F58E4CADCFBA0810EAA5922458DE67972B6554A3B33D192538
+gfp_exponent 715
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000371A224D73C498A9B2E92DB3B
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+gfp_exponent 716
+0000002BD32E7BCE51D179198BC41A3BCD798644A0921493ACAB9A02E23214A285BA6966C1CBC1993AA49FB6B1BCAEFE9D1722C7FE11118771DD5EC2750FE9F15D1FE0C0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000013691
+000001520CB065D9AAD7391C017F323D8AF9A98D3184442E034A4624F8BD95CFBBDC81D87E0AC4D53D2C2946905762004F09867519B90D2BD7F5F83FDDE750696104BF19
+gfp_exponent 717
+00000129000FFA6F03E0606A45FEB91D1DFCF4D58144D427E28DB19357B28036499CDE14DE57DB3E0050728BAB5E8CB2C2D96B93923C2CC1F5401FFF4204E089880DDAED
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000AAD050C0D696D0B3
+00000009600AD20D4DA1417890D23FFA8D57FAF02AE669218D1AFAA5FBDB23AED5EA250724D4C62E378D0D01B1203FCB94CA69853A5244D223B157CA56C98D0174078CE4
+gfp_exponent 718
+00000000B12D5EE303A2F7C9D985043C335A2C1B87D168ED94D365CEB32122BEE1368BF5A061FD6DF45F54DCF6740186E44CBE54FB169A0E66DAED93B19BAC727785D1F4
+000001022A3673BECC6D87E5162136715D78A111EB8D3FDCFC1C01A655674F89E3AB37A0D0AA5707004F02E2858B2990F5281F47363C22AF26540A7CE98BD827EB536CF3
+0000003B43B075DD8C843B33F14F144E7C93431DC5300F848CE4EC8FE760B82E219A78203B101A25A64F9C9BDC41A143DBF463CE85B368AABC3E2D7738DEAA551C394125
+gfp_exponent 719
+000001218E3971406056D878C60956DA38757C4FA18DE7C1EBA126CB8F14F93A5563F41ED6603FE055CD9D84E316E7260CE019C98F143EE5A04C8CCECE41B84320F9D922
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000011FC1
+000000150946B038FC935679EC9F4AF45FAF0E2E8ACC219474222388ECD39DE676A874AE73252EE5A75A53F3F7ACD1677D8FCF6347A7DDD22207E25BF464496639D41CD9
+gfp_exponent 720
+000001AE7DB488B16CFE21F3DE1E58E0EBAFA3339511369584C6146DCB287F8BF1410710B8B95F5267C986B44BFAAC4FC14C2567740759DD7D516761348CFCFCF00C0319
+000001B2108D3DDC389A8126276B2742E6DB092B1B76DC52978A9A7B034D3DE8EA90DEFF606723B238390F9A22E8D0254CDD3D2BB96DC46FF10D00206AAE9C22DB7AEFB1
+000000B94D45553B828EBEB3A90F49FD274C1A0830A523EFE4691C5854B716E14A5DAE9C8633AF8690D15CA8998E25398818860ECE2333E8B6E0E87FFCB26D960B0BEC4E
+gfp_exponent 721
+000001E80FE67F98AABEA5919A224D3A605FF7E78BC1D1717F83446ED49B68EDE30AA1E46CDC8124529DDB3087AA643F631AA6C4D74B1AD6183A21D4C939984ABF395D5E
+000000E26278154113214CFCF51C10FF49FAF80CB5FB802C70B5E632168D723563256F588B241FFAED74503CDFDBC8C949D1F7217E90D0DA25913721A4DAC0FB28D35A9B
+000000365489D0108EA47C0668CD223BF381F236D6896341A94E63B8ECB119DB9B11AC978CC266C13595F6EBFA41A0FD3024B833E03BC1133AF67DFBE42686F18564241E
+gfp_exponent 722
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000006F84EBF6
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000800000000
+gfp_exponent 723
+000000AC8CC3EE9C434E57A63E0CD79B511FFD076A5743C36377B37528E948F08FD4D0683BE255C3CDBF9B0032CD864BAA85C37EC7243440CDB50BA7E0F93537D4864ADF
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000BB125244
+000001F1DEF6BCDEC3008A381153D9BAD71C97B3FFD8DAEBFBC6AF70157A5DA2D3B40B45577981C8C24D93D38207F3596E1D66B81F9BA6162D00FD5873E26A641A301D8A
+gfp_exponent 724
+000000759F7434C77C04315F0F9FC46B554EC8317B5699CDD84ADE8642E5966E895136636439A8356B2F8F0A3C7D39164C991DD9DC9B83FB02BE52D8803CAFA8CCF6EC6C
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001CDED
+0000011A83685399A454E08386E0510842A0D9B9F03D056509245694C9966F6DD14145B11EAACF461FCA4C44CDA04813ADD40D54C48F58857EC78695D0477D0A588457FA
+gfp_exponent 725
+00000157F3995A090F8D7A23D1803AFB30B4BC833B2A1568C165E8D62901EAE2BB16E508DEF789F82B40ACDBF624F3235BD14CF22C54AEDCE953522892FCCBD5DBB58529
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000F
+0000002AFBFF17F1DE3F0061277DD93216F220184336288703D276E44C25D5A2A40B0F2B68E4FF0C79CF3F0E78644C03A122632907D6A17262C92228D4DA4288DD09B30B
+gfp_exponent 726
+000000F7B05BF54826B8E9D508C9FF574B4EB1D242759B91A9C0134420336B6C198105ABE24A6F90EC4132F8908AE57B3A85C91385B1A2FF92122D15612E9103A68DCEAC
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001A035C17AD914F54
+000001A129A57B7F8581558875D12037907ED81DAF9A781134344DF32C3403C3F4727202FE6AD67411C8135D38EB2A206A207EA9BAFA35B53532038EF15671814736583E
+gfp_exponent 727
+000001A8AA110B67949F493DBDFEC29A1D4A3128A6B35DF5DE887C3BC6B349BF447799A687813567831D182AB72DEB659C2128E6195562FFDA5E57DF5D702FEB143F8429
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000009
+000001BD9666959E67EF3F8DB672301D22970D675A371242088552A238B40F8931806575EB3A1617CB7EF1164B66A66744651F9B497BE5154FB4C68FCF36A6784412C8B6
+gfp_exponent 728
+000001D3E2CC235CAFC048C5F4ADFA61C94DE77623133C71463730BDBB14D74459E15912491FBD5858CF28431C971E3FA4248CE80CA0CB31B625D3EBA85E850E215E2E5D
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000A669F25D5CB547CD
+000000360EC1D006DDE15F5FFACBB6CC6727F80767420B02BB59A51749716D6F6B197F7EEE7D382757AECF0F1081CC27971B17CF807D815F56A7266CC7B29BB56E10CCDA
+gfp_exponent 729
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000004B99AFA6603364A0C6CE3C46B
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000800000000000000
+gfp_exponent 730
+00000074676A795D5E321D47FD3ED62677D5D7B6702D79FAE26FABD00628720F024065F86785CDF3C1169C6928FCC29DB35C4233A29CB51EA466E5B0E07C4B060F86BE62
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000AA684F6890A835F955EC24BC6
+000001DD8639B506C3BF7165809CEA198D71F4BE0BF0EFF023BEE2F1F1C1E2F2C4CACDA5995ED7DD8CA77F2909B081CB88BDD4874100D4F30D7197AC226D546A434CD927
+gfp_exponent 731
+0000002611C2E92E6DF30722F65B648544E55D9722272BA56904F3CA8C5E70E1E9D731084CF73DAB55C1820177EDBDE5ACB9E83E9736B50F5C19E6470E334D3DAA08CF94
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000A0
+000000D3A3F9D1024BBB180B484149156F4CCC61945E95D28F20972CB0ACFD1F3F34B4F000DDDAEA27C6AD4D4495F214F5F0CFAA53503A115DECBE356F144F3C145B0D95
+gfp_exponent 732
+0000001E68B11C8E46A1D54CE2760F5552D0AB28D30D67144EF30F233C180B1E4B09B9B5726783160E07B68C678A8E7187726A86BD2E5EF5313D28DF546A2649398A8E6F
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000009
+000000A9B528D3EE8FB281699781A22CA9A524442FB6FD7DFA27D3D2ACB20EF8B739E48E09C0D81064EA64F3FACC13CE19EF54C3AF1265D8D23F985179255F386A13A939
+gfp_exponent 733
+0000013B79BB5AF314488BF1D681D9F5E2F4FA09CB869D1D1AF02C268BFF12683A6405543140FE9FA6C7732D0844D7AADFE0C606C6040D116D78B2F2022852EA007AB453
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001F030B539
+0000016D5357735D049E1B2E658C6CD3F854A67EEC7D15345831B2AB9BB5F761F4419643CD3CF38944E844E5D9E422622F2F45EC2423D72AEC49F159FB5480A3943EB1F7
+gfp_exponent 734
+0000009342766C898DBBB3DD07F08870CCF5C2711328E094AD94E0D0FF574BA3B65C9F5BDCC884BC7E67111D71100C9AF35377F82EB0CE0D22538148987391489D489DB7
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000009
+0000019C0038D478B83F938CCF1C4CE2EEFE6A450FF64F25002E528E9C72AC07A29BF77CDF91111F08FBE7FE07D4DF009B59D6A5125193F0B223BF38873F908440E3760C
+gfp_exponent 735
+0000007412341E180FFDF1E73DB7C78F3BCC964A894ABA0676C85C6E4EB85B2DDB599AD98136ED845E05A1204550669A14952D0B59EB81B4EDA711CD8D6850DC0CDBD819
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+0000007412341E180FFDF1E73DB7C78F3BCC964A894ABA0676C85C6E4EB85B2DDB599AD98136ED845E05A1204550669A14952D0B59EB81B4EDA711CD8D6850DC0CDBD819
+gfp_exponent 736
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000251A5E53B19B3ED8DE3BA48D0
+00000151F01515ED9C2ACD4C091F444F89AABFC13D611AB22BFE4406254209747931C383AE55AD43F3FE3EB1E2C93333886435652B7D66234F1E9F0BBAB8EE147BE6FEDA
+gfp_exponent 737
+00000166234DC8161D43CB2DAD0B3AB4ED864CC1B9570F356869BE0DDE608CC643454A55E6CF5F108D744EBDE392B2DA6F0B9ED61D66A056D8E2414F0C694FE34F5C3990
+00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000D2
+000001040B95FFCD301699EA02969232BFA15F7DB85641F93E59F983822F2E3B0D41E3EE264E2CB04765D50CFFF5578C00C0ED57F02A4303C83BA099DC995C45BC3B0492
+gfp_batch_inverse 738
+1
+0000004DB7D157642CA47DBA6D327209F929D5C5832CB030016E1C8B8797DF8E88777E95FABBBF8F457B24F125F4F10825D4B10339B61CDCCCE0E77D7624BAE2BA71ACF9
+000001F1840DF9BEF0F41698942F9BF1028DF2781E8C8DBE62CB1078978A7B449971DCF0E44CBB07C7FA18052C815D1D808ECF784FF7A4786ADBD9D469C7E6E02707C70A
+gfp_batch_inverse 739
+2
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000001D42772ADAEF81AAD2B3F00F455D4051C6CAC980628E25154D8B1B58B95086B53F708C726F073DCA54590A48981559B945F306925871A7422A4B73D22EBCEE94224
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000DE195A91809F1FEBCA398273E206F5646A6C00BC71CD291910984E9CD7DDAEACEF74F5F0434FB88377AEF09347077C654F13BDBA666B8CBC94F33862228484B22C
+gfp_batch_inverse 740
+8
+000000C2CB2A607EE87816E0B4575BA1175B1F00C76DE373FCA64C105C3D815312CC7DA2AD23F9DE021025AD4F690620DF87CB1166E98774A6F0BFEF12E310B54C2EB4FF
+000000AED34E1E4D6EF20BF458B363B072E0CD36D24AE7297D6406451FDA75C4CB55A600A5D07C65527FE81BE1DB93023088D786605012E7E69D08333E8676273008177D
+000001343923F73B85C1EF45B040B2168C0D80E5C5C42433FB2AD4AD67D53A3BFDB7D3DAB88862545A6A556CF96439908C9143D0BC662003DC8ECA959C01B84D807E1817
+000000E9EBE30EF32CC0F886EAC31821BFA020F592D09E6DC8F0E1B9FF2FFB42DD4F4F426BB87FD9E1410BBCEE33C4FB254713284577A971544C166CACE4D2E0F77989B2
+000000EA267AAAE817C811A39295E4D3461A592C043476065A8923B4E0D131FC563F3CA99396D5679303C9632BB381B89491E1ED6550AB2C08D540FB18034F45466EE29F
+000001F3770BD4ED751BE0638197A41BC6080E0CC12A93AEF99AB5F6C0EFFE9C3E8088456FA23A480B4E2AEDD85BB9ED379661896FFEE3AF01945B5685BD3500A7A0D7E4
+000001F65ADB638673B9F0C6AD2CD22E95688A6C998837F7F7F92629C896853ACD33BD239AF86813F892F5B7A91A0AE1DDF790803F1F6269AFA4FBE421C9A7083BF92DBA
+000000CD98CD79F37FE63FC6A1C3AE64E18ED30767F50B406C8E7102DB123405565A6A88985B88D6C5EF0091DAA163B72B8801DF12237727392C90ECABF27F2A7604B963
+000000612C37665E1F0C9CF8AD95AAD6F2624EA81E56A1092DC87477E0C885C77D3AFC2B75DA2789F4F6743782F070F6070FFF0BD08B4BA651D43AB105D6C01F12095BE6
+000001BE0C43CDA8429D22FD3928710C55CF6E2DA9772CF784994610EF97B45155BD8398C88E413DA4CA31AD1FFB9739E9DD43FD0DD053C6117128C12DDFCD828A04A61A
+000001BB0AC6B071AAEE9FAF74361F0818DDF9C71A7E4771D704CCA4B2F2C927B1EB52B0BB51D3617D23D7324C867015F9D4399B3D15A0921BAC09FDEC8F919F50305F99
+0000011A24EDDC8EB1099747B5FE0B99CB1A63975F2AF6B6736BA630962CF8F4FB41BCDFC9664C2511C099D0ADB4B26C6A3469017D90F83C96C1CEBCDB029EF938B401B5
+000000128FF071E3E5AE5E929C0A90367AB5BC6AA70BD5E7C7A1A9C5EB803F47D0CDACAA6D690DCDB13276A586F7A015F7144F4E271247B3289F2157857A0990524905ED
+000000C6BD08804550F59F6D69C90B41AFA9417273D32D91119BFA23045CBC1EC58F39F5DDC195039D5D843F1B9C215BD0998251A5C54B091D2D59D8EB467A92721CF316
+000000D63D6CD1D27892FD254344724C00DCBDDAB57256F2024011FC953D0094AC928BDF7D930FBEBF203F2F19A44CB4803A9F143047D2294AE37E8787E27C5CC72F13FF
+00000043E788C983DC45F6B3F5012CE04B201E8ACADE1FE2D0F8FE0BFBBAE9EF22699FECC7A47E5A6E4CD007D6F8362ED3BFAFFB5CDC228E3722D20AE4DC363A4301B9EF
+gfp_batch_inverse 741
+8
+000000E1834BA1F7B0D637AE49F9FD6BDB3518A28EEA6D0A16AC037B9A555AF2F09D1B1BA3DCC062AC66344972E4E8E965054C2867BA4EE0E1B627EA8152005A9D48809F
+00000114A16BF621D970D7D4EE9661F4B595BB97A077F990AC95EDA581410C836FD80D0631DC20C6E1D50AC02A57170FA8060DDE7E88E9A111092C7509D391BD2EF031F0
+000000AC1A9C970C9C5C047AC1EB2A5C4DDA23D43C4E9E009AFC9C9B64892FF71E42DFC530014289545E59E8F57EB0E1068237C35D0A62ED8BC6029DE1FF3E18C48048E2
+000000DCAED550A1661C46567630DDC3D34DF3A78A34B97EBF262ACBA9C2F214EBEAB5FC7323D99C1A7F535CEED37FF5D9DA5C043A2E71C5AACC3C030B869516E8BA12EB
+000000891CFA3FC01006A7D472D81F1488B6719CA42F7B3A02AE6BADA50EE4A146CC57C3DA4771D459678D47343A6B6CC9E03C34F03421F0A1AF470D92594C06E7D5B977
+00000064FFBE2CF483665C41A98856CF86BD6D9A8FE51DECFF7759A5EB261E341B3E48876B93517938942F01353D8CB7419730D85F8522A52E85FDA97657F275C8711507
+0000014F54F290375632B315AF8FB1128CA714D77CCCA589FFCBC6570CD232969BA961BF519FF369CF21BC2A0A492EA5B200BDC26F709D6EF38FDF3340AABB04A3F16109
+0000003ADAAFBDACC0A119209E28AD469C8554914DB22CEFDC29DA8D68A1DC06091CAEB2252EF29AD5CB688DF128E885D4CDF5C66CBE7E39EF8D605417E836911066E10A
+0000011DBB2E4CA1AD532C3650EB5F448EDAA5785A2C7DFF4E0ACBCF7B780865783777B4974588C1F7543F1F0F6BA91B73A141D6EC31441507755D6302B54C2D7D7D45FC
+000001AD18890421AA6D88190E2865A4EC5ABF9CED1B7FEC10B09EB0F65AA3B205F98312FBEC16B237D8D4157BA10BB0D1C5431B9FADD96A8AE50BB6AFE4D0A53317C5EC
+0000007F888ABC600B016C94E2D77C54ED7959A5F74BE55C3E4E33C15FB0E45BACA88AC620194C72910A655D3B384278F52A7C244D7FAED7E39AE464803E5930E951702D
+000000C6F71C6F2C6CF4E0790C85E12D48DF2CEAA0F96B5C57A9520188C2A9DFEAB944FCB75268E020E0C236394FD460B8188C02578EA987256585460A6327DB60A51569
+00000196381DBA354213038167757B8F9B973FB9D3246D8B0A008548607626D4E7D379D6136622E9B08620A7BF5DD096204C44CA9A37B98C464DC6791CABA45A57796280
+000000AA278E035C06F7FDCA47A5D64E3FEFB90856F028BA1CE3A6A6C17DFA024250C9E3F92843FE3268F1DB60000CD3E244F94F97B020A93DD045F59BB4479985DD7A87
+0000003AC26B87F132B64DE4F4150B34887FB5B12D7CB2857D7E038C3A6D4D2AA0B0EFF60DE018528920C63D914658A8F42D2E552913BB7653D34882A5BBCDADBE03BC48
+000001AB832AE0EEC6B130E7867BCF999D43D4A00ABC76507FE35FEB4772A69D87B8E675AD448DFF26547C45AA5510768C52B241C4322E4F07E741932F984AEB0B9552D8
+gfp_batch_inverse 742
+5
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000007B9240B646A8E2C32864C111A8B254127CA17BD14CACB03627AAE01D673E0A50F7CADFE62CA0130C80D8A29E6C11002681D27E08488926C08D42BC208763D55AE3
+00000094E81087B430602EDFAC96BDC916A00775A929E7881A0EB84BCFF567CEBC485AAC6D7B054E4D79CE3BB49CC083E0DD328680452AFFB4512FE5BF7644945E240D05
+0000016D77B73CA663FFC8A14D24A6151A974FD63D7F9FC7B967D597DDB8248228FC88950DD6362B95842553E7DC6F8E64C58A286389AD6E80DB69286F1844F9DBB28847
+000001758403D478831AC13E9321CA46481AF92E26D4B066299B75E461CDF4C50AC52E4D9A64ED5898369573ED7F3BC20853521695F24FF8920B453078D3609871ED7898
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+00000057ACA03AC0F2FEE23203457DE4E23E8B05FC0C78BE1979F062D47B20821E77068F0E2813E3962C31B165A05C74F77C15F98174E47FBBA2B98B33DF19596B74F66E
+000000A63B3D486962F7CA1F50A8A1954E8EE43BD6174EE6038C8040971CD3FFF1816302AB45CDFEAB7D114117362BCE6B3F000A7EE1874CE517BE9CCB23AC80CDC1B0DF
+00000143DB2C467E8BCE62C85DFD9215CD866D27EBD95F0C6BE058BAD809EC4AA89929044863DE88832D1F769D3D331C83D6118156CDC8D607DD6A6EFEE7AE7483882C13
+000001295675F237984880EB182B52043B8F2433EA262DAF7754AB451B38D4AE5CFAC3C238900DCC2198D83D3175141D6796E6DA19808192368DCBDFDA6373A2DBBFBD6C
+gfp_batch_inverse 743
+3
+000001EC45A148FAFC9A2113BB07BB97E7A0F1530C85DF6FD02EB59D1DA1B8ECB753EB0FA0F7E9313AB9B0067905B9D869845D12ECA780A807BEC41C6F837DAA08926F35
+000001D660296FAE0B7AE6CFFB5EC22C4E4BF2B8A1F705A4021DCA02B33E22F0D23677588B5F071BC8228425214D8E8D93F3F663911942040939330A3D581D984FBF75BB
+000001CAD76D66EDD0D16001488CE2B00F41F03143BBDA9DC649C5E2F24554AB6524AE40ACC027C02F7ECC70FE5D7293CC7358C09E0A3BACE6BC6BFC38CF474C6C9A33E4
+000001AE6580AEE0B7B1A5C130C98C04A31E4601EB770CF309E21AF28D8C9B902A29DA56F97AD8B1E3DB848CBA94F06B5E71D657591FD63698FD579808920EF429E3734E
+0000005B93996F2870E7874EEA1B69759314525E99F25F5CEEB2E6CF77CED3F7F13E2FE737771764DC2DF136D04EA25715F23680A763DA1150872EAEFBF68878B52AC695
+0000011D19810DAB09C5E00CDD57DE1D6E0CD6CC45FA71BAE87803E3E657CF518D41618B8FB6A9A08144EC4EC3C3BDA182A55BAF213C016A1C99A90D9BB9F32BCD5F5CF2
+gfp_batch_inverse 744
+8
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000CB835C825DF63E9FF7BE5600C38A43B4857E6E33E170B73C44A1346A1F5FAB2BD0FF22EB961E9A61DBBFA7FC062DB7A2E6F40BCD7CDCDCCA8AED0875103CC6407B
+00000133FFB71783B31B59B516827E0233789BF0A44BE4965267E0C8D5E53D7FB92046ADE3E6AD1C5AB1BFA17B458A2ED84962CE2198B4BB1E7B05D7DFFED7880BC82C79
+00000082B3CB0D1562ED87C8C588EE7EC1628D85887D7D78CA5939E2D6BC66776A1023F513E41E1C1938E8A23C915A731972F6E177BD655AAA1D6AB37A23F28F5C1FA55F
+000001B3F489C6A055601F55C6F3BCB39A3F3D3B1690B49D8DDF9EDF0E25CE6478995C45207CA067C723CFEE3FB453CB1EE4C60371B20671E53628B7935E09712C49CFFD
+000000CEE2D55935F61EF12B2F6995E0D49F12498445B1F566E4DF448CBDCEC87A7DC5CBC7E4E27D46A456D6F8728B01725DFA14C38C01F7AB9F0D55BBBC3397CD72BD62
+0000009E78CBBD0EBDBEA09AD45A723E3F029CACCB59901EDF74D6ADFAD203D1EA9EA1A8F84A8A7B2C903B09EC104B69D7606C32BACFB8779585028046A9C0173EFB1276
+000000F993002F215E8DA46BF49AD864E0CFA431E95B2EF3C95D7AF6C15DD55DC406559EA4F3C98D3C3618925FA6F7ECFEEB7AA919283EAB36E2C7F60393AE98B19D596F
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000001ACE80B4023974C9EAEFD701D3A7470AE82391FCF1D24AE84FA8D478D3B47FEFA8A7E489148CB97F465148266B6D43A4D19EB3DDAA8A2B79E01FFEDAFC9D091F9E
+00000113D6CAB8C43421F5F537B03ACC8B2821B3C9B2AB1925F184ADCF9A865A9B89F65AB5919DF8E3433E18D5FEE6DE6100F6C16098A359F360FDE983D43E73793EA9EF
+000001B6D1E812B475D5DE2BF4705CEA63676E7209254B68DCD122AF36B160EFDE389FE2FEF1B3ED3B8C412735DD0A7424DF84BFB269C85B99C832AF7182A3FEB14FF4FA
+000000EC47FBD89F998FB9BF78DCAF974022298E95BC94AD7971D1AFC7AFDA5554CF0B352E881FC8CF3BC057527D6AD06929633155ED5DDF70B2F87C6C223F5940E9E396
+000000A6471419F17617360DDCC80D1A0F670BBC5BCC6F5982DF9B0D59C8029E07ACBA1890602818E708DEA92286F9551BF1F34FBDA7B6A8126ED76F41CD96F56A607FFD
+000001FE0D2A847C2C07C6CE9AC981D35C4A13DBF45EB1B4CBBD7045DB0915795F5E38C567DD32E788EA949E2A95A47C82EEF0E8E58663B86558FAA3314BF4E9E302F2E8
+000000EC38C6EA7A25CC0F1B9D6C1BA7E98F7DC943C9E6D2CDC39CAB83FBF82BD30273226F03B2CD77AC8049D452E919F5DC5007F2CE3AB4B777D82DC62FB8DF7630EA3B
+gfp_batch_inverse 745
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 746
+4
+0000001DF8843A28B0F5521BC09514AAC2BFA180390624E3F02663FB58BBE4EB62081D07600A1362720788396B8D762A785FA451FDD8C550C13B9EE713FB63F285CC51BD
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000019154CC9FCC5444A521322526492D621FE4A078E8C23F6A872316ABFAE163E81BEBC43769130C3B29911F873CEA02D86FF6EF70181B45000A77A7D3305E9D29D422
+000000A5EB78E92F16CE5E5EB885B066C8614769AD780C00607AA058E4BDDF6D1DE9621C3D02EFB6BD847FD2E739FD3819BFC35592C4EBF8C10AB2798372290E324F1D9F
+000000FD1044F3933A2A6F4A7C6B09D14A5225DACEE1FF80E8EE0B4BA4357913B9BCBE2D1018D37BE6A4DA02EA1DC094314C186EF693FE4439BBD441AB3EE6000E671AFB
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000007D8DFC50B9ADBD77CD8FFC24A00F52FCB2FEBFAF7CADC6E371F0B18D1E6EDA508F3155B03CB4FBD77D8FCECD443B0DF8A3C9047348DD77CEF0B0F0526BDF5CBE5A
+000001E2487ABDF68C291E256EB2EA36BCB6A49BDACA690189457A75F66D59D7CB9C10AA0FA8E3752DAB9879BBDD9D1AAE28839A6BF683BE3F9444B460A8FED51F3A2E9E
+gfp_batch_inverse 747
+7
+000001E9CB1A9050C91B9A5FC6EF69F8A4C13B96454DBB685A2294A33C7A372638FD8038FC6FDF831A244DAC87CE590D2D07C20089CB1867DFCD85C966D38BD6EE99EF07
+0000015382D89871C7E2F370A36754CB8B31E67323596CDF92D7B3E6981A5320DB945BEC4A8552278FDCDBC3C21328BF7F669CE647A554250D9D1076951F752E52587D75
+000001D729C6D05E954562C7C7FE2558911BAE3B8A822E709CF667CE8ACAF7C05821AA5B7084AB0AD0A5D26EB504AF7126AEF6CF048361296823A255A06105FA5A48F81A
+0000004EB8219B8F50E18657969D458BD25D22ACA948E1078CFFA9AF85335F47091382F1D3ECDC84D868668B4434EBFCD20ECCDFDD45C549243C0E6532D96DF4DFEDBF44
+0000006C3B7E0FD9A56635F913BFA0D808C654E18E569B89153DC51FF1AF8314C9A408F1575E8BA809617757FE71F714C2AE236538763748269F060EF10693AAA5E46902
+000000BA78FDC7A65D0AA9B003E4324484D9D5424E9C9304F18830B1FDC0E4001AF0389C1DF8019E5E47464764F9B3DB3A92840E415C41D502D5408D1A1A00BF9C330CCA
+0000014A3AF8E7DD7A798E7F5F7316D998500177DD45C48058AA5254DCDA94C1C10C1F45BF223C93506860F4AAE32E8899D0DC949A4E3EAA16CCB09D1C342B07A28D3C25
+0000013116FF844B3E3EDDA9E507FA95AB6A80D523764D9275D821CADE4770BFE07AED3EB005EF1BCDFFB773209EE12DE5C38C3FC2A1C05B2CE65225FEF7B5E88A35315A
+0000017E79AFCD48DB1C0CB8B5C8B12826C64AEFDAA3425178A0740E095DB2A4C0E513C10310C39E5F1725225C1383610796A2941B9CD900FF9522BEAA7E0F85621A1294
+000001C69F9AD21EEC2BD224879E682035A19F6FE5D1A32A7AAF0783779C76A6D971DA227E7C9B7DFC8F73EE5B8F2D9485A52DAF569C832C506F2B7AD9F4BE416EA2D3F5
+00000140EA604BBE561FA53937A4D2AA35FD12DC7EAFF9E22D3F7F1920E9D5FFB4B2B4B60B4E0A0023A101CBAF7432B4917CCBC49BBC441E770C5C90E2662728E05FC2F1
+000000C316DDBFC80E6EC04AEB9E9AE51C40FC414DD735065B74298990ECA206AC492966B5CE131DE6E517067D80C2ECF611DACBCF059A753BFD3612FC6ED97D2E1A8D54
+0000012B6FA16B5D49FF5B73E6C890972C5D50B038DC821718852CE2EC520D77C060E545A7C01AEFABFDA118FB306EDFDBD62E97CCEC7C9DEB275229F96D635653CA8015
+00000024E688FABB09FF12CA7C8BCFD0E2DEE81875AD12DFC603422A17C7D56CFA1D45C35C297A7F34E034CF09450DC625D39ED6703A4B5AFDECD981EA7B0C5B18410A4F
+gfp_batch_inverse 748
+8
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000017C57596D87B43DDEC1E50388985D6D867E9463EDF3BD8963503886EE68C1E9FD5315A9E78D79A4F9996047E92EB9C64C4D45F3060ED665D4E8BD44FAA1F2786D78
+000000BA8837F1DC7E1E9F0FD7D00BCE03F5F58B4F0171C0EEF9246015A2635154FE55EA7ED608F53701E95223007EBBB6B43FB36FC7B8F2EFC6B3C496226722AA040C77
+000001AD0122911957C03295E3164B8C83C705C2B3B47C9E67E2242ED374C3E310F686EB465E800CCB3ACB2B504C94B0B0CCFEF68FB2A3765CE859CD2D46039791EAE148
+000001BCAD8F49EB1209292B3AB485B3CAF2411330C8308BE62D84771843522A85ED47BD093D0CB0EB71D884A654227480CB0102B7907B2B790303CCBBE04CE2CE461F50
+0000019048E048138D54F0D0AAA2165CA71FA08485EAECD72FFA04AA10CD3A0DE1F2AD8CA0E9A845BEE03E818252C52FB35D4B1989D0C1DAF3A3E9404F29691B2879BFE9
+00000161773C2654EEC307B0A4AD76C27AC03B0730A66CF65AE3B0206F17717129EC711FF49BA3F7301213698F2BB5737434AC684F10226A8397F052D9FFC73BC9D93D73
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000CDF2E96F97A271848801B16F1B4887626548A2C98379FD62D683C13644A0C554EE05EDA66DB35478782C9552AC56845213FED01AA74AF59BEDAF4F80FB8CFC4A38
+000000D7CF1E6F5455A2A3170A0F5963F586FB401BE6B037B056E1AAC776F8CB1844004FAE67F9635F035EB8DF43B2E181A266FFD6DED315C310FF85D18AA357512B7FFB
+0000011F674577375074425340F6195C0EF4B5526C87E4E3D314F394F384828AD4E09BDE2B435D0F9CCB4A497452C3C225B03D1C2862A727E406431F53368A57C98766B6
+000001D880D5F3929662670096401CB68DB3AF5CCC6B87DE1D5F6F3ABA4F37F71921B9351DD06EFFE8EC5E449E777ACD38A547E193BFDCCEC951B5E3CBC47927F43153A2
+000001D0C8F12F49AE3D84354A5651C6BF295F1B56BA3C21278BA46ABAAC5E0BBD44539BAFC1E35A766A57442344A6B003F7B8781CACA2DD7B2FA1599CAE533880F87845
+000001CDC7818D320A5C08F7FB4A5EAB9DE7CAECBC867A0ED35B93327CB0361BB3F55CA32C381EAF798B01895BFCD622A52F249BC7DD50A6710F58AEAD3D699C729338EE
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+gfp_batch_inverse 749
+6
+0000019006A1A69BF7A77CEABCC87AC2473A46563B3B33DAB00077192597902356EACE94D23C0D9A44F47303626173EA701DA50D92E592577C9E63A4289544D2D8813064
+0000010CE7B1151D0437BA7CA1C3A6040F0DC3391894FDF4B9DEDD8022C06F838B6A35A44076F5947AAC1078BB26DAAD149C4897AC5DF31C1B8F2323E26B0A53D67DC416
+000000E3D2E6DC99E8978BB5E45EE5D37B2C74168C31629CB76057A894E5541DE639A68A33A07A4CA767FB4E22308AD643E695F6DA28D1E08A9D45BF6D16B5775D42B241
+000001B5ADEE99DE5649B1D456761FE465A55FC362A71F8008D0E61165EEA9F685162322AB195B2A3EE0EF29B9417F145DB0C380D12B8FD547C2A1E9F318FC7756C3C2C9
+00000199E210E544742C07ADD1DC2313DCED1392D6854C59341536EE073810E74C91E51530EBAB464AD240F1FCD47F257D60EE275BB5A7B13661E75C5CFA0F06DF73EE52
+000001B0CACCCAA9BF1FFC5811D0F40D6B7146304E7F9BB108BEAFB56B57DF3A74E46741F0D81B2B9A0D78D790C6D485A26E184DBFAA69CC3953E78C2B742597E46A158B
+000001709577213A148424EF324E6C880D00D7EC691091FBE3AFEEB94986E93E2B86C56BF21084B1B24F391D835159BF2F65DB9C5FEE78AA79FC3277704B24C63D8074BD
+0000017730DC84423A731DC857F41A7AA6C5F6B3B47FEEE2EB929C1E3821DB574576CD05B1AAF5EAC1059E2F9F212E497235CDD0A019FE170DD171E196875D4C400A04B3
+000000DA8362E37901A5029FFD3219571249D33F04AD98573865EA902FDEB59F3ED2172F87647C098682B4D7FF9716176FE41D350BAE7202CBACEC7DAA91E838782C425D
+000001C144509E34823BC64366380DC22ABC1ED200631E40EC36122700D71991E23F50860C62ADE516B1F25B0338A15721E6B24647A4CF686740C2D52C1F5735B43A9A8B
+000001ABB175211EB522073084E1ABABB7BE4304A12447A08169847B9C7DFE103E512B796F08398CE6BD08F18849D98B59D4A174AFE7DE45B5BD8471303F05DE50FBAFA5
+0000017246FCBD11B45B85CF2F2A9F4A2761C2D9A2932093A8C53A4B423A54A578AA8920D81A014A2AE1B78E5D27A1BD921D82BE178AE1D8FB5C25B394BC86EABE23BFA4
 exit
@@ -48,12 +48,17 @@
 #include <flecc_in_c/utils/param.h>
 #include <flecc_in_c/utils/parse.h>
 #include <flecc_in_c/utils/performance.h>
+#include <flecc_in_c/utils/rand.h>
 
 #include <stdio.h>
 #include <string.h>
 
 //#define READ_BUFFER_SIZE 4*BYTES_PER_GFP+2*WORDS_PER_GFP+10
 #define READ_BUFFER_SIZE 1000
+/** the maximum number of points of the multi-scalar multiplication tests (200 points use the bucket method) */
+#define MULTI_TEST_POINTS 200
+/** the number of signatures of the ECDSA batch verification tests (more than ECDSA_BATCH_SIZE) */
+#define BATCH_TEST_SIGNATURES 11
 
 /**
  * Reads a message in hexadecimal format from the default
@@ -169,16 +174,22 @@ void read_eccp_affine_point( char *buffer,
  * @param param the to-be-initialized elliptic curve parameters
  */
 void read_elliptic_curve_parameters( char *buffer, const int buf_length, eccp_parameters_t *param ) {
+    uint_t bits;
+
     // 1. name of curve as string (discarded)
     io_gen_readline( buffer, buf_length );
 
     // 2. number of bits of prime field
-    read_bigint( buffer, buf_length, &param->prime_data.bits, WORDS_PER_BITS( 32 ) );
+    read_bigint( buffer, buf_length, &bits, WORDS_PER_BITS( 32 ) );
+    param->prime_data.bits = bits;
     if( param->prime_data.bits > BITS_PER_GFP ) {
         return;
     }
     param->prime_data.words = WORDS_PER_BITS( param->prime_data.bits );
     param->prime_data.montgomery_domain = 1;
+    param->prime_data.reduction = NULL;
+    param->prime_data.inverse_chain = NULL;
+    param->prime_data.sqrt_chain = NULL;
 
     // 3. init the prime field
     read_bigint( buffer, buf_length, param->prime_data.prime, param->prime_data.words );
@@ -187,12 +198,16 @@ void read_elliptic_curve_parameters( char *buffer, const int buf_length, eccp_pa
     param->prime_data.n0 = gfp_mont_compute_n0( &( param->prime_data ) );
 
     // 4. number of bits of group order
-    read_bigint( buffer, buf_length, &param->order_n_data.bits, WORDS_PER_BITS( 32 ) );
+    read_bigint( buffer, buf_length, &bits, WORDS_PER_BITS( 32 ) );
+    param->order_n_data.bits = bits;
     if( param->order_n_data.bits > BITS_PER_GFP ) {
         return;
     }
     param->order_n_data.words = WORDS_PER_BITS( param->order_n_data.bits );
     param->order_n_data.montgomery_domain = 0;
+    param->order_n_data.reduction = NULL;
+    param->order_n_data.inverse_chain = NULL;
+    param->order_n_data.sqrt_chain = NULL;
 
     // 5. init the prime field for the group order
     read_bigint( buffer, buf_length, param->order_n_data.prime, param->order_n_data.words );
@@ -213,6 +228,7 @@ void read_elliptic_curve_parameters( char *buffer, const int buf_length, eccp_pa
     param->base_point.identity = 0;
 
     // 9. finalize
+    param->param_a_is_minus_three = param_is_a_minus_three( param );
     param->curve_type = CUSTOM;
     param->eccp_mul = &eccp_protected_point_multiply;
     param->eccp_mul_base_point = NULL;
@@ -243,6 +259,8 @@ unsigned test_ser() {
     eccp_point_affine_t ecaff_var_b;
     eccp_point_affine_t ecaff_var_c;
     eccp_point_affine_t ecaff_var_expected;
+    eccp_point_affine_t multi_points[MULTI_TEST_POINTS];
+    gfp_t multi_scalars[MULTI_TEST_POINTS];
 
     eccp_point_projective_t ecproj_var_a;
     eccp_point_projective_t ecproj_var_b;
@@ -260,15 +278,29 @@ unsigned test_ser() {
     }
     length = curve_params.prime_data.words;
 
+    // the gfp_mont_* tests always operate on the Montgomery representation of the prime field
+    gfp_prime_data_t mont_prime_data = curve_params.prime_data;
+    mont_prime_data.montgomery_domain = 1;
+    mont_prime_data.reduction = NULL;
+    gfp_mont_compute_R( mont_prime_data.gfp_one, &mont_prime_data );
+
+    // keeps the base point tables that param_load may have wired up
+    eccp_parameters_t loaded_params = curve_params;
+
+    static ecdsa_cache_t ecdsa_cache;
+    ecdsa_cache_init( &ecdsa_cache, param );
+
     param->base_point_precomputed_table_width = TBL_WIDTH;
 
     eccp_point_affine_t comb_table[JCB_COMB_WOZ_TBL_SIZE( TBL_WIDTH )];
-    param->base_point_precomputed_table = comb_table;
-    eccp_jacobian_point_multiply_COMB_WOZ_precompute( param );
+    eccp_jacobian_point_multiply_COMB_WOZ_precompute( comb_table, param );
+
+    eccp_parameters_t comb_ll_params = curve_params;
+    eccp_point_affine_t comb_ll_table[ECCP_STD_PROJECTIVE_COMB_TBL_SIZE( TBL_WIDTH )];
+    eccp_std_projective_point_multiply_COMB_LL_precompute( comb_ll_table, &comb_ll_params );
 
     // eccp_point_affine_t comb_table[JCB_COMB_TBL_SIZE( TBL_WIDTH )];
-    // param->base_point_precomputed_table = comb_table;
-    // eccp_jacobian_point_multiply_COMB_precompute( param );
+    // eccp_jacobian_point_multiply_COMB_precompute( comb_table, param );
 
     while( 1 ) {
         int line_lenth = io_gen_readline( buffer, READ_BUFFER_SIZE - 1 );
@@ -278,6 +310,7 @@ unsigned test_ser() {
         test_id[sizeof( test_id ) - 1] = 0;
 
         if( line_starts_with( buffer, "exit" ) ) {
+            ecdsa_cache_destroy( &ecdsa_cache );
             return errors;
         }
 
@@ -436,6 +469,67 @@ unsigned test_ser() {
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
             gfp_negate( bi_var_c, bi_var_a );
             errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+        } else if( line_starts_with( buffer, "gfp_multiply" ) ) {
+
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_a, &( curve_params.prime_data ), 1 );
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_b, &( curve_params.prime_data ), 1 );
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_expected, &( curve_params.prime_data ), 1 );
+            gfp_multiply( bi_var_c, bi_var_a, bi_var_b );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+        } else if( line_starts_with( buffer, "gfp_square" ) ) {
+
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_a, &( curve_params.prime_data ), 1 );
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_expected, &( curve_params.prime_data ), 1 );
+            gfp_square( bi_var_c, bi_var_a );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+        } else if( line_starts_with( buffer, "gfp_inverse" ) ) {
+
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_a, &( curve_params.prime_data ), 1 );
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_expected, &( curve_params.prime_data ), 1 );
+            gfp_inverse( bi_var_c, bi_var_a );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_gen_inverse_fermat( bi_var_c, bi_var_a, &( curve_params.prime_data ) );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+        } else if( line_starts_with( buffer, "gfp_exponent" ) ) {
+
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_a, &( curve_params.prime_data ), 1 );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, length );
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_expected, &( curve_params.prime_data ), 1 );
+            gfp_exponent( bi_var_c, bi_var_a, bi_var_b, length );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_cr_exponent( bi_var_c, bi_var_a, bi_var_b, length, &( curve_params.prime_data ) );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+        } else if( line_starts_with( buffer, "gfp_batch_inverse" ) ) {
+
+            gfp_t batch_a[8], batch_expected[8], batch_c[8];
+            int batch_count = read_integer( buffer, READ_BUFFER_SIZE );
+            for( int i = 0; i < batch_count; i++ ) {
+                read_gfp( buffer, READ_BUFFER_SIZE, batch_a[i], &( curve_params.prime_data ), 1 );
+            }
+            for( int i = 0; i < batch_count; i++ ) {
+                read_gfp( buffer, READ_BUFFER_SIZE, batch_expected[i], &( curve_params.prime_data ), 1 );
+            }
+            gfp_batch_inverse( batch_c, (const gfp_t *)batch_a, batch_count, &( curve_params.prime_data ) );
+            for( int i = 0; i < batch_count; i++ ) {
+                errors += assert_bigint( test_id, batch_expected[i], batch_c[i], length );
+            }
+            gfp_cr_batch_inverse( batch_c, (const gfp_t *)batch_a, batch_count, &( curve_params.prime_data ) );
+            for( int i = 0; i < batch_count; i++ ) {
+                errors += assert_bigint( test_id, batch_expected[i], batch_c[i], length );
+            }
+        } else if( line_starts_with( buffer, "gfp_sqrt" ) ) {
+
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_a, &( curve_params.prime_data ), 1 );
+            int is_square_expected = read_integer( buffer, READ_BUFFER_SIZE );
+            read_gfp( buffer, READ_BUFFER_SIZE, bi_var_expected, &( curve_params.prime_data ), 1 );
+            errors += assert_integer( test_id, is_square_expected, gfp_sqrt( bi_var_c, bi_var_a ) );
+            if( is_square_expected ) {
+                // both roots are valid results
+                if( !bigint_is_equal_var( bi_var_expected, bi_var_c, length ) ) {
+                    gfp_negate( bi_var_c, bi_var_c );
+                }
+                errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            }
         } else if( line_starts_with( buffer, "gfp_mont_multiply_order_n" ) ) {
 
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, curve_params.order_n_data.words );
@@ -443,6 +537,10 @@ unsigned test_ser() {
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, curve_params.order_n_data.words );
             gfp_mont_multiply( bi_var_c, bi_var_a, bi_var_b, &( curve_params.order_n_data ) );
             errors += assert_bigint( test_id, bi_var_expected, bi_var_c, curve_params.order_n_data.words );
+            gfp_cr_mont_multiply_cios( bi_var_c, bi_var_a, bi_var_b, &( curve_params.order_n_data ) );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, curve_params.order_n_data.words );
+            gfp_cr_mont_multiply_comba( bi_var_c, bi_var_a, bi_var_b, &( curve_params.order_n_data ) );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, curve_params.order_n_data.words );
         } else if( line_starts_with( buffer, "gfp_mont_exponentiate_order_n" ) ) {
 
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, curve_params.order_n_data.words );
@@ -450,12 +548,18 @@ unsigned test_ser() {
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, curve_params.order_n_data.words );
             gfp_mont_exponent( bi_var_c, bi_var_a, bi_var_b, length, &( curve_params.order_n_data ) );
             errors += assert_bigint( test_id, bi_var_expected, bi_var_c, curve_params.order_n_data.words );
+            gfp_cr_mont_exponent( bi_var_c, bi_var_a, bi_var_b, length, &( curve_params.order_n_data ) );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, curve_params.order_n_data.words );
         } else if( line_starts_with( buffer, "gfp_mont_inverse_order_n" ) ) {
 
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, curve_params.order_n_data.words );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, curve_params.order_n_data.words );
             gfp_mont_inverse( bi_var_c, bi_var_a, &( curve_params.order_n_data ) );
             errors += assert_bigint( test_id, bi_var_expected, bi_var_c, curve_params.order_n_data.words );
+            gfp_mont_inverse_binary( bi_var_c, bi_var_a, &( curve_params.order_n_data ) );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, curve_params.order_n_data.words );
+            gfp_mont_inverse_fermat( bi_var_c, bi_var_a, &( curve_params.order_n_data ) );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, curve_params.order_n_data.words );
         } else if( line_starts_with( buffer, "gfp_mont_parameters_order_n" ) ) {
 
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, curve_params.order_n_data.words );
@@ -471,29 +575,49 @@ unsigned test_ser() {
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, length );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, length );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
-            gfp_mont_multiply( bi_var_c, bi_var_a, bi_var_b, &( curve_params.prime_data ) );
+            gfp_mont_multiply( bi_var_c, bi_var_a, bi_var_b, &mont_prime_data );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_cr_mont_multiply_cios( bi_var_c, bi_var_a, bi_var_b, &mont_prime_data );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_cr_mont_multiply_comba( bi_var_c, bi_var_a, bi_var_b, &mont_prime_data );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_cr_mont_multiply_sos( bi_var_c, bi_var_a, bi_var_b, &mont_prime_data );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+        } else if( line_starts_with( buffer, "gfp_mont_square" ) ) {
+
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, length );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
+            gfp_cr_mont_square_sos( bi_var_c, bi_var_a, &mont_prime_data );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_mont_square_sos( bi_var_c, bi_var_a, &mont_prime_data );
             errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
         } else if( line_starts_with( buffer, "gfp_mont_exponentiate" ) ) {
 
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, length );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, length );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
-            gfp_mont_exponent( bi_var_c, bi_var_a, bi_var_b, length, &( curve_params.prime_data ) );
+            gfp_mont_exponent( bi_var_c, bi_var_a, bi_var_b, length, &mont_prime_data );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_cr_mont_exponent( bi_var_c, bi_var_a, bi_var_b, length, &mont_prime_data );
             errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
         } else if( line_starts_with( buffer, "gfp_mont_inverse" ) ) {
 
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, length );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
-            gfp_mont_inverse( bi_var_c, bi_var_a, &( curve_params.prime_data ) );
+            gfp_mont_inverse( bi_var_c, bi_var_a, &mont_prime_data );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_mont_inverse_binary( bi_var_c, bi_var_a, &mont_prime_data );
+            errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
+            gfp_mont_inverse_fermat( bi_var_c, bi_var_a, &mont_prime_data );
             errors += assert_bigint( test_id, bi_var_expected, bi_var_c, length );
         } else if( line_starts_with( buffer, "gfp_mont_parameters" ) ) {
 
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
-            errors += assert_bigint( test_id, bi_var_expected, curve_params.prime_data.gfp_one, length );
+            errors += assert_bigint( test_id, bi_var_expected, mont_prime_data.gfp_one, length );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
-            errors += assert_bigint( test_id, bi_var_expected, curve_params.prime_data.r_squared, length );
+            errors += assert_bigint( test_id, bi_var_expected, mont_prime_data.r_squared, length );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
-            errors += assert_integer( test_id, bi_var_expected[0], curve_params.prime_data.n0 );
+            errors += assert_integer( test_id, bi_var_expected[0], mont_prime_data.n0 );
         } else if( line_starts_with( buffer, "eccp_affine_point_add" ) ) {
 
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
@@ -571,6 +695,38 @@ unsigned test_ser() {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
                 errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
             }
+
+            // the batch conversion has to handle the identity at any position
+            eccp_point_projective_t batch_in[3];
+            eccp_point_affine_t batch_out[3];
+            eccp_jacobian_point_copy( &batch_in[0], &ecproj_var_c, param );
+            eccp_jacobian_point_copy( &batch_in[1], &ecproj_var_a, param );
+            eccp_jacobian_point_copy( &batch_in[2], &ecproj_var_c, param );
+            eccp_jacobian_to_affine_batch( batch_out, batch_in, 3, param );
+            for( int i = 0; i < 3; i += 2 ) {
+                errors += assert_integer( test_id, ecaff_var_expected.identity, batch_out[i].identity );
+                if( ecaff_var_expected.identity == 0 ) {
+                    errors += assert_bigint( test_id, ecaff_var_expected.x, batch_out[i].x, length );
+                    errors += assert_bigint( test_id, ecaff_var_expected.y, batch_out[i].y, length );
+                }
+            }
+            errors += assert_integer( test_id, ecaff_var_a.identity, batch_out[1].identity );
+            if( ecaff_var_a.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_a.x, batch_out[1].x, length );
+                errors += assert_bigint( test_id, ecaff_var_a.y, batch_out[1].y, length );
+            }
+
+            // the complete formulas have to handle all special cases
+            eccp_affine_to_std_projective( &ecproj_var_a, &ecaff_var_a, param );
+            eccp_affine_to_std_projective( &ecproj_var_b, &ecaff_var_b, param );
+            eccp_std_projective_point_add_complete( &ecproj_var_c, &ecproj_var_a, &ecproj_var_b, param );
+            eccp_std_projective_to_affine( &ecaff_var_c, &ecproj_var_c, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
         } else if( line_starts_with( buffer, "eccp_jacobian_point_double" ) ) {
 
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
@@ -585,6 +741,32 @@ unsigned test_ser() {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
                 errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
             }
+
+            eccp_jacobian_point_double_repeated( &ecproj_var_c, &ecproj_var_a, 1, param );
+            eccp_jacobian_to_affine( &ecaff_var_c, &ecproj_var_c, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+
+            // the repeated doubling has to match single doublings
+            eccp_jacobian_point_double( &ecproj_var_b, &ecproj_var_a, param );
+            eccp_jacobian_point_double( &ecproj_var_b, &ecproj_var_b, param );
+            eccp_jacobian_point_double( &ecproj_var_b, &ecproj_var_b, param );
+            eccp_jacobian_point_double_repeated( &ecproj_var_c, &ecproj_var_a, 3, param );
+            errors += assert_integer( test_id, 1, eccp_jacobian_point_equals( &ecproj_var_b, &ecproj_var_c, param ) );
+
+            eccp_affine_to_std_projective( &ecproj_var_a, &ecaff_var_a, param );
+            eccp_std_projective_point_double_complete( &ecproj_var_c, &ecproj_var_a, param );
+            eccp_std_projective_to_affine( &ecaff_var_c, &ecproj_var_c, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
         } else if( line_starts_with( buffer, "eccp_jacobian_point_negate" ) ) {
 
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
@@ -620,6 +802,93 @@ unsigned test_ser() {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
                 errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
             }
+
+            eccp_protected_point_multiply_coz( &ecaff_var_c, &ecaff_var_a, bi_var_a, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+
+            eccp_std_projective_point_multiply_signed_window( &ecaff_var_c, &ecaff_var_a, bi_var_a, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+
+            eccp_std_projective_point_multiply_window( &ecaff_var_c, &ecaff_var_a, bi_var_a, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+
+            // the unprotected methods do not reject scalars larger than the group order
+            if( bigint_compare_var( bi_var_a, param->order_n_data.prime, param->order_n_data.words ) < 0 ) {
+                for( int width = 2; width <= JCB_WNAF_MAX_WIDTH; width++ ) {
+                    eccp_jacobian_point_multiply_WNAF_width( &ecaff_var_c, &ecaff_var_a, bi_var_a, width, param );
+
+                    errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+                    if( ecaff_var_expected.identity == 0 ) {
+                        errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                        errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+                    }
+                }
+
+                // k*P + 0*G
+                bigint_clear_var( bi_var_b, param->order_n_data.words );
+                eccp_jacobian_double_scalar_multiply( &ecaff_var_c, bi_var_a, &ecaff_var_a, bi_var_b, &param->base_point, param );
+
+                errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+                if( ecaff_var_expected.identity == 0 ) {
+                    errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                    errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+                }
+
+                // k*P + k*P = 2*(k*P)
+                eccp_jacobian_double_scalar_multiply( &ecaff_var_c, bi_var_a, &ecaff_var_a, bi_var_a, &ecaff_var_a, param );
+                eccp_affine_point_double( &ecaff_var_b, &ecaff_var_expected, param );
+
+                errors += assert_integer( test_id, ecaff_var_b.identity, ecaff_var_c.identity );
+                if( ecaff_var_b.identity == 0 ) {
+                    errors += assert_bigint( test_id, ecaff_var_b.x, ecaff_var_c.x, length );
+                    errors += assert_bigint( test_id, ecaff_var_b.y, ecaff_var_c.y, length );
+                }
+            }
+        } else if( line_starts_with( buffer, "eccp_multi_scalar_multiply" ) ) {
+
+            // distinct random points and full-width random scalars, compared to the sum of single multiplications
+            int count = read_integer( buffer, READ_BUFFER_SIZE );
+
+            for( int i = 0; i < count; i++ ) {
+                gfp_rand( bi_var_a, &param->order_n_data );
+                param->eccp_mul( &multi_points[i], &param->base_point, bi_var_a, param );
+                gfp_rand( multi_scalars[i], &param->order_n_data );
+            }
+            if( count >= 4 ) {
+                // a point twice and a point with its negation, both pairs share all buckets
+                eccp_affine_point_copy( &multi_points[1], &multi_points[0], param );
+                bigint_copy_var( multi_scalars[1], multi_scalars[0], param->order_n_data.words );
+                eccp_affine_point_negate( &multi_points[3], &multi_points[2], param );
+                bigint_copy_var( multi_scalars[3], multi_scalars[2], param->order_n_data.words );
+            }
+
+            ecaff_var_expected.identity = 1;
+            for( int i = 0; i < count; i++ ) {
+                param->eccp_mul( &ecaff_var_b, &multi_points[i], multi_scalars[i], param );
+                eccp_affine_point_add( &ecaff_var_expected, &ecaff_var_expected, &ecaff_var_b, param );
+            }
+            eccp_multi_scalar_multiply( &ecaff_var_c, (const gfp_t *)multi_scalars, multi_points, count, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
         } else if( line_starts_with( buffer, "eccp_comb_point_multiply" ) ) {
 
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
@@ -632,6 +901,30 @@ unsigned test_ser() {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
                 errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
             }
+
+            comb_ll_params.eccp_mul_base_point( &ecaff_var_c, bi_var_a, &comb_ll_params );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+
+            // (n+1)*G is rejected instead of returning G
+            bigint_copy_var( bi_var_b, param->order_n_data.prime, param->order_n_data.words );
+            bi_var_b[0] += 1;
+            comb_ll_params.eccp_mul_base_point( &ecaff_var_c, bi_var_b, &comb_ll_params );
+            errors += assert_integer( test_id, 1, ecaff_var_c.identity );
+
+            if( loaded_params.eccp_mul_base_point != NULL ) {
+                loaded_params.eccp_mul_base_point( &ecaff_var_c, bi_var_a, &loaded_params );
+
+                errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+                if( ecaff_var_expected.identity == 0 ) {
+                    errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                    errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+                }
+            }
         } else if( line_starts_with( buffer, "eccp_jacobian_point_equals" ) ) {
 
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
@@ -662,12 +955,24 @@ unsigned test_ser() {
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 0 );
 
+            uint8_t shared_x[BYTES_PER_GFP];
+            int bytes = BYTES_PER_BITS( param->prime_data.bits );
+            int is_valid = ecdh_compute_shared_x( shared_x, bi_var_a, &ecaff_var_a, param );
+
             ecdh_phase_two( &ecaff_var_c, bi_var_a, &ecaff_var_a, param );
 
             errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            errors += assert_integer( test_id, ecaff_var_expected.identity, 1 - is_valid );
             if( ecaff_var_expected.identity == 0 ) {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
                 errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+
+                // the shared secret of the x-only variant is the big-endian x coordinate
+                bigint_clear_var( bi_var_b, length );
+                for( int i = 0; i < bytes; i++ ) {
+                    bigint_set_byte_var( bi_var_b, length, bytes - 1 - i, shared_x[i] );
+                }
+                errors += assert_bigint( test_id, ecaff_var_expected.x, bi_var_b, length );
             }
         } else if( line_starts_with( buffer, "ecdsa_signverify_selftest" ) ) {
 
@@ -682,6 +987,57 @@ unsigned test_ser() {
             int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
 
             errors += assert_integer( test_id, expected, is_valid );
+
+            // the second verification with the same key is a cache hit
+            unsigned long hits_before, hits, misses;
+            ecdsa_cache_get_statistics( &ecdsa_cache, &hits_before, &misses );
+            errors += assert_integer(
+                test_id, expected, ecdsa_is_valid_cached( &ecdsa_cache, &signature, bi_var_a, &ecaff_var_a, param ) );
+            errors += assert_integer(
+                test_id, expected, ecdsa_is_valid_cached( &ecdsa_cache, &signature, bi_var_a, &ecaff_var_a, param ) );
+            ecdsa_cache_get_statistics( &ecdsa_cache, &hits, &misses );
+            errors += assert_integer( test_id, expected, hits > hits_before );
+
+            // batch verification of more signatures than fit into one equation, one of them invalid,
+            // the first signature uses the key pair of the test vector, the others distinct random key pairs
+            ecdsa_signature_t batch_signatures[BATCH_TEST_SIGNATURES];
+            eccp_point_affine_t batch_keys[BATCH_TEST_SIGNATURES];
+            gfp_t batch_hashes[BATCH_TEST_SIGNATURES];
+            uint8_t batch_valid[BATCH_TEST_SIGNATURES];
+
+            for( int i = 0; i < BATCH_TEST_SIGNATURES; i++ ) {
+                bigint_copy_var( batch_hashes[i], bi_var_a, param->order_n_data.words );
+                batch_hashes[i][0] ^= i;
+                if( i == 0 ) {
+                    bigint_copy_var( bi_var_c, bi_var_b, param->order_n_data.words );
+                    eccp_affine_point_copy( &batch_keys[i], &ecaff_var_a, param );
+                } else {
+                    eckeygen( bi_var_c, &batch_keys[i], param );
+                }
+                ecdsa_sign( &batch_signatures[i], batch_hashes[i], bi_var_c, param );
+            }
+            errors += assert_integer( test_id,
+                                      expected,
+                                      ecdsa_batch_is_valid( NULL,
+                                                            batch_signatures,
+                                                            (const gfp_t *)batch_hashes,
+                                                            batch_keys,
+                                                            BATCH_TEST_SIGNATURES,
+                                                            param ) );
+
+            batch_hashes[BATCH_TEST_SIGNATURES - 2][0] ^= 0x100;
+            errors += assert_integer( test_id,
+                                      0,
+                                      ecdsa_batch_is_valid( batch_valid,
+                                                            batch_signatures,
+                                                            (const gfp_t *)batch_hashes,
+                                                            batch_keys,
+                                                            BATCH_TEST_SIGNATURES,
+                                                            param ) );
+            for( int i = 0; i < BATCH_TEST_SIGNATURES; i++ ) {
+                int expected_valid = i == 0 ? expected : 1;
+                errors += assert_integer( test_id, i == BATCH_TEST_SIGNATURES - 2 ? 0 : expected_valid, batch_valid[i] );
+            }
         } else if( line_starts_with( buffer, "ecdsa_is_valid_sha1" ) ) {
 
             hash_sha1_t sha1_state;
@@ -703,6 +1059,8 @@ unsigned test_ser() {
 
             int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
             errors += assert_integer( test_id, expected, is_valid );
+            errors += assert_integer(
+                test_id, expected, ecdsa_is_valid_cached( &ecdsa_cache, &signature, bi_var_a, &ecaff_var_a, param ) );
         } else if( line_starts_with( buffer, "ecdsa_is_valid_sha224" ) ) {
 
             hash_sha224_256_t sha2_state;
@@ -724,6 +1082,8 @@ unsigned test_ser() {
 
             int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
             errors += assert_integer( test_id, expected, is_valid );
+            errors += assert_integer(
+                test_id, expected, ecdsa_is_valid_cached( &ecdsa_cache, &signature, bi_var_a, &ecaff_var_a, param ) );
         } else if( line_starts_with( buffer, "ecdsa_is_valid_sha256" ) ) {
 
             hash_sha224_256_t sha2_state;
@@ -745,6 +1105,8 @@ unsigned test_ser() {
 
             int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
             errors += assert_integer( test_id, expected, is_valid );
+            errors += assert_integer(
+                test_id, expected, ecdsa_is_valid_cached( &ecdsa_cache, &signature, bi_var_a, &ecaff_var_a, param ) );
         } else if( line_starts_with( buffer, "ecdsa_is_valid_sha384" ) ) {
         } else if( line_starts_with( buffer, "ecdsa_is_valid_sha512" ) ) {
         } else if( line_starts_with( buffer, "ecdsa_is_valid" ) ) {
@@ -760,6 +1122,8 @@ unsigned test_ser() {
 
             int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
             errors += assert_integer( test_id, expected, is_valid );
+            errors += assert_integer(
+                test_id, expected, ecdsa_is_valid_cached( &ecdsa_cache, &signature, bi_var_a, &ecaff_var_a, param ) );
         } else if( line_starts_with( buffer, "sha1_final" ) ) {
 
             hash_sha1_t sha1_state;
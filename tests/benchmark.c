@@ -1,9 +1,14 @@
+#include "flecc_in_c/eccp/eccp.h"
+#include "flecc_in_c/gfp/gfp_const_runtime.h"
 #include "flecc_in_c/utils/param.h"
 #include "flecc_in_c/utils/performance.h"
 
 #include <stdio.h>
 #include <string.h>
 
+#define COMB_WIDTH 6
+#define COMB_LL_WIDTH 4
+
 void run_benchmarks(curve_type_t curve_type) {
     eccp_parameters_t curve_params;
     param_load( &curve_params, curve_type );
@@ -14,9 +19,53 @@ void run_benchmarks(curve_type_t curve_type) {
     printf("Benchmarking curve %d:\n", curve_type);
     printf("gfp_mul : ");
     performance_test_gfp_mul( &curve_params );
+    printf("gfp_mul_sos  : ");
+    performance_test_gfp_operation( &curve_params, &gfp_cr_mont_multiply_sos );
+    printf("gfp_mul_cios : ");
+    performance_test_gfp_operation( &curve_params, &gfp_cr_mont_multiply_cios );
+    printf("gfp_mul_comba: ");
+    performance_test_gfp_operation( &curve_params, &gfp_cr_mont_multiply_comba );
+
+    printf("ecdh_phase_two: ");
+    performance_test_ecdh( &curve_params, 0 );
+    printf("ecdh_compute_shared_x: ");
+    performance_test_ecdh( &curve_params, 1 );
+
+    printf("ecdsa_verify: ");
+    performance_test_ecdsa_verify( &curve_params );
+    printf("ecdsa_verify_cached: ");
+    performance_test_ecdsa_verify_cached( &curve_params );
 
     printf("eccp_mul: ");
     performance_test_eccp_mul( &curve_params );
+    printf("eccp_mul_coz: ");
+    curve_params.eccp_mul = &eccp_protected_point_multiply_coz;
+    performance_test_eccp_mul( &curve_params );
+    printf("eccp_mul_window: ");
+    curve_params.eccp_mul = &eccp_std_projective_point_multiply_window;
+    performance_test_eccp_mul( &curve_params );
+    printf("eccp_mul_signed_window: ");
+    curve_params.eccp_mul = &eccp_std_projective_point_multiply_signed_window;
+    performance_test_eccp_mul( &curve_params );
+
+    eccp_point_affine_t comb_table[JCB_COMB_TBL_SIZE( COMB_WIDTH )];
+    curve_params.base_point_precomputed_table_width = COMB_WIDTH;
+    eccp_jacobian_point_multiply_COMB_precompute( comb_table, &curve_params );
+    printf("eccp_mul_base_point_comb: ");
+    performance_test_eccp_mul_base_point( &curve_params );
+
+    eccp_point_affine_t comb_ll_table[ECCP_STD_PROJECTIVE_COMB_TBL_SIZE( COMB_LL_WIDTH )];
+    curve_params.base_point_precomputed_table_width = COMB_LL_WIDTH;
+    eccp_std_projective_point_multiply_COMB_LL_precompute( comb_ll_table, &curve_params );
+    printf("eccp_mul_base_point_comb_ll: ");
+    performance_test_eccp_mul_base_point( &curve_params );
+
+    for( int size = 8; size <= 256; size <<= 1 ) {
+        printf("eccp_table_select_direct(%d): ", size);
+        performance_test_eccp_table_select( &curve_params, size, 0 );
+        printf("eccp_table_select_ct(%d): ", size);
+        performance_test_eccp_table_select( &curve_params, size, 1 );
+    }
     printf("\n");
 }
 
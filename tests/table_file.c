@@ -0,0 +1,129 @@
+#include "flecc_in_c/eccp/eccp.h"
+#include "flecc_in_c/utils/param.h"
+#include "flecc_in_c/utils/rand.h"
+
+#include <stdio.h>
+
+#define TABLE_WIDTH 5
+#define TABLE_FILE "table_file_test.tbl"
+
+/**
+ * Checks that unmapping leaves parameters alone whose table was not mapped.
+ * @param param elliptic curve parameters (compared with their state after param_load)
+ * @param curve_type the curve of the parameters
+ * @param what describes the situation for the error message
+ * @return the number of errors
+ */
+static int check_untouched( const eccp_parameters_t *param, const curve_type_t curve_type, const char *what ) {
+    eccp_parameters_t loaded;
+
+    param_load( &loaded, curve_type );
+    if( param->base_point_precomputed_table != loaded.base_point_precomputed_table
+        || param->base_point_precomputed_table_width != loaded.base_point_precomputed_table_width
+        || param->eccp_mul_base_point != loaded.eccp_mul_base_point ) {
+        printf( "ERROR: unmapping %s changed the parameters\n", what );
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Checks that a table written with eccp_table_save can be mapped and gives the
+ * same results as the table in memory, and that mismatching files are rejected.
+ * @param curve_type the curve to test
+ * @return the number of errors
+ */
+int test_table_file( const curve_type_t curve_type ) {
+    eccp_point_affine_t table[ECCP_STD_PROJECTIVE_COMB_TBL_SIZE( TABLE_WIDTH )];
+    eccp_table_mapping_t mapping = ECCP_TABLE_MAPPING_INIT;
+    eccp_parameters_t param, mapped, other;
+    eccp_point_affine_t expected, result;
+    gfp_t scalar;
+    FILE *file;
+    int i, errors = 0;
+
+    param_load( &param, curve_type );
+    param.base_point_precomputed_table_width = TABLE_WIDTH;
+    eccp_std_projective_point_multiply_COMB_LL_precompute( table, &param );
+
+    if( eccp_table_save( TABLE_FILE, &param ) != 1 ) {
+        printf( "ERROR: saving the table failed\n" );
+        return 1;
+    }
+
+    // without a mapping, the table of param_load is kept
+    param_load( &mapped, curve_type );
+    eccp_table_unmap( &mapping, &mapped );
+    errors += check_untouched( &mapped, curve_type, "without mapping" );
+
+    // mapping twice with the same handle releases the first mapping
+    for( i = 0; i < 2; i++ ) {
+        if( eccp_table_map( &mapping, TABLE_FILE, &mapped ) != 1 ) {
+            printf( "ERROR: mapping the table failed\n" );
+            return errors + 1;
+        }
+    }
+    if( mapped.base_point_precomputed_table_width != TABLE_WIDTH ) {
+        printf( "ERROR: wrong table width\n" );
+        errors++;
+    }
+    for( i = 0; i < 10; i++ ) {
+        gfp_rand( scalar, &param.order_n_data );
+        param.eccp_mul_base_point( &expected, scalar, &param );
+        mapped.eccp_mul_base_point( &result, scalar, &mapped );
+        if( eccp_affine_point_compare( &expected, &result, &param ) != 0 ) {
+            printf( "ERROR: the mapped table gives a different result\n" );
+            errors++;
+        }
+    }
+    eccp_table_unmap( &mapping, &mapped );
+    if( mapped.base_point_precomputed_table != NULL || mapped.eccp_mul_base_point != NULL || mapping.base != NULL ) {
+        printf( "ERROR: unmapping did not reset the parameters\n" );
+        errors++;
+    }
+
+    // parameters that do not use the mapped table keep their own one
+    param_load( &other, curve_type );
+    if( eccp_table_map( &mapping, TABLE_FILE, &mapped ) != 1 ) {
+        printf( "ERROR: mapping the table again failed\n" );
+        errors++;
+    }
+    eccp_table_unmap( &mapping, &other );
+    errors += check_untouched( &other, curve_type, "a table of other parameters" );
+
+    // a table of a different curve is rejected, unmapping afterwards changes nothing
+    param_load( &other, curve_type == SECP256R1 ? SECP384R1 : SECP256R1 );
+    if( eccp_table_map( &mapping, TABLE_FILE, &other ) != 0 || mapping.base != NULL ) {
+        printf( "ERROR: the table of a different curve was mapped\n" );
+        errors++;
+    }
+    eccp_table_unmap( &mapping, &other );
+    errors += check_untouched( &other, curve_type == SECP256R1 ? SECP384R1 : SECP256R1, "after a failed mapping" );
+
+    // a modified entry fails the checksum
+    file = fopen( TABLE_FILE, "r+b" );
+    fseek( file, ECCP_TABLE_HEADER_SIZE + sizeof( eccp_point_affine_t ) + 1, SEEK_SET );
+    fputc( 0x5A, file );
+    fclose( file );
+    param_load( &mapped, curve_type );
+    if( eccp_table_map( &mapping, TABLE_FILE, &mapped ) != 0 ) {
+        printf( "ERROR: a corrupted table was mapped\n" );
+        errors++;
+    }
+    eccp_table_unmap( &mapping, &mapped );
+    errors += check_untouched( &mapped, curve_type, "after a failed mapping" );
+
+    remove( TABLE_FILE );
+    return errors;
+}
+
+int main() {
+    curve_type_t curves[] = {SECP192R1, SECP224R1, SECP256R1, SECP384R1, SECP521R1};
+    int errors = 0;
+
+    for( unsigned idx = 0; idx < sizeof( curves ) / sizeof( curve_type_t ); ++idx ) {
+        errors += test_table_file( curves[idx] );
+    }
+    printf( "%d errors\n", errors );
+    return errors != 0;
+}
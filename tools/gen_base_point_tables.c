@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+/*
+ * Generates the Lim-Lee comb tables of the base points of all standard curves
+ * as a C source file (used by param_load if the library is built with
+ * BASE_POINT_TABLES). The generator is linked against the library sources of
+ * the same configuration, so the coordinates have the representation (word
+ * size, Montgomery or normal basis) the library expects.
+ *
+ * usage: gen_base_point_tables <width> <output file>
+ */
+
+#include "flecc_in_c/eccp/eccp.h"
+#include "flecc_in_c/utils/param.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/** the largest supported comb width (the tables grow with 2^width) */
+#define MAX_WIDTH 8
+
+static const curve_type_t curves[] = {SECP192R1, SECP224R1, SECP256R1, SECP384R1, SECP521R1};
+static const char *const names[] = {"secp192r1", "secp224r1", "secp256r1", "secp384r1", "secp521r1"};
+
+/**
+ * prints the least significant words of a big integer as array initializer
+ * @param out the output file
+ * @param a the big integer
+ * @param words the number of words to print
+ */
+static void print_bigint( FILE *out, const uint_t *a, const int words ) {
+    int i;
+
+    fprintf( out, "{" );
+    for( i = 0; i < words; i++ ) {
+        fprintf( out, "%s0x%0*llX", i == 0 ? "" : ", ", 2 * BYTES_PER_WORD, (unsigned long long)a[i] );
+    }
+    fprintf( out, "}" );
+}
+
+/**
+ * computes and prints the comb table of the base point of one curve
+ * @param out the output file
+ * @param type the type of curve
+ * @param name the name of the curve (part of the generated symbol)
+ * @param width the comb width
+ * @return 0 if successful, 1 otherwise
+ */
+static int print_table( FILE *out, const curve_type_t type, const char *name, const int width ) {
+    static eccp_point_affine_t table[ECCP_STD_PROJECTIVE_COMB_TBL_SIZE( MAX_WIDTH )];
+    eccp_parameters_t param;
+    int i;
+
+    param_load( &param, type );
+    if( param.curve_type != type ) {
+        return 1;
+    }
+    param.base_point_precomputed_table_width = width;
+    eccp_std_projective_point_multiply_COMB_LL_precompute( table, &param );
+
+    fprintf( out, "const eccp_point_affine_t param_%s_base_point_table[] = {\n", name );
+    for( i = 0; i < ECCP_STD_PROJECTIVE_COMB_TBL_SIZE( width ); i++ ) {
+        fprintf( out, "    {" );
+        print_bigint( out, table[i].x, param.prime_data.words );
+        fprintf( out, ", " );
+        print_bigint( out, table[i].y, param.prime_data.words );
+        fprintf( out, ", %d},\n", table[i].identity );
+    }
+    fprintf( out, "};\n\n" );
+    return 0;
+}
+
+int main( int argc, char **argv ) {
+    FILE *out;
+    int width;
+    unsigned idx;
+
+    if( argc != 3 ) {
+        fprintf( stderr, "usage: %s <width> <output file>\n", argv[0] );
+        return 1;
+    }
+    width = atoi( argv[1] );
+    if( width < 1 || width > MAX_WIDTH ) {
+        fprintf( stderr, "ERROR: the comb width has to be between 1 and %d.\n", MAX_WIDTH );
+        return 1;
+    }
+    out = fopen( argv[2], "w" );
+    if( out == NULL ) {
+        fprintf( stderr, "ERROR: \"%s\" could not be opened.\n", argv[2] );
+        return 1;
+    }
+
+    fprintf( out, "/* generated by gen_base_point_tables, do not edit */\n\n" );
+    fprintf( out, "#include \"flecc_in_c/types.h\"\n\n" );
+    fprintf( out, "#if BYTES_PER_WORD != %d\n", BYTES_PER_WORD );
+    fprintf( out, "#error \"the base point tables were generated for a different word size\"\n" );
+    fprintf( out, "#endif\n" );
+    fprintf( out, "#if BASE_POINT_TABLE_WIDTH != %d\n", width );
+    fprintf( out, "#error \"the base point tables were generated for a different comb width\"\n" );
+    fprintf( out, "#endif\n\n" );
+    fprintf( out, "// clang-format off\n" );
+    for( idx = 0; idx < sizeof( curves ) / sizeof( curve_type_t ); idx++ ) {
+        if( print_table( out, curves[idx], names[idx], width ) != 0 ) {
+            fprintf( stderr, "ERROR: the parameters of %s could not be loaded.\n", names[idx] );
+            fclose( out );
+            remove( argv[2] );
+            return 1;
+        }
+    }
+    fprintf( out, "// clang-format on\n" );
+
+    if( fclose( out ) != 0 ) {
+        remove( argv[2] );
+        return 1;
+    }
+    return 0;
+}